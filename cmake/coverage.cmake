@@ -23,6 +23,10 @@ target_link_options(${PROJECT_NAME}_unittest PRIVATE
     -fprofile-instr-generate
     -fcoverage-mapping)
 
+target_link_options(${PROJECT_NAME}_alloc_unittest PRIVATE
+    -fprofile-instr-generate
+    -fcoverage-mapping)
+
 
 add_custom_target(
 coverage
@@ -40,7 +40,7 @@ $$;
 -- ===========================
 CREATE TABLE chat.users (
     user_id TEXT NOT NULL PRIMARY KEY,
-    username TEXT NOT NULL UNIQUE,
+    username TEXT NOT NULL,
     display_name TEXT NOT NULL,
     password_hash TEXT NOT NULL,
     salt TEXT NOT NULL,
@@ -50,6 +50,10 @@ CREATE TABLE chat.users (
     updated_at TIMESTAMPTZ NOT NULL DEFAULT now()
 );
 
+-- Deleted users keep their rows as tombstones for incremental cache updates, the username is free for reuse
+CREATE UNIQUE INDEX idx_users_username_alive ON chat.users(username) WHERE NOT is_deleted;
+CREATE INDEX idx_users_updated_at ON chat.users(updated_at);
+
 -- ===========================
 --  CHANNELS
 -- ===========================
@@ -77,6 +81,35 @@ CREATE TABLE chat.channel_members (
 
 CREATE INDEX idx_channel_members_user_id ON chat.channel_members(user_id);
 
+-- ===========================
+--  MESSAGES
+-- ===========================
+-- Written behind the send path in batches, no FK: one dropped channel must not fail the whole batch
+-- seq is assigned by the service at send time (unix ms << 16 | counter), history is paged by (channel_id, seq)
+CREATE TABLE chat.messages (
+    message_id BIGINT GENERATED ALWAYS AS IDENTITY PRIMARY KEY,
+    channel_id TEXT NOT NULL,
+    seq BIGINT NOT NULL,
+    sender_id TEXT NOT NULL,
+    text TEXT NOT NULL,
+    created_at TIMESTAMPTZ NOT NULL DEFAULT now()
+);
+
+-- seq уникален в чате: повтор пачки писателем истории не создает дублей
+CREATE UNIQUE INDEX idx_messages_channel_seq ON chat.messages(channel_id, seq);
+
+-- ===========================
+--  PRESENCE
+-- ===========================
+-- Lease (user, node): one row per node holding the user, rewritten by that node when a third of the TTL is left;
+-- stale rows are ignored by expires_at
+CREATE TABLE chat.presence (
+    user_id TEXT NOT NULL,
+    node_id TEXT NOT NULL,
+    expires_at TIMESTAMPTZ NOT NULL,
+    PRIMARY KEY (user_id, node_id)
+);
+
 -- ===========================
 --  FOR MAPPERS
 -- ===========================
@@ -86,7 +119,8 @@ CREATE TYPE chat.user AS (
     display_name TEXT,
     password_hash TEXT,
     salt TEXT,
-    biography TEXT
+    biography TEXT,
+    updated_at TIMESTAMPTZ
 );
 
 -- ===========================
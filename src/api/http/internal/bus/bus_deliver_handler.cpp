@@ -0,0 +1,61 @@
+#include "bus_deliver_handler.hpp"
+
+#include <infra/components/messaging/bus/message_bus_component.hpp>
+#include <infra/components/messaging/messaging_service_component.hpp>
+#include <infra/messaging/bus/bus_protocol.hpp>
+
+#include <api/http/exceptions/handler_exceptions.hpp>
+
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/crypto/algorithm.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+namespace NChat::NInfra::NHandlers {
+
+TBusDeliverHandler::TBusDeliverHandler(const userver::components::ComponentConfig& config,
+                                       const userver::components::ComponentContext& context)
+    : HttpHandlerJsonBase(config, context),
+      MessageService_(context.FindComponent<NComponents::TMessagingServiceComponent>().GetService()),
+      Secret_(context.FindComponent<NComponents::TMessageBusComponent>().GetSecret()),
+      Stats_(context.FindComponent<userver::components::StatisticsStorage>().GetMetricsStorage()->GetMetric(
+          kMessageBusTag)) {
+}
+
+userver::formats::json::Value TBusDeliverHandler::HandleRequestJsonThrow(
+    const userver::server::http::HttpRequest& request, const userver::formats::json::Value& request_json,
+    userver::server::request::RequestContext& /*request_context*/) const {
+  const auto& secret = request.GetHeader(kBusSecretHeader);
+  if (Secret_.empty() || !userver::crypto::algorithm::AreStringsEqualConstTime(secret, Secret_)) {
+    throw TForbiddenException("Forwarding to this node is not allowed");
+  }
+
+  std::vector<NCore::TRouteTask> batch;
+
+  try {
+    batch = ParseForwardBatch(request_json);
+  } catch (const NCore::NDomain::TMessageTextInvalidException& ex) {
+    throw TValidationException(ex.GetField(), ex.what());
+  } catch (const userver::formats::json::Exception& ex) {
+    throw TValidationException("tasks", ex.what());
+  }
+
+  Stats_.received_total.Add({batch.size()});
+
+  NCore::TSendStatus total;
+  for (const auto& status : MessageService_.DeliverForwarded(std::move(batch))) {
+    total.Successful += status.Successful;
+    total.Dropped += status.Dropped;
+    total.Offline += status.Offline;
+  }
+
+  userver::formats::json::ValueBuilder builder;
+  builder["delivered"] = total.Successful;
+  builder["dropped"] = total.Dropped;
+  builder["offline"] = total.Offline;
+
+  return builder.ExtractValue();
+}
+
+}  // namespace NChat::NInfra::NHandlers
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <app/services/message/messaging_service.hpp>
+
+#include <infra/messaging/bus/metrics/bus_stats.hpp>
+
+#include <userver/server/handlers/http_handler_json_base.hpp>
+
+namespace NChat::NInfra::NHandlers {
+
+// Прием пачек, пересланных другими узлами кластера через шину сообщений
+class TBusDeliverHandler final : public userver::server::handlers::HttpHandlerJsonBase {
+ public:
+  static constexpr std::string_view kName = "handler-bus-deliver";
+
+  TBusDeliverHandler(const userver::components::ComponentConfig&, const userver::components::ComponentContext&);
+
+  userver::formats::json::Value HandleRequestJsonThrow(
+      const userver::server::http::HttpRequest& request, const userver::formats::json::Value& request_json,
+      userver::server::request::RequestContext& context) const override;
+
+ private:
+  NApp::NServices::TMessagingService& MessageService_;
+  const std::string& Secret_;
+  TMessageBusStatistics& Stats_;
+};
+
+}  // namespace NChat::NInfra::NHandlers
@@ -2,8 +2,6 @@
 
 #include <infra/components/users/user_service_component.hpp>
 
-#include <utils/jwt/jwt.hpp>
-
 #include <api/http/common/context.hpp>
 
 #include <userver/http/common_headers.hpp>
@@ -0,0 +1,81 @@
+#include "chat_history_handler.hpp"
+
+#include <infra/components/messaging/messaging_service_component.hpp>
+
+#include <api/http/common/context.hpp>
+#include <api/http/exceptions/handler_exceptions.hpp>
+
+#include <docs/api.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/from_string.hpp>
+
+namespace {
+constexpr std::size_t kDefaultLimit = 50;
+constexpr std::size_t kMaxLimit = 100;
+}  // namespace
+
+namespace NChat::NInfra::NHandlers {
+
+TChatHistoryHandler::TChatHistoryHandler(const userver::components::ComponentConfig& config,
+                                         const userver::components::ComponentContext& context)
+    : HttpHandlerJsonBase(config, context),
+      MessageService_(context.FindComponent<NComponents::TMessagingServiceComponent>().GetService()) {
+}
+
+userver::formats::json::Value TChatHistoryHandler::HandleRequestJsonThrow(
+    const userver::server::http::HttpRequest& request, const userver::formats::json::Value& /*request_json*/,
+    userver::server::request::RequestContext& request_context) const {
+  NApp::NDto::TGetHistoryRequest request_dto{
+      .RequesterId = NCore::NDomain::TUserId{request_context.GetData<std::string>(ToString(EContextKey::UserId))},
+      .ChatId = NCore::NDomain::TChatId{request.GetPathArg("chat_id")},
+      .Limit = kDefaultLimit};
+
+  if (request.HasArg("before")) {
+    try {
+      request_dto.Before = userver::utils::FromString<NCore::NDomain::TMessageSeq>(request.GetArg("before"));
+    } catch (const std::exception& ex) {
+      throw TValidationException("before", "Must be an integer");
+    }
+  }
+
+  if (request.HasArg("limit")) {
+    try {
+      request_dto.Limit = userver::utils::FromString<std::size_t>(request.GetArg("limit"));
+    } catch (const std::exception& ex) {
+      throw TValidationException("limit", "Must be an integer");
+    }
+
+    if (request_dto.Limit == 0 || request_dto.Limit > kMaxLimit) {
+      throw TValidationException("limit", fmt::format("Must be between 1 and {}", kMaxLimit));
+    }
+  }
+
+  NApp::NDto::TGetHistoryResult result;
+
+  try {
+    result = MessageService_.GetHistory(request_dto);
+  } catch (const NApp::THistoryForbidden& ex) {
+    throw TForbiddenException(ex.what());
+  }
+
+  TChatHistoryResponse response;
+  response.messages.reserve(result.Messages.size());
+
+  for (const auto& message : result.Messages) {
+    std::optional<std::string> sender;
+    if (message.Sender) {
+      sender = message.Sender->Value();
+    }
+
+    response.messages.push_back(TChatMessage{.seq = message.Seq,
+                                             .sender = std::move(sender),
+                                             .text = message.Text.Value(),
+                                             .sent_at = userver::utils::datetime::Timestring(message.SentAt)});
+  }
+  response.next_before = result.NextBefore;
+
+  return userver::formats::json::ValueBuilder{response}.ExtractValue();
+}
+
+}  // namespace NChat::NInfra::NHandlers
@@ -2,17 +2,15 @@
 
 #include <core/users/value/username.hpp>
 
+#include <infra/components/config/config_cache_component.hpp>
 #include <infra/components/messaging/messaging_service_component.hpp>
 #include <infra/serializer/serializer.hpp>
 
 #include <api/http/common/context.hpp>
 #include <api/http/exceptions/handler_exceptions.hpp>
-#include <api/http/v1/messages/polling/config/polling_config.hpp>
 
 #include <userver/components/component_context.hpp>
 #include <userver/components/statistics_storage.hpp>
-#include <userver/dynamic_config/source.hpp>
-#include <userver/dynamic_config/storage/component.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
 using NChat::NApp::NDto::TPollMessagesRequest;
@@ -26,7 +24,7 @@ TPollMessageHandler::TPollMessageHandler(const userver::components::ComponentCon
                                          const userver::components::ComponentContext& context)
     : HttpHandlerJsonBase(config, context),
       MessageService_(context.FindComponent<NComponents::TMessagingServiceComponent>().GetService()),
-      ConfigSource_(context.FindComponent<userver::components::DynamicConfig>().GetSource()),
+      ConfigCache_(context.FindComponent<NComponents::TConfigCacheComponent>().GetCache()),
       Stats_(
           context.FindComponent<userver::components::StatisticsStorage>().GetMetricsStorage()->GetMetric(kPollingTag)) {
 }
@@ -39,8 +37,7 @@ userver::formats::json::Value TPollMessageHandler::HandleRequestJsonThrow(
   TUserId consumer_id{request_context.GetData<std::string>(ToString(EContextKey::UserId))};
   TSessionId session_id{request.GetPathArg("session_id")};
 
-  const auto snapshot = ConfigSource_.GetSnapshot();
-  const auto polling_config = snapshot[kPollingConfig];
+  const auto polling_config = ConfigCache_.GetPollingConfig();
 
   std::size_t max_size = polling_config.MaxSize;
   std::chrono::seconds poll_time = polling_config.PollTime;
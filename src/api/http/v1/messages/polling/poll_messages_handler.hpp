@@ -2,6 +2,8 @@
 
 #include <app/services/message/messaging_service.hpp>
 
+#include <infra/config/config_cache.hpp>
+
 #include <api/http/v1/messages/polling/metrics/polling_stats.hpp>
 
 #include <userver/server/handlers/http_handler_json_base.hpp>
@@ -23,7 +25,7 @@ class TPollMessageHandler : public userver::server::handlers::HttpHandlerJsonBas
 
  private:
   NApp::NServices::TMessagingService& MessageService_;
-  userver::dynamic_config::Source ConfigSource_;
+  const TConfigCache& ConfigCache_;
   TPollingStatistics& Stats_;
 };
 
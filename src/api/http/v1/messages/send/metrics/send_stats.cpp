@@ -6,11 +6,15 @@ void DumpMetric(userver::utils::statistics::Writer& writer, const TSendStatistic
   writer["successful"]["total"] = stats.successfull_sent;
   writer["dropped"]["overflow"]["total"] = stats.dropped_overflow_total;
   writer["dropped"]["offline"]["total"] = stats.dropped_offline_total;
+  writer["forwarded"]["total"] = stats.forwarded_total;
+  writer["deduplicated"]["total"] = stats.deduplicated_total;
 }
 
 void ResetMetric(TSendStatistics& stats) {
   stats.successfull_sent.Store({0});
   stats.dropped_offline_total.Store({0});
+  stats.forwarded_total.Store({0});
   stats.dropped_overflow_total.Store({0});
+  stats.deduplicated_total.Store({0});
 }
 }  // namespace NChat::NInfra
@@ -13,6 +13,8 @@ struct TSendStatistics {
   userver::utils::statistics::RateCounter successfull_sent{0};
   userver::utils::statistics::RateCounter dropped_overflow_total{0};
   userver::utils::statistics::RateCounter dropped_offline_total{0};
+  userver::utils::statistics::RateCounter forwarded_total{0};
+  userver::utils::statistics::RateCounter deduplicated_total{0};
 };
 
 inline const userver::utils::statistics::MetricTag<TSendStatistics> kSendTag{"chat_send"};
@@ -10,9 +10,18 @@
 #include <userver/components/component_context.hpp>
 #include <userver/components/statistics_storage.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <string>
+
 using NChat::NApp::NDto::TSendMessageRequest;
 using NChat::NCore::NDomain::TUserId;
 
+namespace {
+constexpr std::string_view kIdempotencyKeyHeader = "Idempotency-Key";
+constexpr std::size_t kMaxIdempotencyKeyLength = 128;
+}  // namespace
+
 namespace userver::formats::parse {
 TSendMessageRequest Parse(const formats::json::Value& json, formats::parse::To<TSendMessageRequest>) {
   using NChat::NCore::NDomain::TChatId;
@@ -53,6 +62,13 @@ userver::formats::json::Value TSendMessageHandler::HandleRequestJsonThrow(
   request_dto.SentAt = start_timepoint;
   request_dto.SenderId = TUserId{request_context.GetData<std::string>(ToString(EContextKey::UserId))};
 
+  if (const auto& idempotency_key = request.GetHeader(kIdempotencyKeyHeader); !idempotency_key.empty()) {
+    if (idempotency_key.size() > kMaxIdempotencyKeyLength) {
+      throw TValidationException(kIdempotencyKeyHeader, "Header is too long");
+    }
+    request_dto.IdempotencyKey = idempotency_key;
+  }
+
   NApp::NDto::TSendMessageResult result;
 
   try {
@@ -63,15 +79,35 @@ userver::formats::json::Value TSendMessageHandler::HandleRequestJsonThrow(
     throw TValidationException(ex.GetField(), ex.what());
   } catch (const NApp::TUnknownChat& ex) {
     throw TNotFoundException(ex.what());
+  } catch (const NApp::TIdempotencyKeyInFlight& ex) {
+    throw TConflictException(ex.what());
+  } catch (const NApp::TChatOverloaded& ex) {
+    // Чат насыщен: отправитель повторяет не раньше, чем разгрузятся очереди получателей
+    const auto retry_after = std::max<std::int64_t>(
+        std::chrono::ceil<std::chrono::seconds>(ex.GetRetryAfter()).count(), 1);
+
+    auto& response = request.GetHttpResponse();
+    response.SetHeader(std::string_view{"Retry-After"}, std::to_string(retry_after));
+    response.SetStatus(userver::server::http::HttpStatus::kTooManyRequests);
+    return MakeError(ex.what());
   } catch (const NApp::TTooManyRequests& ex) {
     throw TTooManyRequestsException(ex.what());
   }
 
+  auto& response = request.GetHttpResponse();
+
+  if (result.IsDuplicate) {
+    ++Stats_.deduplicated_total;
+    response.SetHeader(std::string_view{"Idempotent-Replayed"}, "true");
+    response.SetStatus(userver::server::http::HttpStatus::kAccepted);
+    return {};
+  }
+
   Stats_.successfull_sent.Add({result.SuccessfulSent});
   Stats_.dropped_offline_total.Add({result.OfflineCount});
+  Stats_.forwarded_total.Add({result.ForwardedCount});
   Stats_.dropped_overflow_total.Add({result.OverflowDropCount});
 
-  auto& response = request.GetHttpResponse();
   response.SetStatus(userver::server::http::HttpStatus::kAccepted);
   return {};
 }
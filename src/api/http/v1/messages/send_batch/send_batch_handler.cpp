@@ -0,0 +1,112 @@
+#include "send_batch_handler.hpp"
+
+#include <infra/components/messaging/messaging_service_component.hpp>
+
+#include <api/http/common/context.hpp>
+#include <api/http/exceptions/handler_exceptions.hpp>
+
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+
+using NChat::NApp::NDto::ESendItemStatus;
+using NChat::NApp::NDto::TSendBatchItem;
+using NChat::NApp::NDto::TSendBatchItemResult;
+using NChat::NApp::NDto::TSendBatchRequest;
+using NChat::NCore::NDomain::TUserId;
+
+namespace {
+constexpr std::size_t kMaxBatchSize = 100;
+
+std::string_view StatusToString(ESendItemStatus status) {
+  switch (status) {
+    case ESendItemStatus::Accepted:
+      return "accepted";
+    case ESendItemStatus::InvalidPayload:
+      return "invalid_payload";
+    case ESendItemStatus::RateLimited:
+      return "rate_limited";
+    case ESendItemStatus::UnknownChat:
+      return "chat_not_found";
+    case ESendItemStatus::Forbidden:
+      return "forbidden";
+    case ESendItemStatus::Overloaded:
+      return "overloaded";
+  }
+
+  return "unknown";
+}
+}  // namespace
+
+namespace userver::formats::parse {
+TSendBatchItem Parse(const formats::json::Value& json, formats::parse::To<TSendBatchItem>) {
+  using NChat::NCore::NDomain::TChatId;
+  using NChat::NInfra::NHandlers::TValidationException;
+
+  TSendBatchItem item{.ChatId = TChatId{json["chat_id"].As<std::string>("")},
+                      .Text = json["payload"].As<std::string>("")};
+
+  // Only Syntax Validation
+  if (item.ChatId.empty()) {
+    throw TValidationException("chat_id", "Field is missing");
+  }
+
+  if (item.Text.empty()) {
+    throw TValidationException("payload", "Field is missing");
+  }
+
+  return item;
+}
+}  // namespace userver::formats::parse
+
+namespace userver::formats::serialize {
+json::Value Serialize(const TSendBatchItemResult& item, To<json::Value>) {
+  json::ValueBuilder builder;
+  builder["status"] = std::string{StatusToString(item.Status)};
+
+  return builder.ExtractValue();
+}
+}  // namespace userver::formats::serialize
+
+namespace NChat::NInfra::NHandlers {
+
+TSendBatchHandler::TSendBatchHandler(const userver::components::ComponentConfig& config,
+                                     const userver::components::ComponentContext& context)
+    : HttpHandlerJsonBase(config, context),
+      MessageService_(context.FindComponent<NComponents::TMessagingServiceComponent>().GetService()),
+      Stats_(context.FindComponent<userver::components::StatisticsStorage>().GetMetricsStorage()->GetMetric(kSendTag)) {
+}
+
+userver::formats::json::Value TSendBatchHandler::HandleRequestJsonThrow(
+    const userver::server::http::HttpRequest& /*request*/, const userver::formats::json::Value& request_json,
+    userver::server::request::RequestContext& request_context) const {
+  const auto start_timepoint = userver::utils::datetime::SteadyNow();
+
+  const auto& messages = request_json["messages"];
+  if (!messages.IsArray() || messages.IsEmpty()) {
+    throw TValidationException("messages", "Field is missing");
+  }
+
+  if (messages.GetSize() > kMaxBatchSize) {
+    throw TValidationException("messages", fmt::format("Too many messages (max {})", kMaxBatchSize));
+  }
+
+  TSendBatchRequest request_dto{
+      .SenderId{}, .Items = messages.As<std::vector<TSendBatchItem>>(), .SentAt = start_timepoint};
+  request_dto.SenderId = TUserId{request_context.GetData<std::string>(ToString(EContextKey::UserId))};
+
+  auto result = MessageService_.SendBatch(std::move(request_dto));
+
+  for (const auto& item : result.Items) {
+    Stats_.successfull_sent.Add({item.SuccessfulSent});
+    Stats_.dropped_offline_total.Add({item.OfflineCount});
+    Stats_.forwarded_total.Add({item.ForwardedCount});
+    Stats_.dropped_overflow_total.Add({item.OverflowDropCount});
+  }
+
+  userver::formats::json::ValueBuilder builder;
+  builder["items"] = result.Items;
+
+  return builder.ExtractValue();
+}
+
+}  // namespace NChat::NInfra::NHandlers
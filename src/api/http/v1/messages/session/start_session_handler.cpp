@@ -44,6 +44,15 @@ userver::formats::json::Value TStartSessionHandler::HandleRequestJsonThrow(
     return builder.ExtractValue();
   } catch (const NCore::TSessionLimitExceeded& ex) {
     throw TTooManyRequestsException("Maximum number of active sessions exceeded");
+  } catch (const NApp::TNodeDraining& ex) {
+    // Узел останавливается: клиенты возвращаются вразнобой, каждый через свой Retry-After
+    const auto retry_after = std::max<std::int64_t>(
+        std::chrono::ceil<std::chrono::seconds>(ex.GetRetryAfter()).count(), 1);
+
+    auto& response = request.GetHttpResponse();
+    response.SetHeader(std::string_view{"Retry-After"}, std::to_string(retry_after));
+    response.SetStatus(userver::server::http::HttpStatus::kServiceUnavailable);
+    return MakeError(ex.what());
   } catch (const NApp::TSessionCreationUnavailable& ex) {
     auto& response = request.GetHttpResponse();
     response.SetStatus(userver::server::http::HttpStatus::kServiceUnavailable);
@@ -75,6 +75,9 @@ userver::formats::json::Value TUpdateByUsernameHandler::HandleRequestJsonThrow(
     throw TForbiddenException(ex.what());
   } catch (const NCore::NDomain::TUserAlreadyExistsException& ex) {
     throw TConflictException("user", ex.what());
+  } catch (const NCore::TAuthServiceOverloaded& ex) {
+    LOG_WARNING() << "Update user rejected: " << ex.what();
+    throw TTooManyRequestsException("Too many authentication requests, try again later");
   } catch (const NApp::TUpdateUserTemporaryUnavailable& ex) {
     LOG_ERROR() << "Update user unavailable: " << ex.what();
     throw TServerException("Update user temporary unavailable");
@@ -63,6 +63,9 @@ userver::formats::json::Value TLoginUserHandler::HandleRequestJsonThrow(
     result = UserService_.Login(user_login_data);
   } catch (const NCore::TValidationException& ex) {
     throw TUnauthorizedException("credentials", "Invalid credentials");
+  } catch (const NCore::TAuthServiceOverloaded& ex) {
+    LOG_WARNING() << "Login rejected: " << ex.what();
+    throw TTooManyRequestsException("Too many authentication requests, try again later");
   } catch (const NApp::TLoginTemporaryUnavailable& ex) {
     LOG_ERROR() << "Login unavailable: " << ex.what();
     throw TServerException("Login temporary unavailable");
@@ -78,6 +78,9 @@ userver::formats::json::Value TRegisterUserHandler::HandleRequestJsonThrow(
     throw TValidationException(ex.GetField(), ex.what());
   } catch (const NCore::NDomain::TUserAlreadyExistsException& ex) {
     throw TConflictException("user", ex.what());
+  } catch (const NCore::TAuthServiceOverloaded& ex) {
+    LOG_WARNING() << "Registration rejected: " << ex.what();
+    throw TTooManyRequestsException("Too many authentication requests, try again later");
   } catch (const NApp::TRegistrationTemporaryUnavailable& ex) {
     LOG_ERROR() << "Registration unavailable: " << ex.what();
     throw TServerException("Registration temporary unavailable");
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <core/common/ids.hpp>
+#include <core/messaging/message.hpp>
+#include <core/messaging/value/message_text.hpp>
+#include <core/users/user.hpp>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace NChat::NApp::NDto {
+
+struct TGetHistoryRequest {
+  NCore::NDomain::TUserId RequesterId;
+  NCore::NDomain::TChatId ChatId;
+  std::optional<NCore::NDomain::TMessageSeq> Before{};
+  std::size_t Limit = 50;
+};
+
+struct TGetHistoryResult {
+  struct TResultMessage {
+    NCore::NDomain::TMessageSeq Seq;
+    std::optional<NCore::NDomain::TUsername> Sender;  // nullopt, если отправитель удален
+    NCore::NDomain::TMessageText Text;
+    std::chrono::system_clock::time_point SentAt;
+  };
+
+  // По возрастанию Seq
+  std::vector<TResultMessage> Messages;
+  // Курсор следующей страницы, nullopt - история кончилась
+  std::optional<NCore::NDomain::TMessageSeq> NextBefore;
+};
+
+}  // namespace NChat::NApp::NDto
@@ -6,6 +6,8 @@
 #include <core/users/user.hpp>
 
 #include <chrono>
+#include <optional>
+#include <vector>
 
 namespace NChat::NApp::NDto {
 
@@ -26,9 +28,13 @@ struct TPollMessagesResult {
     NCore::NDomain::TUsername Sender;
     NCore::NDomain::TMessageText Text;
     NCore::NDomain::TDeliveryContext Context;
+    bool IsService = false;
   };
 
   std::vector<TResultMessage> Messages;
+
+  // Узел выводится из работы: открыть новую сессию через столько, скорее всего уже на другом узле
+  std::optional<std::chrono::milliseconds> ReconnectAfter;
 };
 
 }  // namespace NChat::NApp::NDto
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <core/common/ids.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace NChat::NApp::NDto {
+
+struct TSendBatchItem {
+  NCore::NDomain::TChatId ChatId;
+  std::string Text;
+};
+
+struct TSendBatchRequest {
+  NCore::NDomain::TUserId SenderId;
+  std::vector<TSendBatchItem> Items;
+  std::chrono::steady_clock::time_point SentAt{};
+};
+
+enum class ESendItemStatus { Accepted, InvalidPayload, RateLimited, UnknownChat, Forbidden, Overloaded };
+
+struct TSendBatchItemResult {
+  ESendItemStatus Status = ESendItemStatus::Accepted;
+  std::size_t SuccessfulSent = 0;
+  std::size_t OverflowDropCount = 0;
+  std::size_t OfflineCount = 0;
+  std::size_t ForwardedCount = 0;
+};
+
+struct TSendBatchResult {
+  std::vector<TSendBatchItemResult> Items;
+};
+
+}  // namespace NChat::NApp::NDto
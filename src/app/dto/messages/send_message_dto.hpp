@@ -3,6 +3,7 @@
 #include <core/common/ids.hpp>
 
 #include <chrono>
+#include <optional>
 #include <string>
 
 namespace NChat::NApp::NDto {
@@ -12,12 +13,17 @@ struct TSendMessageRequest {
   NCore::NDomain::TChatId ChatId;
   std::string Text;
   std::chrono::steady_clock::time_point SentAt{};
+  std::optional<std::string> IdempotencyKey{};
 };
 
 struct TSendMessageResult {
   std::size_t SuccessfulSent = 0;
   std::size_t OverflowDropCount = 0;
   std::size_t OfflineCount = 0;
+  std::size_t ForwardedCount = 0;
+  bool IsDuplicate = false;
+  // Принято в очередь доставки, счетчики выше не заполняются
+  bool IsQueued = false;
 };
 
 }  // namespace NChat::NApp::NDto
@@ -2,8 +2,10 @@
 
 namespace NChat::NApp::NServices {
 
-TChatService::TChatService(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo)
-    : PrivateChatUseCase_(chat_repo, user_repo) {
+TChatService::TChatService(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo,
+                           NCore::IMailboxRegistry* registry, NCore::IMessageBus* bus)
+    : Notifier_(registry ? std::make_optional<TServiceNotifier>(*registry, bus) : std::nullopt),
+      PrivateChatUseCase_(chat_repo, user_repo, Notifier_ ? &*Notifier_ : nullptr) {
 }
 
 NDto::TPrivateChatResult TChatService::GetOrCreatePrivateChat(const NDto::TPrivateChatRequest& request) {
@@ -2,19 +2,27 @@
 
 #include <core/chats/chat_repo.hpp>
 #include <core/common/ids.hpp>
+#include <core/messaging/bus/message_bus.hpp>
+#include <core/messaging/mailbox/mailbox_registry.hpp>
 
 #include <app/dto/chats/private_chat_dto.hpp>
+#include <app/services/message/service_notifier.hpp>
 #include <app/use-cases/chats/private/private_chat.hpp>
 
+#include <optional>
+
 namespace NChat::NApp::NServices {
 
 class TChatService {
  public:
-  TChatService(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo);
+  // registry может быть nullptr: изменения состава чатов не рассылаются служебными сообщениями
+  TChatService(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo,
+               NCore::IMailboxRegistry* registry = nullptr, NCore::IMessageBus* bus = nullptr);
 
   NDto::TPrivateChatResult GetOrCreatePrivateChat(const NDto::TPrivateChatRequest& request);
 
  private:
+  std::optional<TServiceNotifier> Notifier_;
   TPrivateChatUseCase PrivateChatUseCase_;
 };
 
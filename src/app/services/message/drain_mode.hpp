@@ -0,0 +1,20 @@
+#pragma once
+
+#include <chrono>
+
+namespace NChat::NApp {
+
+// Вывод узла из работы (остановка, деплой): новые сессии не создаются, поллеры отпускаются сразу
+// с подсказкой, когда переподключаться, вместо ожидания до конца long poll
+class IDrainMode {
+ public:
+  // Hot path
+  virtual bool IsDraining() const = 0;
+
+  // Через сколько клиенту переподключаться; у каждого вызова свой джиттер, чтобы переподключения не пришли разом
+  virtual std::chrono::milliseconds GetReconnectAfter() = 0;
+
+  virtual ~IDrainMode() = default;
+};
+
+}  // namespace NChat::NApp
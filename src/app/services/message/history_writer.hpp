@@ -0,0 +1,16 @@
+#pragma once
+
+#include <core/messaging/message.hpp>
+
+namespace NChat::NApp {
+
+// Запись истории сообщений с отложенной записью в БД: отправка не ждет базу
+class IHistoryWriter {
+ public:
+  // Не блокирует и не ходит в БД; false, если сообщение отброшено политикой переполнения
+  virtual bool Append(const NCore::NDomain::TMessage& message) = 0;
+
+  virtual ~IHistoryWriter() = default;
+};
+
+}  // namespace NChat::NApp
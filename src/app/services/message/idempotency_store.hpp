@@ -0,0 +1,27 @@
+#pragma once
+
+#include <core/common/ids.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+namespace NChat::NApp {
+
+enum class EIdempotencyKeyState {
+  New,        // ключ запомнен как ожидающий: отправка продолжается
+  Pending,    // запрос с этим ключом еще выполняется, его исход неизвестен
+  Completed,  // сообщение с этим ключом уже принято
+};
+
+class IIdempotencyStore {
+ public:
+  // Ключ, встреченный впервые в окне дедупликации, остается ожидающим до Complete или Forget
+  virtual EIdempotencyKeyState TryRemember(const NCore::NDomain::TUserId& sender_id, std::string_view key) = 0;
+  virtual void Complete(const NCore::NDomain::TUserId& sender_id, std::string_view key) = 0;
+  virtual void Forget(const NCore::NDomain::TUserId& sender_id, std::string_view key) = 0;
+  virtual void TraverseKeys() = 0;
+
+  virtual ~IIdempotencyStore() = default;
+};
+
+}  // namespace NChat::NApp
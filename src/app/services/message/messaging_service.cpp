@@ -2,16 +2,28 @@
 
 namespace NChat::NApp::NServices {
 TMessagingService::TMessagingService(NCore::IMailboxRegistry& registry, ISendLimiter& limiter,
-                                     NCore::IUserRepository& user_repo, NCore::IChatRepository& chat_repo)
-    : SendMessageUseCase_(registry, chat_repo, limiter),
-      PollMessagesUseCase_(registry, user_repo),
-      StartSessionUseCase_(registry) {
+                                     NCore::IUserRepository& user_repo, NCore::IChatRepository& chat_repo,
+                                     IIdempotencyStore& idempotency_store, IHistoryWriter& history_writer,
+                                     NCore::IRecentMessages& recent, NCore::IMessageHistoryRepository& history_repo,
+                                     NCore::IMessageBus& bus, NCore::IFanOutPipeline* pipeline,
+                                     ISendBackpressure* backpressure, IDrainMode* drain)
+    : SendMessageUseCase_(registry, chat_repo, limiter, idempotency_store, history_writer, recent, bus, pipeline,
+                          backpressure),
+      SendBatchUseCase_(registry, chat_repo, limiter, history_writer, recent, bus, pipeline, backpressure),
+      PollMessagesUseCase_(registry, user_repo, drain),
+      StartSessionUseCase_(registry, drain),
+      GetHistoryUseCase_(chat_repo, user_repo, recent, history_repo),
+      DeliverForwardedUseCase_(registry) {
 }
 
 NDto::TSendMessageResult TMessagingService::SendMessage(NDto::TSendMessageRequest request) {
   return SendMessageUseCase_.Execute(std::move(request));
 }
 
+NDto::TSendBatchResult TMessagingService::SendBatch(NDto::TSendBatchRequest request) {
+  return SendBatchUseCase_.Execute(std::move(request));
+}
+
 NDto::TStartSessionResult TMessagingService::StartSession(const NDto::TStartSessionRequest& request) {
   return StartSessionUseCase_.Execute(request);
 }
@@ -21,4 +33,12 @@ NDto::TPollMessagesResult TMessagingService::PollMessages(const NDto::TPollMessa
   return PollMessagesUseCase_.Execute(request, settings);
 }
 
+NDto::TGetHistoryResult TMessagingService::GetHistory(const NDto::TGetHistoryRequest& request) {
+  return GetHistoryUseCase_.Execute(request);
+}
+
+std::vector<NCore::TSendStatus> TMessagingService::DeliverForwarded(std::vector<NCore::TRouteTask> batch) {
+  return DeliverForwardedUseCase_.Execute(std::move(batch));
+}
+
 }  // namespace NChat::NApp::NServices
@@ -1,10 +1,20 @@
 #pragma once
 
+#include <core/messaging/bus/message_bus.hpp>
+#include <core/messaging/history/history_repo.hpp>
 #include <core/messaging/mailbox/mailbox_registry.hpp>
+#include <core/messaging/pipeline/fanout_pipeline.hpp>
 #include <core/users/user_repo.hpp>
 
+#include <app/services/message/drain_mode.hpp>
+#include <app/services/message/history_writer.hpp>
+#include <app/services/message/idempotency_store.hpp>
+#include <app/services/message/send_backpressure.hpp>
 #include <app/services/message/send_limiter.hpp>
+#include <app/use-cases/messages/deliver_forwarded/deliver_forwarded.hpp>
+#include <app/use-cases/messages/get_history/get_history.hpp>
 #include <app/use-cases/messages/poll_messages/poll_messages.hpp>
+#include <app/use-cases/messages/send_batch/send_batch.hpp>
 #include <app/use-cases/messages/send_message/send_message.hpp>
 #include <app/use-cases/messages/start_session/start_session.hpp>
 
@@ -13,17 +23,29 @@ namespace NChat::NApp::NServices {
 class TMessagingService {
  public:
   TMessagingService(NCore::IMailboxRegistry& registry, ISendLimiter& limiter, NCore::IUserRepository& user_repo,
-                    NCore::IChatRepository& chat_repo);
+                    NCore::IChatRepository& chat_repo, IIdempotencyStore& idempotency_store,
+                    IHistoryWriter& history_writer, NCore::IRecentMessages& recent,
+                    NCore::IMessageHistoryRepository& history_repo, NCore::IMessageBus& bus,
+                    NCore::IFanOutPipeline* pipeline = nullptr, ISendBackpressure* backpressure = nullptr,
+                    IDrainMode* drain = nullptr);
 
   NDto::TSendMessageResult SendMessage(NDto::TSendMessageRequest request);
+  NDto::TSendBatchResult SendBatch(NDto::TSendBatchRequest request);
 
   NDto::TStartSessionResult StartSession(const NDto::TStartSessionRequest& request);
   NDto::TPollMessagesResult PollMessages(const NDto::TPollMessagesRequest& request,
                                          const NDto::TPollMessagesSettings& settings);
+  NDto::TGetHistoryResult GetHistory(const NDto::TGetHistoryRequest& request);
+
+  // Входящая пачка от другого узла кластера
+  std::vector<NCore::TSendStatus> DeliverForwarded(std::vector<NCore::TRouteTask> batch);
 
  private:
   TSendMessageUseCase SendMessageUseCase_;
+  TSendBatchUseCase SendBatchUseCase_;
   TPollMessagesUseCase PollMessagesUseCase_;
   TStartSessionUseCase StartSessionUseCase_;
+  TGetHistoryUseCase GetHistoryUseCase_;
+  TDeliverForwardedUseCase DeliverForwardedUseCase_;
 };
 }  // namespace NChat::NApp::NServices
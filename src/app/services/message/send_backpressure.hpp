@@ -0,0 +1,24 @@
+#pragma once
+
+#include <core/common/ids.hpp>
+#include <core/messaging/bus/message_bus.hpp>
+
+#include <chrono>
+#include <optional>
+
+namespace NChat::NApp {
+
+// Медленные получатели тормозят тех, кто пишет в их чат, вместо молчаливой потери сообщений
+class ISendBackpressure {
+ public:
+  // Hot path: перед приемом сообщения в чат. Может притормозить отправителя;
+  // если вернулось значение, сообщение отклоняется и повторять стоит не раньше, чем через него
+  virtual std::optional<std::chrono::milliseconds> Admit(const NCore::NDomain::TChatId& chat_id) = 0;
+
+  // Итог маршрутизации сообщения чата: сколько очередей получателей насыщено
+  virtual void Report(const NCore::NDomain::TChatId& chat_id, const NCore::TSendStatus& status) = 0;
+
+  virtual ~ISendBackpressure() = default;
+};
+
+}  // namespace NChat::NApp
@@ -9,6 +9,8 @@ namespace NChat::NApp {
 class ISendLimiter {
  public:
   virtual bool TryAcquire(const NCore::NDomain::TUserId& user_id) = 0;
+  // Возвращает количество выданных токенов (от 0 до count)
+  virtual std::size_t TryAcquireN(const NCore::NDomain::TUserId& user_id, std::size_t count) = 0;
   virtual void TraverseLimiters() = 0;
   virtual std::int64_t GetTotalLimiters() const = 0;
 
@@ -0,0 +1,20 @@
+#include "service_notifier.hpp"
+
+#include <userver/utils/datetime_light.hpp>
+
+namespace NChat::NApp {
+
+TServiceNotifier::TServiceNotifier(NCore::IMailboxRegistry& registry, NCore::IMessageBus* bus)
+    : Router_(registry, nullptr, bus) {
+}
+
+NCore::TSendStatus TServiceNotifier::Notify(const TChatId& chat_id, const TUserId& author_id,
+                                            std::vector<TUserId> recipients, std::string_view notice) const {
+  auto message = NCore::NDomain::TMessage::Create(chat_id, author_id, NCore::NDomain::TMessageText(std::string(notice)),
+                                                  userver::utils::datetime::SteadyNow(),
+                                                  NCore::NDomain::EMessageClass::Service);
+
+  return Router_.Route(std::move(recipients), std::move(message));
+}
+
+}  // namespace NChat::NApp
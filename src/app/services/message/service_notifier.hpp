@@ -0,0 +1,31 @@
+#pragma once
+
+#include <core/messaging/bus/message_bus.hpp>
+#include <core/messaging/mailbox/mailbox_registry.hpp>
+#include <core/messaging/router/message_router.hpp>
+
+#include <string_view>
+
+namespace NChat::NApp {
+
+// Тексты служебных сообщений: клиент распознает их по полю service и коду в text
+inline constexpr std::string_view kChatCreatedNotice = "chat_created";
+
+// Служебные сообщения чата (смена состава, системные уведомления) идут в служебную лейну очередей получателей:
+// их не задерживают обычные сообщения. В историю они не пишутся, после resync клиент перечитывает состояние чата
+class TServiceNotifier final {
+ public:
+  using TUserId = NCore::NDomain::TUserId;
+  using TChatId = NCore::NDomain::TChatId;
+
+  // bus может быть nullptr: получатели на других узлах считаются офлайн
+  explicit TServiceNotifier(NCore::IMailboxRegistry& registry, NCore::IMessageBus* bus = nullptr);
+
+  NCore::TSendStatus Notify(const TChatId& chat_id, const TUserId& author_id, std::vector<TUserId> recipients,
+                            std::string_view notice) const;
+
+ private:
+  NCore::TMessageRouter Router_;
+};
+
+}  // namespace NChat::NApp
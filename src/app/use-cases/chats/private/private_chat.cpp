@@ -3,15 +3,15 @@
 #include <core/users/value/raw_password.hpp>
 #include <core/users/value/username.hpp>
 
-#include <utils/jwt/jwt.hpp>
 #include <utils/uuid/uuid_generator.hpp>
 
 #include <fmt/format.h>
 
 namespace NChat::NApp {
 
-TPrivateChatUseCase::TPrivateChatUseCase(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo)
-    : ChatRepo_(chat_repo), UserRepo_(user_repo) {
+TPrivateChatUseCase::TPrivateChatUseCase(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo,
+                                         const TServiceNotifier* notifier)
+    : ChatRepo_(chat_repo), UserRepo_(user_repo), Notifier_(notifier) {
 }
 
 NDto::TPrivateChatResult TPrivateChatUseCase::Execute(const NDto::TPrivateChatRequest& request) const {
@@ -23,6 +23,12 @@ NDto::TPrivateChatResult TPrivateChatUseCase::Execute(const NDto::TPrivateChatRe
 
   auto [chat_id, is_new] = ChatRepo_.SavePrivateChat({{request.RequesterUserId, target_user_id.value()}});
 
+  // Состав чата изменился: оба участника, включая другие сессии инициатора, получают служебное сообщение
+  if (is_new && Notifier_) {
+    Notifier_->Notify(chat_id, request.RequesterUserId, {request.RequesterUserId, target_user_id.value()},
+                      kChatCreatedNotice);
+  }
+
   return {.ChatId = chat_id, .IsNewChat = is_new};
 }
 
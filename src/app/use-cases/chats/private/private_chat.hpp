@@ -6,6 +6,7 @@
 
 #include <app/dto/chats/private_chat_dto.hpp>
 #include <app/exceptions.hpp>
+#include <app/services/message/service_notifier.hpp>
 
 namespace NChat::NApp {
 
@@ -15,13 +16,16 @@ class TUserNotFound : public TApplicationException {
 
 class TPrivateChatUseCase final {
  public:
-  TPrivateChatUseCase(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo);
+  // notifier может быть nullptr: участники нового чата узнают о нем только из списка чатов
+  TPrivateChatUseCase(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo,
+                      const TServiceNotifier* notifier = nullptr);
 
   NDto::TPrivateChatResult Execute(const NDto::TPrivateChatRequest& request) const;
 
  private:
   NCore::IChatRepository& ChatRepo_;
   NCore::IUserRepository& UserRepo_;
+  const TServiceNotifier* Notifier_;
 };
 
 }  // namespace NChat::NApp
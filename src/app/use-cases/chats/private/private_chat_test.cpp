@@ -1,5 +1,7 @@
 #include "private_chat.hpp"
 
+#include <core/messaging/mocks.hpp>
+
 #include <app/use-cases/mocks/chat_repo_mock.hpp>
 #include <app/use-cases/mocks/user_repo_mock.hpp>
 
@@ -182,3 +184,41 @@ TEST_F(PrivateChatUseCaseIntegrationTest, MultipleCallsSamePair_ReturnsExistingC
   EXPECT_FALSE(result2.IsNewChat);
   EXPECT_EQ(result2.ChatId, result1.ChatId);
 }
+
+// Новый чат - смена состава: оба участника получают служебное сообщение
+TEST_F(PrivateChatUseCaseIntegrationTest, NewChatNotifiesMembers) {
+  NiceMock<MockMailboxRegistry> registry;
+  MockMessageBus bus;
+  TServiceNotifier notifier(registry, &bus);
+  TPrivateChatUseCase use_case(*ChatRepo_, *UserRepo_, &notifier);
+
+  EXPECT_CALL(*UserRepo_, FindByUsername(kTargetUsername)).WillOnce(Return(kTargetUserId));
+  EXPECT_CALL(*ChatRepo_, SavePrivateChat(TPrivateChat{{kRequesterUserId, kTargetUserId}}))
+      .WillOnce(Return(std::make_pair(kNewChatId, true)));
+
+  // Локальных почтовых ящиков нет: оба участника уходят в шину
+  EXPECT_CALL(bus, Forward(_)).WillOnce([this](std::vector<TRouteTask> batch) {
+    EXPECT_EQ(batch.size(), 1);
+    EXPECT_THAT(batch[0].Recipients, UnorderedElementsAre(kRequesterUserId, kTargetUserId));
+    EXPECT_EQ(batch[0].Message.Class, EMessageClass::Service);
+    EXPECT_EQ(batch[0].Message.ChatId, kNewChatId);
+    EXPECT_EQ(batch[0].Message.Payload->Text.Value(), kChatCreatedNotice);
+    return std::vector<TSendStatus>{{.Forwarded = 2}};
+  });
+
+  use_case.Execute({.RequesterUserId = kRequesterUserId, .TargetUsername = kTargetUsername});
+}
+
+// Существующий чат не меняет состав и не рассылает служебных сообщений
+TEST_F(PrivateChatUseCaseIntegrationTest, ExistingChatNotNotified) {
+  NiceMock<MockMailboxRegistry> registry;
+  StrictMock<MockMessageBus> bus;
+  TServiceNotifier notifier(registry, &bus);
+  TPrivateChatUseCase use_case(*ChatRepo_, *UserRepo_, &notifier);
+
+  EXPECT_CALL(*UserRepo_, FindByUsername(kTargetUsername)).WillOnce(Return(kTargetUserId));
+  EXPECT_CALL(*ChatRepo_, SavePrivateChat(_)).WillOnce(Return(std::make_pair(kExistingChatId, false)));
+  EXPECT_CALL(registry, GetMailbox(_)).Times(0);
+
+  use_case.Execute({.RequesterUserId = kRequesterUserId, .TargetUsername = kTargetUsername});
+}
@@ -0,0 +1,12 @@
+#include "deliver_forwarded.hpp"
+
+namespace NChat::NApp {
+
+TDeliverForwardedUseCase::TDeliverForwardedUseCase(NCore::IMailboxRegistry& registry) : Router_(registry) {
+}
+
+std::vector<NCore::TSendStatus> TDeliverForwardedUseCase::Execute(std::vector<NCore::TRouteTask> batch) {
+  return Router_.RouteBatch(std::move(batch));
+}
+
+}  // namespace NChat::NApp
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <core/messaging/mailbox/mailbox_registry.hpp>
+#include <core/messaging/router/message_router.hpp>
+
+namespace NChat::NApp {
+
+// Прием пачки, пересланной другим узлом: доставка только в локальные почтовые ящики.
+// Шина и горячий хвост не участвуют - сообщение уже запомнено и отправлено в историю на узле отправителя
+class TDeliverForwardedUseCase final {
+ public:
+  explicit TDeliverForwardedUseCase(NCore::IMailboxRegistry& registry);
+
+  std::vector<NCore::TSendStatus> Execute(std::vector<NCore::TRouteTask> batch);
+
+ private:
+  NCore::TMessageRouter Router_;
+};
+
+}  // namespace NChat::NApp
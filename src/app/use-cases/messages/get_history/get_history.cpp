@@ -0,0 +1,54 @@
+#include "get_history.hpp"
+
+#include <fmt/format.h>
+
+namespace NChat::NApp {
+
+TGetHistoryUseCase::TGetHistoryUseCase(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo,
+                                       NCore::IRecentMessages& recent,
+                                       NCore::IMessageHistoryRepository& history_repo)
+    : ChatRepo_(chat_repo), UserRepo_(user_repo), Recent_(recent), HistoryRepo_(history_repo) {
+}
+
+NDto::TGetHistoryResult TGetHistoryUseCase::Execute(const NDto::TGetHistoryRequest& request) {
+  // Читать историю может любой участник, неизвестный чат неотличим от чужого
+  const auto roles = ChatRepo_.GetMemberRoles(request.ChatId, {request.RequesterId});
+  if (!roles.contains(request.RequesterId)) {
+    throw THistoryForbidden(fmt::format("User {} can't read chat {}", request.RequesterId, request.ChatId));
+  }
+
+  // Ресинк после переполнения обычно просит последнюю страницу, она почти всегда в горячем хвосте
+  auto page = Recent_.GetPage(request.ChatId, request.Before, request.Limit);
+  if (!page) {
+    page = HistoryRepo_.GetPage(request.ChatId, request.Before, request.Limit);
+  }
+
+  // В странице обычно несколько отправителей на много сообщений: профили резолвятся одной пачкой
+  std::vector<NCore::NDomain::TUserId> sender_ids;
+  sender_ids.reserve(page->size());
+  for (const auto& message : *page) {
+    sender_ids.push_back(message.Payload->Sender);
+  }
+  const auto profiles = UserRepo_.GetProfilesByIds(sender_ids);
+
+  NDto::TGetHistoryResult result;
+  result.Messages.reserve(page->size());
+
+  for (const auto& message : *page) {
+    std::optional<NCore::NDomain::TUsername> sender;
+    if (auto it = profiles.find(message.Payload->Sender); it != profiles.end()) {
+      sender.emplace(it->second.Username);
+    }
+
+    result.Messages.push_back(
+        {.Seq = message.Seq, .Sender = std::move(sender), .Text = message.Payload->Text, .SentAt = message.SentAt});
+  }
+
+  if (!page->empty() && page->size() == request.Limit) {
+    result.NextBefore = page->front().Seq;
+  }
+
+  return result;
+}
+
+}  // namespace NChat::NApp
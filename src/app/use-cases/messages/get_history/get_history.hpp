@@ -0,0 +1,30 @@
+#pragma once
+
+#include <core/chats/chat_repo.hpp>
+#include <core/messaging/history/history_repo.hpp>
+#include <core/users/user_repo.hpp>
+
+#include <app/dto/messages/get_history_dto.hpp>
+#include <app/exceptions.hpp>
+
+namespace NChat::NApp {
+
+class THistoryForbidden : public TApplicationException {
+  using TApplicationException::TApplicationException;
+};
+
+class TGetHistoryUseCase final {
+ public:
+  TGetHistoryUseCase(NCore::IChatRepository& chat_repo, NCore::IUserRepository& user_repo,
+                     NCore::IRecentMessages& recent, NCore::IMessageHistoryRepository& history_repo);
+
+  NDto::TGetHistoryResult Execute(const NDto::TGetHistoryRequest& request);
+
+ private:
+  NCore::IChatRepository& ChatRepo_;
+  NCore::IUserRepository& UserRepo_;
+  NCore::IRecentMessages& Recent_;
+  NCore::IMessageHistoryRepository& HistoryRepo_;
+};
+
+}  // namespace NChat::NApp
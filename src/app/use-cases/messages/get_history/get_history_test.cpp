@@ -0,0 +1,106 @@
+#include "get_history.hpp"
+
+#include <core/messaging/mocks.hpp>
+
+#include <app/use-cases/mocks/chat_repo_mock.hpp>
+#include <app/use-cases/mocks/user_repo_mock.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace NChat::NCore;
+using namespace NChat::NCore::NDomain;
+using namespace NChat::NApp;
+
+class GetHistoryUseCaseTest : public Test {
+ protected:
+  void SetUp() override {
+    UseCase_ = std::make_unique<TGetHistoryUseCase>(ChatRepo_, UserRepo_, Recent_, HistoryRepo_);
+
+    ON_CALL(UserRepo_, GetProfilesByIds(_))
+        .WillByDefault(Return(std::unordered_map<TUserId, TUserTinyProfile>{
+            {kSenderId, TUserTinyProfile{.Id = kSenderId, .Username = "sender", .DisplayName = "Sender"}}}));
+  }
+
+  void AllowReader() {
+    EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _))
+        .WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{{kReaderId, EMemberRole::Reader}}));
+  }
+
+  std::vector<THistoryMessage> MakePage(std::vector<TMessageSeq> seqs) const {
+    std::vector<THistoryMessage> page;
+    for (auto seq : seqs) {
+      page.push_back({.Seq = seq,
+                      .Payload = std::make_shared<TMessagePayload>(kSenderId, TMessageText{"text"}),
+                      .SentAt = {}});
+    }
+    return page;
+  }
+
+  TMockChatRepository ChatRepo_;
+  NiceMock<TMockUserRepository> UserRepo_;
+  StrictMock<MockRecentMessages> Recent_;
+  StrictMock<MockMessageHistoryRepository> HistoryRepo_;
+  std::unique_ptr<TGetHistoryUseCase> UseCase_;
+
+  const TUserId kSenderId{"sender"};
+  const TUserId kReaderId{"reader"};
+  const TChatId kChatId{"pc:chat"};
+};
+
+// Горячий хвост отвечает без запроса в БД
+TEST_F(GetHistoryUseCaseTest, ServedFromHotTail) {
+  AllowReader();
+  EXPECT_CALL(Recent_, GetPage(kChatId, std::optional<TMessageSeq>{}, 2)).WillOnce(Return(MakePage({4, 5})));
+
+  auto result = UseCase_->Execute({.RequesterId = kReaderId, .ChatId = kChatId, .Limit = 2});
+
+  ASSERT_EQ(result.Messages.size(), 2);
+  EXPECT_EQ(result.Messages[0].Seq, 4);
+  EXPECT_EQ(result.Messages[0].Sender->Value(), "sender");
+  EXPECT_EQ(result.NextBefore, 4);
+}
+
+// Хвоста не хватило: страница читается из БД, короткая страница значит конец истории
+TEST_F(GetHistoryUseCaseTest, FallsBackToRepository) {
+  AllowReader();
+  EXPECT_CALL(Recent_, GetPage(kChatId, std::optional<TMessageSeq>{4}, 3)).WillOnce(Return(std::nullopt));
+  EXPECT_CALL(HistoryRepo_, GetPage(kChatId, std::optional<TMessageSeq>{4}, 3)).WillOnce(Return(MakePage({1, 2})));
+
+  auto result = UseCase_->Execute({.RequesterId = kReaderId, .ChatId = kChatId, .Before = 4, .Limit = 3});
+
+  ASSERT_EQ(result.Messages.size(), 2);
+  EXPECT_FALSE(result.NextBefore.has_value());
+}
+
+TEST_F(GetHistoryUseCaseTest, ForbiddenForNonMember) {
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _)).WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{}));
+
+  EXPECT_THROW(UseCase_->Execute({.RequesterId = kReaderId, .ChatId = kChatId, .Limit = 2}), THistoryForbidden);
+}
+
+// Удаленный отправитель не прячет сообщение, только его имя
+TEST_F(GetHistoryUseCaseTest, DeletedSenderKeepsMessage) {
+  AllowReader();
+  EXPECT_CALL(Recent_, GetPage(kChatId, _, 1)).WillOnce(Return(MakePage({7})));
+  EXPECT_CALL(UserRepo_, GetProfilesByIds(ElementsAre(kSenderId)))
+      .WillOnce(Return(std::unordered_map<TUserId, TUserTinyProfile>{}));
+
+  auto result = UseCase_->Execute({.RequesterId = kReaderId, .ChatId = kChatId, .Limit = 1});
+
+  ASSERT_EQ(result.Messages.size(), 1);
+  EXPECT_FALSE(result.Messages[0].Sender.has_value());
+}
+
+// Отправители страницы резолвятся одним запросом, а не по одному на сообщение
+TEST_F(GetHistoryUseCaseTest, SendersResolvedInOneBatch) {
+  AllowReader();
+  EXPECT_CALL(Recent_, GetPage(kChatId, _, 3)).WillOnce(Return(MakePage({1, 2, 3})));
+  EXPECT_CALL(UserRepo_, GetProfilesByIds(SizeIs(3))).Times(1);
+  EXPECT_CALL(UserRepo_, GetProfileById(_)).Times(0);
+
+  auto result = UseCase_->Execute({.RequesterId = kReaderId, .ChatId = kChatId, .Limit = 3});
+
+  ASSERT_EQ(result.Messages.size(), 3);
+  EXPECT_EQ(result.Messages[2].Sender->Value(), "sender");
+}
@@ -2,8 +2,9 @@
 
 namespace NChat::NApp {
 
-TPollMessagesUseCase::TPollMessagesUseCase(NCore::IMailboxRegistry& registry, NCore::IUserRepository& user_repo)
-    : Registry_(registry), UserRepo_(user_repo) {
+TPollMessagesUseCase::TPollMessagesUseCase(NCore::IMailboxRegistry& registry, NCore::IUserRepository& user_repo,
+                                           IDrainMode* drain)
+    : Registry_(registry), UserRepo_(user_repo), Drain_(drain) {
 }
 
 NDto::TPollMessagesResult TPollMessagesUseCase::Execute(const NDto::TPollMessagesRequest& request,
@@ -14,12 +15,25 @@ NDto::TPollMessagesResult TPollMessagesUseCase::Execute(const NDto::TPollMessage
     throw TMailboxNotFound(fmt::format("Session for your user not found"));
   }
 
-  auto messages = mailbox->PollMessages(request.SessionId, settings.MaxSize, settings.PollTime);
+  // Узел выводится из работы: отдаем то, что уже в очереди, не дожидаясь новых сообщений
+  const auto poll_time = Drain_ && Drain_->IsDraining() ? std::chrono::seconds{0} : settings.PollTime;
+  auto messages = mailbox->PollMessages(request.SessionId, settings.MaxSize, poll_time);
 
   NDto::TPollMessagesResult result;
   result.ResyncRequired = messages.ResyncRequired;
 
+  // Проверяем и после ожидания: вывод из работы будит поллера сообщением Wakeup
+  if (Drain_ && Drain_->IsDraining()) {
+    // Почтовый ящик исчезнет вместе с узлом: недочитанное клиент заберет из истории, куда оно уже записано
+    result.ResyncRequired = true;
+    result.ReconnectAfter = Drain_->GetReconnectAfter();
+  }
+
   for (auto& message : messages.Messages) {
+    if (message.Class == NCore::NDomain::EMessageClass::Wakeup) {
+      continue;
+    }
+
     std::optional<NCore::NDomain::TUserTinyProfile> profile;
 
     if (!message.Payload) {
@@ -42,7 +56,7 @@ NDto::TPollMessagesResult TPollMessagesUseCase::Execute(const NDto::TPollMessage
     }
 
     result.Messages.emplace_back(NCore::NDomain::TUsername(profile->Username), std::move(message.Payload->Text),
-                                 message.Context);
+                                 message.Context, message.Class == NCore::NDomain::EMessageClass::Service);
   }
 
   return result;
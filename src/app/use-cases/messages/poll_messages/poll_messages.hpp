@@ -5,6 +5,7 @@
 
 #include <app/dto/messages/poll_messages_dto.hpp>
 #include <app/exceptions.hpp>
+#include <app/services/message/drain_mode.hpp>
 #include <app/services/message/send_limiter.hpp>
 
 namespace NChat::NApp {
@@ -20,7 +21,9 @@ class TPollMessagesUseCase final {
   using TUserId = NCore::NDomain::TUserId;
   using TMessageText = NCore::NDomain::TMessageText;
 
-  TPollMessagesUseCase(NCore::IMailboxRegistry& registry, NCore::IUserRepository& user_repo);
+  // drain может быть nullptr: поллеры ждут до конца long poll и при остановке узла
+  TPollMessagesUseCase(NCore::IMailboxRegistry& registry, NCore::IUserRepository& user_repo,
+                       IDrainMode* drain = nullptr);
 
   NDto::TPollMessagesResult Execute(const NDto::TPollMessagesRequest& request,
                                     const NDto::TPollMessagesSettings& settings);
@@ -28,6 +31,7 @@ class TPollMessagesUseCase final {
  private:
   NCore::IMailboxRegistry& Registry_;
   NCore::IUserRepository& UserRepo_;
+  IDrainMode* Drain_;
 };
 
 }  // namespace NChat::NApp
@@ -0,0 +1,137 @@
+#include "send_batch.hpp"
+
+#include <optional>
+#include <unordered_map>
+
+namespace NChat::NApp {
+
+using NDto::ESendItemStatus;
+
+TSendBatchUseCase::TSendBatchUseCase(NCore::IMailboxRegistry& registry, NCore::IChatRepository& chat_repo,
+                                     ISendLimiter& limiter, IHistoryWriter& history_writer,
+                                     NCore::IRecentMessages& recent, NCore::IMessageBus& bus,
+                                     NCore::IFanOutPipeline* pipeline, ISendBackpressure* backpressure)
+    : Router_(registry, &recent, &bus),
+      ChatRepo_(chat_repo),
+      Limiter_(limiter),
+      HistoryWriter_(history_writer),
+      Pipeline_(pipeline),
+      Backpressure_(backpressure) {
+}
+
+NDto::TSendBatchResult TSendBatchUseCase::Execute(NDto::TSendBatchRequest request) {
+  NDto::TSendBatchResult result;
+  result.Items.resize(request.Items.size());
+
+  // Невалидный текст не должен расходовать токены
+  std::vector<std::optional<TMessageText>> texts(request.Items.size());
+
+  for (std::size_t i = 0; i < request.Items.size(); ++i) {
+    try {
+      texts[i].emplace(std::move(request.Items[i].Text));
+    } catch (const NCore::NDomain::TMessageTextInvalidException&) {
+      result.Items[i].Status = ESendItemStatus::InvalidPayload;
+    }
+  }
+
+  // Токены берутся только под сообщения, которые отправитель вправе послать: отказ не расходует лимит
+  std::unordered_map<TChatId, TChatAccess> chats;
+  std::size_t authorized_amount = 0;
+
+  for (std::size_t i = 0; i < request.Items.size(); ++i) {
+    if (!texts[i]) {
+      continue;
+    }
+
+    const auto& chat_id = request.Items[i].ChatId;
+    auto chat_it = chats.find(chat_id);
+    if (chat_it == chats.end()) {
+      auto access = Authorize(chat_id, request.SenderId);
+      // Насыщенный чат отклоняется целиком; посторонний отправитель не тормозится и не влияет на решение
+      if (access.Status == ESendItemStatus::Accepted && Backpressure_ && Backpressure_->Admit(chat_id)) {
+        access = {.Status = ESendItemStatus::Overloaded};
+      }
+      chat_it = chats.emplace(chat_id, std::move(access)).first;
+    }
+
+    if (chat_it->second.Status != ESendItemStatus::Accepted) {
+      result.Items[i].Status = chat_it->second.Status;
+      texts[i].reset();
+      continue;
+    }
+    ++authorized_amount;
+  }
+
+  std::size_t granted = authorized_amount > 0 ? Limiter_.TryAcquireN(request.SenderId, authorized_amount) : 0;
+
+  std::vector<NCore::TRouteTask> batch;
+  std::vector<std::size_t> batch_positions;
+  batch.reserve(granted);
+  batch_positions.reserve(granted);
+
+  for (std::size_t i = 0; i < request.Items.size(); ++i) {
+    if (!texts[i]) {
+      continue;
+    }
+
+    if (granted == 0) {
+      result.Items[i].Status = ESendItemStatus::RateLimited;
+      continue;
+    }
+    --granted;
+
+    const auto& chat_id = request.Items[i].ChatId;
+    const auto& access = chats.at(chat_id);
+
+    auto message = TMessage::Create(chat_id, request.SenderId, std::move(*texts[i]), request.SentAt);
+
+    if (Pipeline_) {
+      // Очередь чата одна и та же для всех его сообщений в пачке, порядок внутри чата сохраняется
+      if (!Pipeline_->Submit({access.Recipients, message})) {
+        result.Items[i].Status = ESendItemStatus::Overloaded;
+        continue;
+      }
+
+      HistoryWriter_.Append(message);
+      continue;
+    }
+
+    HistoryWriter_.Append(message);
+    batch.push_back({access.Recipients, std::move(message)});
+    batch_positions.push_back(i);
+  }
+
+  auto statuses = Router_.RouteBatch(std::move(batch));
+
+  for (std::size_t i = 0; i < statuses.size(); ++i) {
+    auto& item = result.Items[batch_positions[i]];
+    item.SuccessfulSent = statuses[i].Successful;
+    item.OverflowDropCount = statuses[i].Dropped;
+    item.OfflineCount = statuses[i].Offline;
+    item.ForwardedCount = statuses[i].Forwarded;
+
+    if (Backpressure_) {
+      Backpressure_->Report(request.Items[batch_positions[i]].ChatId, statuses[i]);
+    }
+  }
+
+  return result;
+}
+
+TSendBatchUseCase::TChatAccess TSendBatchUseCase::Authorize(const TChatId& chat_id, const TUserId& sender_id) const {
+  auto chat = ChatRepo_.GetChat(chat_id);
+  if (!chat) {
+    return {.Status = ESendItemStatus::UnknownChat};
+  }
+
+  const auto roles = ChatRepo_.GetMemberRoles(chat->GetId(), {sender_id});
+  const auto sender_role_it = roles.find(sender_id);
+
+  if (sender_role_it == roles.end() || !chat->CanPost(sender_role_it->second)) {
+    return {.Status = ESendItemStatus::Forbidden};
+  }
+
+  return {.Recipients = chat->GetRecipients(sender_id)};
+}
+
+}  // namespace NChat::NApp
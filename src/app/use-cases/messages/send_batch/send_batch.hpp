@@ -0,0 +1,50 @@
+#pragma once
+
+#include <core/chats/chat_repo.hpp>
+#include <core/messaging/bus/message_bus.hpp>
+#include <core/messaging/mailbox/mailbox_registry.hpp>
+#include <core/messaging/pipeline/fanout_pipeline.hpp>
+#include <core/messaging/router/message_router.hpp>
+
+#include <app/dto/messages/send_batch_dto.hpp>
+#include <app/exceptions.hpp>
+#include <app/services/message/history_writer.hpp>
+#include <app/services/message/send_backpressure.hpp>
+#include <app/services/message/send_limiter.hpp>
+
+namespace NChat::NApp {
+
+// Пакетная отправка: авторизация один раз на чат, токены лимитера пачкой, маршрутизация за один проход
+class TSendBatchUseCase final {
+ public:
+  using TMessage = NCore::NDomain::TMessage;
+  using TUserId = NCore::NDomain::TUserId;
+  using TChatId = NCore::NDomain::TChatId;
+  using TMessageText = NCore::NDomain::TMessageText;
+
+  // pipeline может быть nullptr: маршрутизация синхронно в корутине запроса
+  // backpressure может быть nullptr: заполненность очередей получателей не влияет на прием
+  TSendBatchUseCase(NCore::IMailboxRegistry& registry, NCore::IChatRepository& chat_repo, ISendLimiter& limiter,
+                    IHistoryWriter& history_writer, NCore::IRecentMessages& recent, NCore::IMessageBus& bus,
+                    NCore::IFanOutPipeline* pipeline = nullptr, ISendBackpressure* backpressure = nullptr);
+
+  NDto::TSendBatchResult Execute(NDto::TSendBatchRequest request);
+
+ private:
+  struct TChatAccess {
+    NDto::ESendItemStatus Status = NDto::ESendItemStatus::Accepted;
+    std::vector<TUserId> Recipients;
+  };
+
+  TChatAccess Authorize(const TChatId& chat_id, const TUserId& sender_id) const;
+
+ private:
+  NCore::TMessageRouter Router_;
+  NCore::IChatRepository& ChatRepo_;
+  ISendLimiter& Limiter_;
+  IHistoryWriter& HistoryWriter_;
+  NCore::IFanOutPipeline* Pipeline_;
+  ISendBackpressure* Backpressure_;
+};
+
+}  // namespace NChat::NApp
@@ -0,0 +1,186 @@
+#include "send_batch.hpp"
+
+#include <core/chats/private/private_chat.hpp>
+#include <core/messaging/mocks.hpp>
+
+#include <app/use-cases/mocks/chat_repo_mock.hpp>
+#include <app/use-cases/mocks/history_writer_mock.hpp>
+#include <app/use-cases/mocks/send_backpressure_mock.hpp>
+#include <app/use-cases/mocks/send_limiter_mock.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace NChat::NCore;
+using namespace NChat::NCore::NDomain;
+using namespace NChat::NApp;
+using NChat::NApp::NDto::ESendItemStatus;
+
+class SendBatchUseCaseTest : public Test {
+ protected:
+  void SetUp() override {
+    // Других узлов нет: все, кого нет в локальном реестре, офлайн
+    ON_CALL(Bus_, Forward(_)).WillByDefault([](std::vector<TRouteTask> batch) {
+      std::vector<TSendStatus> statuses;
+      for (const auto& task : batch) {
+        statuses.push_back({.Offline = task.Recipients.size()});
+      }
+      return statuses;
+    });
+
+    UseCase_ = std::make_unique<TSendBatchUseCase>(Registry_, ChatRepo_, Limiter_, HistoryWriter_, Recent_, Bus_);
+  }
+
+  std::unique_ptr<IChat> MakeChat() const {
+    return std::make_unique<TPrivateChat>(std::vector<TUserId>{kSenderId, kRecipientId});
+  }
+
+  NDto::TSendBatchRequest MakeRequest(std::vector<NDto::TSendBatchItem> items) const {
+    return {.SenderId = kSenderId, .Items = std::move(items)};
+  }
+
+  NiceMock<MockMailboxRegistry> Registry_;
+  TMockChatRepository ChatRepo_;
+  TMockSendLimiter Limiter_;
+  NiceMock<TMockHistoryWriter> HistoryWriter_;
+  NiceMock<MockRecentMessages> Recent_;
+  NiceMock<MockMessageBus> Bus_;
+  std::unique_ptr<TSendBatchUseCase> UseCase_;
+
+  const TUserId kSenderId{"sender"};
+  const TUserId kRecipientId{"recipient"};
+  const TChatId kChatId = TPrivateChat({kSenderId, kRecipientId}).GetId();
+  const TChatId kUnknownChatId{"pc:unknown"};
+};
+
+// Чат авторизуется один раз на весь батч
+TEST_F(SendBatchUseCaseTest, AuthorizeOncePerChat) {
+  EXPECT_CALL(Limiter_, TryAcquireN(kSenderId, 3)).WillOnce(Return(3));
+  EXPECT_CALL(ChatRepo_, GetChat(kChatId)).WillOnce(Return(ByMove(MakeChat())));
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _))
+      .WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{{kSenderId, EMemberRole::Writer}}));
+
+  auto result = UseCase_->Execute(MakeRequest({{kChatId, "one"}, {kChatId, "two"}, {kChatId, "three"}}));
+
+  ASSERT_EQ(result.Items.size(), 3);
+  for (const auto& item : result.Items) {
+    EXPECT_EQ(item.Status, ESendItemStatus::Accepted);
+    // Личный чат доставляет и в другие сессии отправителя, в реестре нет ни одного из двух
+    EXPECT_EQ(item.OfflineCount, 2);
+  }
+}
+
+// Токенов меньше, чем сообщений: хвост батча отклоняется
+TEST_F(SendBatchUseCaseTest, PartiallyRateLimited) {
+  EXPECT_CALL(Limiter_, TryAcquireN(kSenderId, 3)).WillOnce(Return(1));
+  EXPECT_CALL(ChatRepo_, GetChat(kChatId)).WillOnce(Return(ByMove(MakeChat())));
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _))
+      .WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{{kSenderId, EMemberRole::Writer}}));
+
+  auto result = UseCase_->Execute(MakeRequest({{kChatId, "one"}, {kChatId, "two"}, {kChatId, "three"}}));
+
+  EXPECT_EQ(result.Items[0].Status, ESendItemStatus::Accepted);
+  EXPECT_EQ(result.Items[1].Status, ESendItemStatus::RateLimited);
+  EXPECT_EQ(result.Items[2].Status, ESendItemStatus::RateLimited);
+}
+
+// Невалидный текст и отказ в доступе не расходуют токены, статус у каждого элемента свой
+TEST_F(SendBatchUseCaseTest, MixedStatuses) {
+  EXPECT_CALL(Limiter_, TryAcquireN(_, _)).Times(0);
+  EXPECT_CALL(ChatRepo_, GetChat(kUnknownChatId)).WillOnce(Return(ByMove(nullptr)));
+  EXPECT_CALL(ChatRepo_, GetChat(kChatId)).WillOnce(Return(ByMove(MakeChat())));
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _)).WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{}));
+
+  auto result = UseCase_->Execute(MakeRequest({{kUnknownChatId, "one"}, {kChatId, "   "}, {kChatId, "three"}}));
+
+  EXPECT_EQ(result.Items[0].Status, ESendItemStatus::UnknownChat);
+  EXPECT_EQ(result.Items[1].Status, ESendItemStatus::InvalidPayload);
+  EXPECT_EQ(result.Items[2].Status, ESendItemStatus::Forbidden);
+}
+
+// Лимитер спрашивается только о сообщениях в чаты, куда отправитель вправе писать
+TEST_F(SendBatchUseCaseTest, TokensOnlyForAuthorizedItems) {
+  EXPECT_CALL(ChatRepo_, GetChat(kUnknownChatId)).WillOnce(Return(ByMove(nullptr)));
+  EXPECT_CALL(ChatRepo_, GetChat(kChatId)).WillOnce(Return(ByMove(MakeChat())));
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _))
+      .WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{{kSenderId, EMemberRole::Writer}}));
+  EXPECT_CALL(Limiter_, TryAcquireN(kSenderId, 2)).WillOnce(Return(1));
+
+  auto result = UseCase_->Execute(MakeRequest({{kUnknownChatId, "one"}, {kChatId, "two"}, {kChatId, "three"}}));
+
+  EXPECT_EQ(result.Items[0].Status, ESendItemStatus::UnknownChat);
+  EXPECT_EQ(result.Items[1].Status, ESendItemStatus::Accepted);
+  EXPECT_EQ(result.Items[2].Status, ESendItemStatus::RateLimited);
+}
+
+// В историю пишутся только принятые сообщения, и без ожидания базы
+TEST_F(SendBatchUseCaseTest, OnlyAcceptedAppendedToHistory) {
+  EXPECT_CALL(Limiter_, TryAcquireN(kSenderId, 3)).WillOnce(Return(2));
+  EXPECT_CALL(ChatRepo_, GetChat(kChatId)).WillOnce(Return(ByMove(MakeChat())));
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _))
+      .WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{{kSenderId, EMemberRole::Writer}}));
+  EXPECT_CALL(HistoryWriter_, Append(Field(&TMessage::ChatId, kChatId))).Times(2).WillRepeatedly(Return(true));
+
+  auto result = UseCase_->Execute(MakeRequest({{kChatId, "one"}, {kChatId, "two"}, {kChatId, "three"}}));
+
+  EXPECT_EQ(result.Items[2].Status, ESendItemStatus::RateLimited);
+}
+
+// С конвейером доставки пачка только ставится в очереди чатов, маршрутизирует воркер
+TEST_F(SendBatchUseCaseTest, SubmittedToPipelineInOrder) {
+  StrictMock<MockFanOutPipeline> pipeline;
+  TSendBatchUseCase use_case(Registry_, ChatRepo_, Limiter_, HistoryWriter_, Recent_, Bus_, &pipeline);
+
+  EXPECT_CALL(Limiter_, TryAcquireN(kSenderId, 3)).WillOnce(Return(3));
+  EXPECT_CALL(ChatRepo_, GetChat(kChatId)).WillOnce(Return(ByMove(MakeChat())));
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _))
+      .WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{{kSenderId, EMemberRole::Writer}}));
+  EXPECT_CALL(Bus_, Forward(_)).Times(0);
+
+  std::vector<std::string> submitted;
+  EXPECT_CALL(pipeline, Submit(_)).Times(3).WillRepeatedly([&submitted](TRouteTask task) {
+    submitted.push_back(task.Message.Payload->Text.Value());
+    return submitted.size() != 2;
+  });
+  EXPECT_CALL(HistoryWriter_, Append(_)).Times(2).WillRepeatedly(Return(true));
+
+  auto result = use_case.Execute(MakeRequest({{kChatId, "one"}, {kChatId, "two"}, {kChatId, "three"}}));
+
+  EXPECT_THAT(submitted, ElementsAre("one", "two", "three"));
+  EXPECT_EQ(result.Items[0].Status, ESendItemStatus::Accepted);
+  EXPECT_EQ(result.Items[1].Status, ESendItemStatus::Overloaded);
+  EXPECT_EQ(result.Items[2].Status, ESendItemStatus::Accepted);
+}
+
+// Насыщенный чат отклоняется целиком и не расходует токены
+TEST_F(SendBatchUseCaseTest, OverloadedChatNotCharged) {
+  NiceMock<TMockSendBackpressure> backpressure;
+  TSendBatchUseCase use_case(Registry_, ChatRepo_, Limiter_, HistoryWriter_, Recent_, Bus_, nullptr, &backpressure);
+
+  EXPECT_CALL(ChatRepo_, GetChat(kChatId)).WillOnce(Return(ByMove(MakeChat())));
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _))
+      .WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{{kSenderId, EMemberRole::Writer}}));
+  EXPECT_CALL(backpressure, Admit(kChatId)).WillOnce(Return(std::chrono::milliseconds{100}));
+  EXPECT_CALL(Limiter_, TryAcquireN(_, _)).Times(0);
+
+  auto result = use_case.Execute(MakeRequest({{kChatId, "one"}, {kChatId, "two"}}));
+
+  EXPECT_EQ(result.Items[0].Status, ESendItemStatus::Overloaded);
+  EXPECT_EQ(result.Items[1].Status, ESendItemStatus::Overloaded);
+}
+
+// Backpressure спрашивается только о чатах, куда отправитель вправе писать
+TEST_F(SendBatchUseCaseTest, AdmitOnlyAfterAuthorization) {
+  StrictMock<TMockSendBackpressure> backpressure;
+  TSendBatchUseCase use_case(Registry_, ChatRepo_, Limiter_, HistoryWriter_, Recent_, Bus_, nullptr, &backpressure);
+
+  EXPECT_CALL(ChatRepo_, GetChat(kUnknownChatId)).WillOnce(Return(ByMove(nullptr)));
+  EXPECT_CALL(ChatRepo_, GetChat(kChatId)).WillOnce(Return(ByMove(MakeChat())));
+  EXPECT_CALL(ChatRepo_, GetMemberRoles(kChatId, _)).WillOnce(Return(std::unordered_map<TUserId, EMemberRole>{}));
+  EXPECT_CALL(Limiter_, TryAcquireN(_, _)).Times(0);
+
+  auto result = use_case.Execute(MakeRequest({{kUnknownChatId, "one"}, {kChatId, "two"}}));
+
+  EXPECT_EQ(result.Items[0].Status, ESendItemStatus::UnknownChat);
+  EXPECT_EQ(result.Items[1].Status, ESendItemStatus::Forbidden);
+}
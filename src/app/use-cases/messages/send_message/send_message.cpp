@@ -1,19 +1,52 @@
 #include "send_message.hpp"
 
+#include <userver/utils/scope_guard.hpp>
+
 namespace NChat::NApp {
 
 TSendMessageUseCase::TSendMessageUseCase(NCore::IMailboxRegistry& registry, NCore::IChatRepository& chat_repo,
-                                         ISendLimiter& limiter)
-    : Router_(registry), ChatRepo_(chat_repo), Limiter_(limiter) {
+                                         ISendLimiter& limiter, IIdempotencyStore& idempotency_store,
+                                         IHistoryWriter& history_writer, NCore::IRecentMessages& recent,
+                                         NCore::IMessageBus& bus, NCore::IFanOutPipeline* pipeline,
+                                         ISendBackpressure* backpressure)
+    : Router_(registry, &recent, &bus),
+      ChatRepo_(chat_repo),
+      Limiter_(limiter),
+      IdempotencyStore_(idempotency_store),
+      HistoryWriter_(history_writer),
+      Pipeline_(pipeline),
+      Backpressure_(backpressure) {
 }
 
 NDto::TSendMessageResult TSendMessageUseCase::Execute(NDto::TSendMessageRequest request) {
-  if (!Limiter_.TryAcquire(request.SenderId)) {
-    throw TTooManyRequests("Enhance your calm!");
-  };
+  // Ретраи клиента не должны тратить токены лимитера и доставляться повторно
+  if (request.IdempotencyKey) {
+    switch (IdempotencyStore_.TryRemember(request.SenderId, *request.IdempotencyKey)) {
+      case EIdempotencyKeyState::Completed:
+        return {.IsDuplicate = true};
+      case EIdempotencyKeyState::Pending:
+        // Исходный запрос еще может упасть и освободить ключ: подтверждать дубликат рано
+        throw TIdempotencyKeyInFlight(fmt::format("Message with key {} is still being sent", *request.IdempotencyKey));
+      case EIdempotencyKeyState::New:
+        break;
+    }
+  }
+
+  // Если отправка не состоялась, ключ освобождается для повторной попытки, иначе фиксируется как принятый
+  bool is_accepted = false;
+  userver::utils::ScopeGuard settle_key([this, &request, &is_accepted] {
+    if (!request.IdempotencyKey) {
+      return;
+    }
+
+    if (is_accepted) {
+      IdempotencyStore_.Complete(request.SenderId, *request.IdempotencyKey);
+    } else {
+      IdempotencyStore_.Forget(request.SenderId, *request.IdempotencyKey);
+    }
+  });
 
   TMessageText text(std::move(request.Text));
-  auto message = NCore::NDomain::TMessage::Create(request.ChatId, request.SenderId, std::move(text), request.SentAt);
 
   // fixme Сюда кэш бы прикрутить
   auto chat = ChatRepo_.GetChat(request.ChatId);
@@ -28,13 +61,48 @@ NDto::TSendMessageResult TSendMessageUseCase::Execute(NDto::TSendMessageRequest
     throw TSendForbidden(fmt::format("User {} can't send to chat {}", request.SenderId, request.ChatId));
   }
 
+  // Только после авторизации: чужой чат не тормозит отправителя, а отклоненная отправка не тратит токены
+  if (Backpressure_) {
+    if (const auto retry_after = Backpressure_->Admit(request.ChatId)) {
+      throw TChatOverloaded(fmt::format("Recipients of chat {} can't keep up", request.ChatId), *retry_after);
+    }
+  }
+
+  if (!Limiter_.TryAcquire(request.SenderId)) {
+    throw TTooManyRequests("Enhance your calm!");
+  };
+
+  auto message = NCore::NDomain::TMessage::Create(request.ChatId, request.SenderId, std::move(text), request.SentAt);
+
   // todo Resolver, для групп сейчас вылетит исключение
   auto recipients = chat->GetRecipients(request.SenderId);
 
+  if (Pipeline_) {
+    // Доставка уйдет воркеру чата; ключ идемпотентности освобождается, только если сообщение не принято
+    if (!Pipeline_->Submit({std::move(recipients), message})) {
+      throw TTooManyRequests(fmt::format("Delivery queue of chat {} is full", request.ChatId));
+    }
+
+    HistoryWriter_.Append(message);
+    is_accepted = true;
+
+    return {.IsQueued = true};
+  }
+
+  // В историю попадает и сообщение без онлайн-получателей; запись в БД фоновая
+  HistoryWriter_.Append(message);
+
   auto result = Router_.Route(std::move(recipients), std::move(message));
+  is_accepted = true;
+
+  if (Backpressure_) {
+    Backpressure_->Report(request.ChatId, result);
+  }
 
-  return {result.Successful, result.Dropped, result.Offline};
-  // todo Нужны ключи идемпотентности клиентские
+  return {.SuccessfulSent = result.Successful,
+          .OverflowDropCount = result.Dropped,
+          .OfflineCount = result.Offline,
+          .ForwardedCount = result.Forwarded};
 }
 
 }  // namespace NChat::NApp
@@ -1,12 +1,17 @@
 #pragma once
 
 #include <core/chats/chat_repo.hpp>
+#include <core/messaging/bus/message_bus.hpp>
 #include <core/messaging/mailbox/mailbox_registry.hpp>
+#include <core/messaging/pipeline/fanout_pipeline.hpp>
 #include <core/messaging/router/message_router.hpp>
 #include <core/users/user_repo.hpp>
 
 #include <app/dto/messages/send_message_dto.hpp>
 #include <app/exceptions.hpp>
+#include <app/services/message/history_writer.hpp>
+#include <app/services/message/idempotency_store.hpp>
+#include <app/services/message/send_backpressure.hpp>
 #include <app/services/message/send_limiter.hpp>
 
 namespace NChat::NApp {
@@ -15,6 +20,21 @@ class TTooManyRequests : public TApplicationException {
   using TApplicationException::TApplicationException;
 };
 
+// Очереди получателей чата насыщены: повторить не раньше RetryAfter
+class TChatOverloaded : public TTooManyRequests {
+ public:
+  TChatOverloaded(const std::string& message, std::chrono::milliseconds retry_after)
+      : TTooManyRequests(message), RetryAfter_(retry_after) {
+  }
+
+  std::chrono::milliseconds GetRetryAfter() const {
+    return RetryAfter_;
+  }
+
+ private:
+  std::chrono::milliseconds RetryAfter_;
+};
+
 class TUnknownChat : public TApplicationException {
   using TApplicationException::TApplicationException;
 };
@@ -23,6 +43,11 @@ class TSendForbidden : public TApplicationException {
   using TApplicationException::TApplicationException;
 };
 
+// Запрос с тем же ключом идемпотентности еще выполняется: исход неизвестен, повторить позже
+class TIdempotencyKeyInFlight : public TApplicationException {
+  using TApplicationException::TApplicationException;
+};
+
 class TSendMessageUseCase final {
  public:
   using TMessage = NCore::NDomain::TMessage;
@@ -30,7 +55,12 @@ class TSendMessageUseCase final {
   using TUserId = NCore::NDomain::TUserId;
   using TMessageText = NCore::NDomain::TMessageText;
 
-  TSendMessageUseCase(NCore::IMailboxRegistry& registry, NCore::IChatRepository& chat_repo, ISendLimiter& limiter);
+  // pipeline может быть nullptr: маршрутизация синхронно в корутине запроса
+  // backpressure может быть nullptr: заполненность очередей получателей не влияет на прием
+  TSendMessageUseCase(NCore::IMailboxRegistry& registry, NCore::IChatRepository& chat_repo, ISendLimiter& limiter,
+                      IIdempotencyStore& idempotency_store, IHistoryWriter& history_writer,
+                      NCore::IRecentMessages& recent, NCore::IMessageBus& bus,
+                      NCore::IFanOutPipeline* pipeline = nullptr, ISendBackpressure* backpressure = nullptr);
 
   NDto::TSendMessageResult Execute(NDto::TSendMessageRequest request);
 
@@ -38,6 +68,10 @@ class TSendMessageUseCase final {
   NCore::TMessageRouter Router_;
   NCore::IChatRepository& ChatRepo_;
   ISendLimiter& Limiter_;
+  IIdempotencyStore& IdempotencyStore_;
+  IHistoryWriter& HistoryWriter_;
+  NCore::IFanOutPipeline* Pipeline_;
+  ISendBackpressure* Backpressure_;
 };
 
 }  // namespace NChat::NApp
@@ -4,10 +4,15 @@
 
 namespace NChat::NApp {
 
-TStartSessionUseCase::TStartSessionUseCase(NCore::IMailboxRegistry& registry) : Registry_(registry) {
+TStartSessionUseCase::TStartSessionUseCase(NCore::IMailboxRegistry& registry, IDrainMode* drain)
+    : Registry_(registry), Drain_(drain) {
 }
 
 NDto::TStartSessionResult TStartSessionUseCase::Execute(const NDto::TStartSessionRequest& request) {
+  if (Drain_ && Drain_->IsDraining()) {
+    throw TNodeDraining("Node is shutting down. Start a new session later", Drain_->GetReconnectAfter());
+  }
+
   auto mailbox = Registry_.CreateOrGetMailbox(request.ConsumerId);
 
   if (!mailbox) {
@@ -18,7 +23,7 @@ NDto::TStartSessionResult TStartSessionUseCase::Execute(const NDto::TStartSessio
   constexpr int kMaxAttempts = 5;
 
   for (int i = 0; i < kMaxAttempts; ++i) {
-    auto session_id = NCore::NDomain::TSessionId{generator.Generate()};
+    auto session_id = NCore::NDomain::TSessionId{generator.GenerateV7()};
 
     if (mailbox->CreateSession(session_id)) {
       return {session_id};
@@ -5,24 +5,44 @@
 
 #include <app/dto/messages/start_session_dto.hpp>
 #include <app/exceptions.hpp>
+#include <app/services/message/drain_mode.hpp>
 #include <app/services/message/send_limiter.hpp>
 
+#include <chrono>
+
 namespace NChat::NApp {
 
 class TSessionCreationUnavailable : public TApplicationException {
   using TApplicationException::TApplicationException;
 };
 
+// Узел выводится из работы: сессию стоит открыть заново не раньше RetryAfter, уже на другом узле
+class TNodeDraining : public TSessionCreationUnavailable {
+ public:
+  TNodeDraining(const std::string& message, std::chrono::milliseconds retry_after)
+      : TSessionCreationUnavailable(message), RetryAfter_(retry_after) {
+  }
+
+  std::chrono::milliseconds GetRetryAfter() const {
+    return RetryAfter_;
+  }
+
+ private:
+  std::chrono::milliseconds RetryAfter_;
+};
+
 class TStartSessionUseCase final {
  public:
   using TUserId = NCore::NDomain::TUserId;
 
-  TStartSessionUseCase(NCore::IMailboxRegistry& registry);
+  // drain может быть nullptr: узел не выводится из работы, сессии создаются до самой остановки
+  TStartSessionUseCase(NCore::IMailboxRegistry& registry, IDrainMode* drain = nullptr);
 
   NDto::TStartSessionResult Execute(const NDto::TStartSessionRequest& request);
 
  private:
   NCore::IMailboxRegistry& Registry_;
+  IDrainMode* Drain_;
 };
 
 }  // namespace NChat::NApp
@@ -0,0 +1,173 @@
+#include <app/use-cases/messages/start_session/start_session.hpp>
+
+#include <utils/uuid/uuid_generator.hpp>
+
+#include <benchmark/benchmark.h>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+using namespace NChat::NCore;
+using namespace NChat::NCore::NDomain;
+
+namespace {
+
+class TStubMessageQueue : public IMessageQueue {
+ public:
+  bool Push(TMessage&&) override {
+    return true;
+  }
+
+  std::vector<TMessage> PopBatch(std::size_t, std::chrono::milliseconds) override {
+    return {};
+  }
+
+  std::size_t GetSizeApproximate() const override {
+    return 0;
+  }
+
+  void SetMaxSize(std::size_t) override {
+  }
+
+  std::size_t GetMaxSize() const override {
+    return 1000;
+  }
+
+  bool HasConsumer() const override {
+    return false;
+  }
+};
+
+// Session creation always succeeds, so the use case cost is id generation plus registry access
+class TStubSessionsRegistry : public ISessionsRegistry {
+ public:
+  TStubSessionsRegistry()
+      : Session_(std::make_shared<TUserSession>(TSessionId{"session"}, std::make_unique<TStubMessageQueue>(),
+                                                []() { return std::chrono::steady_clock::now(); })) {
+  }
+
+  bool FanOutMessage(TMessage) override {
+    return true;
+  }
+
+  double GetFillRatio() const override {
+    return 0.0;
+  }
+
+  std::shared_ptr<TUserSession> CreateSession(const TSessionId&) override {
+    return Session_;
+  }
+
+  std::shared_ptr<TUserSession> GetOrCreateSession(const TSessionId&) override {
+    return Session_;
+  }
+
+  std::shared_ptr<TUserSession> GetSession(const TSessionId&) override {
+    return Session_;
+  }
+
+  void RemoveSession(const TSessionId&) override {
+  }
+
+  std::size_t CleanIdle() override {
+    return 0;
+  }
+
+  std::size_t ShedOldest(std::size_t) override {
+    return 0;
+  }
+
+  bool HasNoConsumer() const override {
+    return false;
+  }
+
+  std::size_t GetOnlineAmount() const override {
+    return 1;
+  }
+
+ private:
+  std::shared_ptr<TUserSession> Session_;
+};
+
+class TStubMailboxRegistry : public IMailboxRegistry {
+ public:
+  TStubMailboxRegistry()
+      : Mailbox_(std::make_shared<TUserMailbox>(TUserId{"user"}, std::make_unique<TStubSessionsRegistry>())) {
+  }
+
+  TMailboxPtr GetMailbox(const TUserId&) const override {
+    return Mailbox_;
+  }
+
+  TMailboxPtr CreateOrGetMailbox(const TUserId&) override {
+    return Mailbox_;
+  }
+
+  void RemoveMailbox(const TUserId&) override {
+  }
+
+  int64_t GetOnlineAmount() const override {
+    return 1;
+  }
+
+  void TraverseRegistry(std::chrono::milliseconds) override {
+  }
+
+  std::size_t WakeConsumers() override {
+    return 0;
+  }
+
+  void Clear() override {
+  }
+
+ private:
+  TMailboxPtr Mailbox_;
+};
+
+}  // namespace
+
+// Бенчмарк: старты сессий в секунду (items/s)
+void BM_StartSession(benchmark::State& state) {
+  static TStubMailboxRegistry registry;
+  NChat::NApp::TStartSessionUseCase use_case{registry};
+  const NChat::NApp::NDto::TStartSessionRequest request{.ConsumerId = TUserId{"user"}};
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto result = use_case.Execute(request);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StartSession)->ThreadRange(1, 8);
+
+// Бенчмарк: прежний способ - генератор boost с чтением энтропии ОС при создании
+void BM_SessionId_BoostGeneratorPerCall(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    boost::uuids::random_generator generator;
+    auto id = boost::uuids::to_string(generator());
+    benchmark::DoNotOptimize(id);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SessionId_BoostGeneratorPerCall)->ThreadRange(1, 8);
+
+void BM_SessionId_V4(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    auto id = NUtils::NId::UuidGenerator{}.Generate();
+    benchmark::DoNotOptimize(id);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SessionId_V4)->ThreadRange(1, 8);
+
+void BM_SessionId_V7(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    auto id = NUtils::NId::UuidGenerator{}.GenerateV7();
+    benchmark::DoNotOptimize(id);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SessionId_V7)->ThreadRange(1, 8);
@@ -13,6 +13,6 @@ class MockAuthService : public IAuthService {
   MOCK_METHOD(bool, CheckPassword,
               (std::string_view input_password, std::string_view stored_password_hash, std::string_view password_salt),
               (override));
-  MOCK_METHOD(std::string, CreateJwt, (NDomain::TUserId id), (override));
-  MOCK_METHOD(std::optional<NDomain::TUserId>, DecodeJwt, (std::string_view token), (override));
+  MOCK_METHOD(std::string, CreateJwt, (const NDomain::TUserTinyProfile& profile), (override));
+  MOCK_METHOD(std::optional<NDomain::TUserTinyProfile>, DecodeJwt, (std::string_view token), (override));
 };
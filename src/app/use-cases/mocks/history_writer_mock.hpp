@@ -0,0 +1,13 @@
+#pragma once
+
+#include <app/services/message/history_writer.hpp>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace NChat::NCore;
+
+class TMockHistoryWriter : public NChat::NApp::IHistoryWriter {
+ public:
+  MOCK_METHOD(bool, Append, (const NDomain::TMessage&), (override));
+};
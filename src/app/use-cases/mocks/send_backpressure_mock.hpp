@@ -0,0 +1,14 @@
+#pragma once
+
+#include <app/services/message/send_backpressure.hpp>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace NChat::NCore;
+
+class TMockSendBackpressure : public NChat::NApp::ISendBackpressure {
+ public:
+  MOCK_METHOD(std::optional<std::chrono::milliseconds>, Admit, (const NDomain::TChatId&), (override));
+  MOCK_METHOD(void, Report, (const NDomain::TChatId&, const TSendStatus&), (override));
+};
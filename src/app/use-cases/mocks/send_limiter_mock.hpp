@@ -0,0 +1,16 @@
+#pragma once
+
+#include <app/services/message/send_limiter.hpp>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace NChat::NCore;
+
+class TMockSendLimiter : public NChat::NApp::ISendLimiter {
+ public:
+  MOCK_METHOD(bool, TryAcquire, (const NDomain::TUserId&), (override));
+  MOCK_METHOD(std::size_t, TryAcquireN, (const NDomain::TUserId&, std::size_t), (override));
+  MOCK_METHOD(void, TraverseLimiters, (), (override));
+  MOCK_METHOD(std::int64_t, GetTotalLimiters, (), (const, override));
+};
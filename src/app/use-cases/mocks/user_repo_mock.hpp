@@ -14,6 +14,10 @@ class TMockUserRepository : public IUserRepository {
   MOCK_METHOD(std::string, UpdateUser, (const TUsername& username_to_update, const TUserUpdateParams& params),
               (const, override));
   MOCK_METHOD(std::optional<TUserId>, FindByUsername, (std::string_view username), (const, override));
+  MOCK_METHOD(std::optional<TUserId>, FindCachedByUsername, (std::string_view username), (const, override));
   MOCK_METHOD(std::optional<TUserTinyProfile>, GetProfileById, (const TUserId& user_id), (const, override));
+  MOCK_METHOD((std::unordered_map<TUserId, TUserTinyProfile>), GetProfilesByIds, (const std::vector<TUserId>& ids),
+              (const, override));
+  MOCK_METHOD(TCachedProfile, GetCachedProfileById, (const TUserId& user_id), (const, override));
   MOCK_METHOD(std::unique_ptr<TUser>, GetUserByUsername, (std::string_view username), (const, override));
 };
@@ -21,18 +21,13 @@ NDto::TCheckTokenResult TCheckTokenUseCase::Execute(const std::string& token, bo
 
   std::string_view jwt{token.c_str() + TOKEN_KEYWORD.length()};
 
-  auto user_id = AuthService_.DecodeJwt(jwt);
+  auto claims = AuthService_.DecodeJwt(jwt);
 
-  if (!user_id.has_value()) {
+  if (!claims.has_value()) {
     return {.User = {}, .Error = NAuthErrors::VerifyError};
   }
 
-  std::optional<NCore::NDomain::TUserTinyProfile> profile;
-  try {
-    profile = UserRepo_.GetProfileById(user_id.value());
-  } catch (const std::exception& e) {
-    throw TCheckTokenTemporaryUnavailable(fmt::format("Failed to get profile by id: {}", e.what()));
-  }
+  auto profile = ResolveProfile(std::move(*claims));
 
   if (!profile.has_value()) {
     return {.User = {}, .Error = NAuthErrors::InvalidUser};
@@ -41,4 +36,29 @@ NDto::TCheckTokenResult TCheckTokenUseCase::Execute(const std::string& token, bo
   return {.User = {{profile->Id.GetUnderlying(), profile->Username, profile->DisplayName}}, .Error = {}};
 }
 
+std::optional<NCore::NDomain::TUserTinyProfile> TCheckTokenUseCase::ResolveProfile(
+    NCore::NDomain::TUserTinyProfile claims) const {
+  const auto cached = UserRepo_.GetCachedProfileById(claims.Id);
+
+  if (cached.Profile.has_value()) {
+    // Renamed or otherwise changed after the token was issued
+    if (cached.Profile->UpdatedAt > claims.UpdatedAt || claims.Username.empty()) {
+      return cached.Profile;
+    }
+    return claims;
+  }
+
+  // Not in cache, but the cache has not caught up with this profile version yet: the user is just created
+  if (!claims.Username.empty() && claims.UpdatedAt > cached.Watermark) {
+    return claims;
+  }
+
+  // Cache should have known this user: it is deleted or the cache is incomplete, ask the database
+  try {
+    return UserRepo_.GetProfileById(claims.Id);
+  } catch (const std::exception& e) {
+    throw TCheckTokenTemporaryUnavailable(fmt::format("Failed to get profile by id: {}", e.what()));
+  }
+}
+
 }  // namespace NChat::NApp
@@ -29,6 +29,11 @@ class TCheckTokenUseCase final {
 
   NDto::TCheckTokenResult Execute(const std::string& token, bool is_required) const;
 
+ private:
+  // Profile from token claims is used while it is not older than the cached one,
+  // the repository is asked only when the cache cannot vouch for the user
+  std::optional<NCore::NDomain::TUserTinyProfile> ResolveProfile(NCore::NDomain::TUserTinyProfile claims) const;
+
  private:
   NCore::IUserRepository& UserRepo_;
   NCore::IAuthService& AuthService_;
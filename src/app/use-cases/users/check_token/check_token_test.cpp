@@ -92,7 +92,8 @@ TEST_F(CheckTokenUseCaseIntegrationTest, InvalidJwt_ReturnsVerifyError) {
 TEST_F(CheckTokenUseCaseIntegrationTest, ValidJwtButUserNotExists_ReturnsInvalidUserError) {
   NDomain::TUserId user_id{"123"};
 
-  EXPECT_CALL(*auth_service_ptr_, DecodeJwt("valid.jwt.token")).WillOnce(Return(user_id));
+  EXPECT_CALL(*auth_service_ptr_, DecodeJwt("valid.jwt.token")).WillOnce(Return(NDomain::TUserTinyProfile{user_id}));
+  EXPECT_CALL(*user_repo_ptr_, GetCachedProfileById(user_id)).WillOnce(Return(IUserRepository::TCachedProfile{}));
   EXPECT_CALL(*user_repo_ptr_, GetProfileById(user_id)).WillOnce(Return(std::nullopt));
 
   auto result = use_case_->Execute("Bearer valid.jwt.token", true);
@@ -102,12 +103,13 @@ TEST_F(CheckTokenUseCaseIntegrationTest, ValidJwtButUserNotExists_ReturnsInvalid
   EXPECT_EQ(result.Error.value(), NAuthErrors::InvalidUser);
 }
 
-// Хороший сценарий
+// Хороший сценарий: токен без профиля, профиль из репозитория
 TEST_F(CheckTokenUseCaseIntegrationTest, ValidTokenAndUserExists_ReturnsUserId) {
   NDomain::TUserId user_id{"123"};
   NDomain::TUserTinyProfile user{user_id, "Username", "User Name"};
 
-  EXPECT_CALL(*auth_service_ptr_, DecodeJwt("valid.jwt.token")).WillOnce(Return(user_id));
+  EXPECT_CALL(*auth_service_ptr_, DecodeJwt("valid.jwt.token")).WillOnce(Return(NDomain::TUserTinyProfile{user_id}));
+  EXPECT_CALL(*user_repo_ptr_, GetCachedProfileById(user_id)).WillOnce(Return(IUserRepository::TCachedProfile{}));
   EXPECT_CALL(*user_repo_ptr_, GetProfileById(user_id)).WillOnce(Return(user));
 
   auto result = use_case_->Execute("Bearer valid.jwt.token", true);
@@ -118,3 +120,70 @@ TEST_F(CheckTokenUseCaseIntegrationTest, ValidTokenAndUserExists_ReturnsUserId)
   EXPECT_EQ(result.User.value().Username, user.Username);
   EXPECT_EQ(result.User.value().DisplayName, user.DisplayName);
 }
+
+namespace {
+const std::chrono::system_clock::time_point kIssuedVersion{std::chrono::seconds{1'000}};
+const std::chrono::system_clock::time_point kNewerVersion{std::chrono::seconds{2'000}};
+}  // namespace
+
+// Профиль в кэше той же версии, что и в токене -> берем клеймы, в БД не ходим
+TEST_F(CheckTokenUseCaseIntegrationTest, ClaimsUpToDate_NoRepositoryQuery) {
+  NDomain::TUserTinyProfile claims{NDomain::TUserId{"123"}, "Username", "User Name", kIssuedVersion};
+
+  EXPECT_CALL(*auth_service_ptr_, DecodeJwt("valid.jwt.token")).WillOnce(Return(claims));
+  EXPECT_CALL(*user_repo_ptr_, GetCachedProfileById(claims.Id))
+      .WillOnce(Return(IUserRepository::TCachedProfile{.Profile = claims, .Watermark = kNewerVersion}));
+  EXPECT_CALL(*user_repo_ptr_, GetProfileById(_)).Times(0);
+
+  auto result = use_case_->Execute("Bearer valid.jwt.token", true);
+
+  ASSERT_TRUE(result.User.has_value());
+  EXPECT_EQ(result.User->Username, "Username");
+}
+
+// Пользователь переименован после выдачи токена -> берем профиль из кэша
+TEST_F(CheckTokenUseCaseIntegrationTest, RenamedUser_UsesCachedProfile) {
+  NDomain::TUserTinyProfile claims{NDomain::TUserId{"123"}, "OldName", "User Name", kIssuedVersion};
+  NDomain::TUserTinyProfile cached{NDomain::TUserId{"123"}, "NewName", "User Name", kNewerVersion};
+
+  EXPECT_CALL(*auth_service_ptr_, DecodeJwt("valid.jwt.token")).WillOnce(Return(claims));
+  EXPECT_CALL(*user_repo_ptr_, GetCachedProfileById(claims.Id))
+      .WillOnce(Return(IUserRepository::TCachedProfile{.Profile = cached, .Watermark = kNewerVersion}));
+  EXPECT_CALL(*user_repo_ptr_, GetProfileById(_)).Times(0);
+
+  auto result = use_case_->Execute("Bearer valid.jwt.token", true);
+
+  ASSERT_TRUE(result.User.has_value());
+  EXPECT_EQ(result.User->Username, "NewName");
+}
+
+// Пользователь еще не попал в кэш, но токен новее кэша -> доверяем клеймам
+TEST_F(CheckTokenUseCaseIntegrationTest, UserNewerThanCache_UsesClaims) {
+  NDomain::TUserTinyProfile claims{NDomain::TUserId{"123"}, "Username", "User Name", kNewerVersion};
+
+  EXPECT_CALL(*auth_service_ptr_, DecodeJwt("valid.jwt.token")).WillOnce(Return(claims));
+  EXPECT_CALL(*user_repo_ptr_, GetCachedProfileById(claims.Id))
+      .WillOnce(Return(IUserRepository::TCachedProfile{.Profile = std::nullopt, .Watermark = kIssuedVersion}));
+  EXPECT_CALL(*user_repo_ptr_, GetProfileById(_)).Times(0);
+
+  auto result = use_case_->Execute("Bearer valid.jwt.token", true);
+
+  ASSERT_TRUE(result.User.has_value());
+  EXPECT_EQ(result.User->UserId, "123");
+}
+
+// Кэш новее токена, а пользователя в нем нет -> удален, спрашиваем репозиторий
+TEST_F(CheckTokenUseCaseIntegrationTest, DeletedUser_ReturnsInvalidUserError) {
+  NDomain::TUserTinyProfile claims{NDomain::TUserId{"123"}, "Username", "User Name", kIssuedVersion};
+
+  EXPECT_CALL(*auth_service_ptr_, DecodeJwt("valid.jwt.token")).WillOnce(Return(claims));
+  EXPECT_CALL(*user_repo_ptr_, GetCachedProfileById(claims.Id))
+      .WillOnce(Return(IUserRepository::TCachedProfile{.Profile = std::nullopt, .Watermark = kNewerVersion}));
+  EXPECT_CALL(*user_repo_ptr_, GetProfileById(claims.Id)).WillOnce(Return(std::nullopt));
+
+  auto result = use_case_->Execute("Bearer valid.jwt.token", true);
+
+  EXPECT_FALSE(result.User.has_value());
+  ASSERT_TRUE(result.Error.has_value());
+  EXPECT_EQ(result.Error.value(), NAuthErrors::InvalidUser);
+}
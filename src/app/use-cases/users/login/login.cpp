@@ -36,7 +36,10 @@ NDto::TUserLoginResult TLoginUseCase::Execute(const NDto::TUserLoginRequest& req
     return {.Token = std::nullopt, .Error = "Wrong credentials"};
   }
 
-  auto token = AuthService_.CreateJwt(user->GetId());
+  auto token = AuthService_.CreateJwt({.Id = user->GetId(),
+                                       .Username = user->GetUsername(),
+                                       .DisplayName = user->GetDisplayName(),
+                                       .UpdatedAt = user->GetUpdatedAt()});
 
   return {.Token = token, .Error = std::nullopt};
 }
@@ -29,10 +29,13 @@ class LoginUseCaseIntegrationTest : public Test {
                             .DisplayName = "Test User",
                             .PasswordHash = "hashed_password",
                             .Salt = "salt_value",
-                            .Biography = "Test bio"};
+                            .Biography = "Test bio",
+                            .UpdatedAt = kUpdatedAt};
     return std::make_unique<NDomain::TUser>(data);
   }
 
+  static constexpr std::chrono::system_clock::time_point kUpdatedAt{std::chrono::seconds{1'700'000'000}};
+
   std::unique_ptr<TMockUserRepository> user_repo_;
   std::unique_ptr<MockAuthService> auth_service_;
   std::unique_ptr<TLoginUseCase> use_case_;
@@ -56,7 +59,10 @@ TEST_F(LoginUseCaseIntegrationTest, SuccessfulLogin) {
       .WillOnce(Return(true));
 
   const std::string expected_token = "eyJhbGciOiJIUzI1NiIsInR5cCI6IkpXVCJ9";
-  EXPECT_CALL(*auth_service_ptr_, CreateJwt(NDomain::TUserId{"user123"})).WillOnce(Return(expected_token));
+  EXPECT_CALL(*auth_service_ptr_, CreateJwt(AllOf(Field(&NDomain::TUserTinyProfile::Id, NDomain::TUserId{"user123"}),
+                                                  Field(&NDomain::TUserTinyProfile::Username, "testuser"),
+                                                  Field(&NDomain::TUserTinyProfile::UpdatedAt, kUpdatedAt))))
+      .WillOnce(Return(expected_token));
 
   auto result = use_case_->Execute(request);
 
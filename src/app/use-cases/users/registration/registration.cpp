@@ -3,7 +3,6 @@
 #include <core/users/value/raw_password.hpp>
 #include <core/users/value/username.hpp>
 
-#include <utils/jwt/jwt.hpp>
 #include <utils/uuid/uuid_generator.hpp>
 
 #include <fmt/format.h>
@@ -29,23 +28,28 @@ NDto::TUserRegistrationResult TRegistrationUseCase::Execute(const NDto::TUserReg
   TDisplayName display_name{request.DisplayName};
   TUsername username{request.Username};
 
-  if (UserRepo_.FindByUsername(username.Value()).has_value()) {
+  // Only the cache is checked to skip hashing for known names: a fresh duplicate is rejected by the insert itself
+  if (UserRepo_.FindCachedByUsername(username.Value()).has_value()) {
     throw NCore::NDomain::TUserAlreadyExistsException(fmt::format("Username {} already exists", username.Value()));
   }
 
   auto password_hash = AuthService_.HashPassword(request.Password);
 
   NUtils::NId::UuidGenerator generator;
-  auto user_id = NCore::NDomain::TUserId{generator.Generate()};
+  auto user_id = NCore::NDomain::TUserId{generator.GenerateV7()};
   auto user = NCore::NDomain::TUser(user_id, username, display_name, password_hash, biography);
 
   try {
     UserRepo_.InsertNewUser(user);
+  } catch (const NCore::NDomain::TUserAlreadyExistsException&) {
+    throw;
   } catch (const std::exception& e) {
     throw TRegistrationTemporaryUnavailable("Registration temporary unavailable. Failed to insert new user");
   }
 
-  auto token = AuthService_.CreateJwt(user_id);
+  // updated_at is assigned by the database, so the first token has unknown profile version
+  auto token = AuthService_.CreateJwt(
+      {.Id = user_id, .Username = user.GetUsername(), .DisplayName = user.GetDisplayName()});
 
   return {.Username = username.Value(), .Token = token};
 }
@@ -45,7 +45,7 @@ TEST_F(RegistrationUseCaseIntegrationTest, SuccessfulRegistration) {
   };
 
   // Настройка ожиданий
-  EXPECT_CALL(*user_repo_ptr_, FindByUsername("testuser")).WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*user_repo_ptr_, FindCachedByUsername("testuser")).WillOnce(Return(std::nullopt));
 
   NDomain::TPasswordHash expected_hash = HashPasswordUtil(request.Password);
   EXPECT_CALL(*auth_service_ptr_, HashPassword(request.Password)).WillOnce(Return(expected_hash));
@@ -75,7 +75,7 @@ TEST_F(RegistrationUseCaseIntegrationTest, UserAlreadyExists) {
   std::string dummy_hash = "hash";
   std::string dummy_salt = "salt";
 
-  EXPECT_CALL(*user_repo_ptr_, FindByUsername("existinguser")).WillOnce(Return(NDomain::TUserId{"123"}));
+  EXPECT_CALL(*user_repo_ptr_, FindCachedByUsername("existinguser")).WillOnce(Return(NDomain::TUserId{"123"}));
 
   // Не должны вызываться другие методы
   EXPECT_CALL(*auth_service_ptr_, HashPassword(_)).Times(0);
@@ -99,7 +99,7 @@ TEST_F(RegistrationUseCaseIntegrationTest, CompleteIntegrationFlow) {
     InSequence seq;
 
     // 1. Проверка существования пользователя
-    EXPECT_CALL(*user_repo_ptr_, FindByUsername("john_doe")).WillOnce(Return(std::nullopt));
+    EXPECT_CALL(*user_repo_ptr_, FindCachedByUsername("john_doe")).WillOnce(Return(std::nullopt));
 
     // 2. Хэширование пароля
     EXPECT_CALL(*auth_service_ptr_, HashPassword(request.Password))
@@ -127,7 +127,7 @@ TEST_F(RegistrationUseCaseIntegrationTest, CorrectUserDataPassed) {
       .DisplayName = "Test Display",
   };
 
-  EXPECT_CALL(*user_repo_ptr_, FindByUsername("testuser")).WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*user_repo_ptr_, FindCachedByUsername("testuser")).WillOnce(Return(std::nullopt));
 
   NDomain::TPasswordHash hash = HashPasswordUtil(request.Password);
   EXPECT_CALL(*auth_service_ptr_, HashPassword(request.Password)).WillOnce(Return(hash));
@@ -153,7 +153,7 @@ TEST_F(RegistrationUseCaseIntegrationTest, RepositoryError) {
       .DisplayName = "Test Display",
   };
 
-  EXPECT_CALL(*user_repo_ptr_, FindByUsername("testuser")).WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*user_repo_ptr_, FindCachedByUsername("testuser")).WillOnce(Return(std::nullopt));
 
   NDomain::TPasswordHash hash = HashPasswordUtil(request.Password);
   EXPECT_CALL(*auth_service_ptr_, HashPassword(request.Password)).WillOnce(Return(hash));
@@ -165,3 +165,24 @@ TEST_F(RegistrationUseCaseIntegrationTest, RepositoryError) {
 
   EXPECT_THROW(use_case_->Execute(request), TRegistrationTemporaryUnavailable);
 }
+
+// Имени еще нет в кэше, дубликат отклоняет вставка
+TEST_F(RegistrationUseCaseIntegrationTest, DuplicateMissedByCache) {
+  NDto::TUserRegistrationRequest request{
+      .Username = "freshuser",
+      .Password = "Password@123",
+      .Biography = "My bio",
+      .DisplayName = "Test Display",
+  };
+
+  EXPECT_CALL(*user_repo_ptr_, FindCachedByUsername("freshuser")).WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*user_repo_ptr_, FindByUsername(_)).Times(0);
+  EXPECT_CALL(*auth_service_ptr_, HashPassword(request.Password))
+      .WillOnce(Return(HashPasswordUtil(request.Password)));
+
+  EXPECT_CALL(*user_repo_ptr_, InsertNewUser(testing::_))
+      .WillOnce(Throw(NDomain::TUserAlreadyExistsException("Username freshuser already exists")));
+  EXPECT_CALL(*auth_service_ptr_, CreateJwt(_)).Times(0);
+
+  EXPECT_THROW(use_case_->Execute(request), NDomain::TUserAlreadyExistsException);
+}
@@ -9,10 +9,14 @@ namespace NChat::NCore::NDomain {
 struct TUserIdTag {};
 struct TChatIdTag {};
 struct TSessionIdTag {};
+struct TNodeIdTag {};
 
 using TUserId = NUtils::TStrongTypedef<TUserIdTag, std::string, NUtils::EStrongTypedefOps::kCompareStrong>;
 using TSessionId = NUtils::TStrongTypedef<TSessionIdTag, std::string, NUtils::EStrongTypedefOps::kCompareStrong>;
 
+// Имя экземпляра сервиса в кластере, задается в статическом конфиге шины сообщений
+using TNodeId = NUtils::TStrongTypedef<TNodeIdTag, std::string, NUtils::EStrongTypedefOps::kCompareStrong>;
+
 // ChatId = <prefix>:<uuid>
 using TChatId = NUtils::TStrongTypedef<TUserIdTag, std::string, NUtils::EStrongTypedefOps::kCompareStrong>;
 
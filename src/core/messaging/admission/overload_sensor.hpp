@@ -0,0 +1,14 @@
+#pragma once
+
+namespace NChat::NCore {
+
+// Перегружен ли узел: новых пользователей не пускаем, переподключения и уже открытые ящики обслуживаем
+class IOverloadSensor {
+ public:
+  // Hot path
+  virtual bool IsOverloaded() const = 0;
+
+  virtual ~IOverloadSensor() = default;
+};
+
+}  // namespace NChat::NCore
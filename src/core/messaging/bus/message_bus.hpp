@@ -0,0 +1,39 @@
+#pragma once
+
+#include <core/common/ids.hpp>
+#include <core/messaging/message.hpp>
+
+#include <vector>
+
+namespace NChat::NCore {
+
+// Очередь получателя считается насыщенной с этой доли заполнения; сообщение, не влезшее в очередь, - тоже
+inline constexpr double kSaturatedFillRatio = 0.8;
+
+struct TSendStatus {
+  std::size_t Successful = 0;
+  std::size_t Dropped = 0;
+  std::size_t Offline = 0;
+  std::size_t Forwarded = 0;
+
+  // Обратная связь от локальных получателей (Successful + Dropped) для backpressure отправителя
+  std::size_t Saturated = 0;
+  double MaxFillRatio = 0.0;
+};
+
+struct TRouteTask {
+  std::vector<NDomain::TUserId> Recipients;
+  NDomain::TMessage Message;
+};
+
+// Шина между узлами: доставляет сообщения получателям, у которых нет почтового ящика на этом узле
+class IMessageBus {
+ public:
+  // Статус на каждую задачу: Forwarded - передано узлу получателя, Offline - получатель нигде не найден,
+  // Dropped - очередь пересылки узла переполнена
+  virtual std::vector<TSendStatus> Forward(std::vector<TRouteTask> batch) = 0;
+
+  virtual ~IMessageBus() = default;
+};
+
+}  // namespace NChat::NCore
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <core/common/ids.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace NChat::NCore {
+
+// Presence: на каких узлах может жить почтовый ящик пользователя
+class INodeLocator {
+ public:
+  // Резолвит получателей пачки за один проход; пользователей, которых нет ни на одном узле, в ответе нет
+  virtual std::unordered_map<NDomain::TUserId, std::vector<NDomain::TNodeId>> Locate(
+      const std::vector<NDomain::TUserId>& users) const = 0;
+
+  virtual ~INodeLocator() = default;
+};
+
+}  // namespace NChat::NCore
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <core/common/ids.hpp>
+#include <core/messaging/message.hpp>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace NChat::NCore {
+
+namespace NDomain {
+
+struct THistoryMessage {
+  TMessageSeq Seq;
+  std::shared_ptr<const TMessagePayload> Payload;
+  std::chrono::system_clock::time_point SentAt;
+};
+
+}  // namespace NDomain
+
+// Страница истории: не больше limit сообщений с Seq < before (без before — самые новые), по возрастанию Seq
+class IMessageHistoryRepository {
+ public:
+  virtual std::vector<NDomain::THistoryMessage> GetPage(const NDomain::TChatId& chat_id,
+                                                        std::optional<NDomain::TMessageSeq> before,
+                                                        std::size_t limit) const = 0;
+
+  virtual ~IMessageHistoryRepository() = default;
+};
+
+// Последние сообщения чатов в памяти, заполняются при маршрутизации
+class IRecentMessages {
+ public:
+  virtual void Remember(const NDomain::TMessage& message) = 0;
+
+  // nullopt, если в памяти меньше limit сообщений до before и страницу надо читать из БД
+  virtual std::optional<std::vector<NDomain::THistoryMessage>> GetPage(const NDomain::TChatId& chat_id,
+                                                                       std::optional<NDomain::TMessageSeq> before,
+                                                                       std::size_t limit) = 0;
+
+  virtual ~IRecentMessages() = default;
+};
+
+}  // namespace NChat::NCore
@@ -13,6 +13,10 @@ bool TUserMailbox::SendMessage(NDomain::TMessage&& message) {
   return Sessions_->FanOutMessage(std::move(message));
 }
 
+double TUserMailbox::GetFillRatio() const {
+  return Sessions_->GetFillRatio();
+}
+
 TMessages TUserMailbox::PollMessages(NDomain::TSessionId session_id, std::size_t max_size,
                                      std::chrono::seconds timeout) {
   auto session = Sessions_->GetSession(session_id);
@@ -36,6 +40,14 @@ std::size_t TUserMailbox::CleanIdle() {
   return Sessions_->CleanIdle();
 }
 
+std::size_t TUserMailbox::ShedOldest(std::size_t keep) {
+  return Sessions_->ShedOldest(keep);
+}
+
+void TUserMailbox::WakeConsumers() {
+  Sessions_->FanOutMessage(NDomain::TMessage{.Class = NDomain::EMessageClass::Wakeup});
+}
+
 NDomain::TUserId TUserMailbox::GetUserId() const {
   return UserId_;
 }
@@ -17,11 +17,16 @@ class TUserMailbox {
   TUserMailbox(NDomain::TUserId user_id, TSessions session);
 
   bool SendMessage(NDomain::TMessage&& message);
+  double GetFillRatio() const;
   TMessages PollMessages(NDomain::TSessionId session_id, std::size_t max_size, std::chrono::seconds timeout);
   bool CreateSession(NDomain::TSessionId session_id);
 
   bool HasNoConsumer() const;
   std::size_t CleanIdle();
+  // Оставляет в каждой очереди не больше keep сообщений, возвращает число сброшенных
+  std::size_t ShedOldest(std::size_t keep);
+  // Будит поллеров всех сессий пустым сообщением класса Wakeup
+  void WakeConsumers();
   NDomain::TUserId GetUserId() const;
 
  private:
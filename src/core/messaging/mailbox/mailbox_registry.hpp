@@ -20,6 +20,9 @@ class IMailboxRegistry {
   // Offline API for metrics and periodic cleaning
   virtual void TraverseRegistry(std::chrono::milliseconds inter_pause) = 0;
 
+  // Будит всех ждущих поллеров узла при выводе его из работы, возвращает число почтовых ящиков
+  virtual std::size_t WakeConsumers() = 0;
+
   // For reset in tests
   virtual void Clear() = 0;
 
@@ -84,6 +84,15 @@ TEST_F(TUserMailboxTest, SendMessageFailure) {
   EXPECT_FALSE(mailbox.SendMessage(TMessage{}));
 }
 
+TEST_F(TUserMailboxTest, WakeConsumersSendsEmptyWakeup) {
+  auto [mailbox, mock_sessions] = CreateMailboxWithMock();
+  EXPECT_CALL(*mock_sessions, FanOutMessage(::testing::AllOf(::testing::Field(&TMessage::Class, EMessageClass::Wakeup),
+                                                             ::testing::Field(&TMessage::Payload, nullptr))))
+      .WillOnce(Return(true));
+
+  mailbox.WakeConsumers();
+}
+
 // ==================== CreateSession Tests ====================
 
 TEST_F(TUserMailboxTest, CreateSessionSuccess) {
@@ -1,11 +1,26 @@
 #include "message.hpp"
 
+#include <utils/seq/message_seq.hpp>
+
 namespace NChat::NCore::NDomain {
 TMessage TMessage::Create(const TChatId& chat_id, const TUserId& sender_id, TMessageText text,
-                          std::chrono::steady_clock::time_point sent_at) {
+                          std::chrono::steady_clock::time_point sent_at, EMessageClass message_class) {
   auto payload = std::make_shared<NCore::NDomain::TMessagePayload>(sender_id, std::move(text));
 
   NCore::NDomain::TDeliveryContext context{.Get = sent_at};
-  return {.Payload = std::move(payload), .ChatId = chat_id, .Context = context};
+  return {.Payload = std::move(payload),
+          .ChatId = chat_id,
+          .Context = context,
+          .Seq = NUtils::NId::GenerateMessageSeq(),
+          .Class = message_class};
+}
+
+std::size_t TMessage::GetFootprint() const {
+  if (!Payload) {
+    return sizeof(TMessage);
+  }
+
+  return sizeof(TMessage) + sizeof(TMessagePayload) + Payload->Sender.GetUnderlying().size() +
+         Payload->Text.Value().size();
 }
 }  // namespace NChat::NCore::NDomain
@@ -4,10 +4,14 @@
 #include <core/messaging/value/message_text.hpp>
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 
 namespace NChat::NCore::NDomain {
 
+// Порядковый номер сообщения, ключ пагинации истории чата
+using TMessageSeq = std::int64_t;
+
 struct TMessagePayload {
   TUserId Sender;
   TMessageText Text;
@@ -19,13 +23,28 @@ struct TDeliveryContext {
   std::chrono::steady_clock::time_point Dequeued{};
 };
 
+// Служебные сообщения (смена состава чата, системные уведомления) - пунктуация потока чата:
+// их нельзя терять или задерживать за обычными сообщениями в переполненной очереди
+enum class EMessageClass : std::uint8_t {
+  Regular,
+  Service,
+  // Без полезной нагрузки: только будит поллера (вывод узла из работы), клиенту не отдается
+  Wakeup,
+};
+
 struct TMessage {
   std::shared_ptr<const TMessagePayload> Payload;
   TChatId ChatId;
   TDeliveryContext Context;
+  TMessageSeq Seq = 0;
+  EMessageClass Class = EMessageClass::Regular;
 
   static TMessage Create(const TChatId& chat_id, const TUserId& sender_id, TMessageText text,
-                         std::chrono::steady_clock::time_point sent_at);
+                         std::chrono::steady_clock::time_point sent_at,
+                         EMessageClass message_class = EMessageClass::Regular);
+
+  // Байты сообщения в очереди для бюджета памяти узла; payload считается целиком, даже если он общий
+  std::size_t GetFootprint() const;
 };
 
 }  // namespace NChat::NCore::NDomain
@@ -1,5 +1,11 @@
 #pragma once
+#include <core/messaging/admission/overload_sensor.hpp>
+#include <core/messaging/bus/message_bus.hpp>
+#include <core/messaging/bus/node_locator.hpp>
+#include <core/messaging/history/history_repo.hpp>
 #include <core/messaging/mailbox/mailbox_registry.hpp>
+#include <core/messaging/pipeline/fanout_pipeline.hpp>
+#include <core/messaging/presence/presence.hpp>
 #include <core/messaging/queue/message_queue_factory.hpp>
 #include <core/messaging/session/sessions_factory.hpp>
 
@@ -20,6 +26,7 @@ class MockMessageQueue : public IMessageQueue {
   MOCK_METHOD(void, SetMaxSize, (std::size_t), (override));
   MOCK_METHOD(std::size_t, GetMaxSize, (), (const, override));
   MOCK_METHOD(bool, HasConsumer, (), (const, override));
+  MOCK_METHOD(std::vector<NDomain::TMessage>, ShedOldest, (std::size_t), (override));
 };
 
 class MockMessageQueueFactory : public IMessageQueueFactory {
@@ -35,15 +42,62 @@ class MockSessionsFactory : public ISessionsFactory {
 class MockSessionsRegistry : public ISessionsRegistry {
  public:
   MOCK_METHOD(bool, FanOutMessage, (NDomain::TMessage message), (override));
+  MOCK_METHOD(double, GetFillRatio, (), (const, override));
   MOCK_METHOD(std::shared_ptr<TUserSession>, GetSession, (const NDomain::TSessionId& session_id), (override));
   MOCK_METHOD(std::shared_ptr<TUserSession>, GetOrCreateSession, (const NDomain::TSessionId& session_id), (override));
   MOCK_METHOD(std::shared_ptr<TUserSession>, CreateSession, (const NDomain::TSessionId& session_id), (override));
   MOCK_METHOD(bool, HasNoConsumer, (), (const, override));
   MOCK_METHOD(std::size_t, CleanIdle, (), (override));
+  MOCK_METHOD(std::size_t, ShedOldest, (std::size_t keep), (override));
   MOCK_METHOD(std::size_t, GetOnlineAmount, (), (const, override));
   MOCK_METHOD(void, RemoveSession, (const NDomain::TSessionId& sessiond_id), (override));
 };
 
+class MockRecentMessages : public IRecentMessages {
+ public:
+  MOCK_METHOD(void, Remember, (const NDomain::TMessage&), (override));
+  MOCK_METHOD(std::optional<std::vector<NDomain::THistoryMessage>>, GetPage,
+              (const NDomain::TChatId&, std::optional<NDomain::TMessageSeq>, std::size_t), (override));
+};
+
+class MockMessageHistoryRepository : public IMessageHistoryRepository {
+ public:
+  MOCK_METHOD(std::vector<NDomain::THistoryMessage>, GetPage,
+              (const NDomain::TChatId&, std::optional<NDomain::TMessageSeq>, std::size_t), (const, override));
+};
+
+class MockMessageBus : public IMessageBus {
+ public:
+  MOCK_METHOD(std::vector<TSendStatus>, Forward, (std::vector<TRouteTask>), (override));
+};
+
+class MockFanOutPipeline : public IFanOutPipeline {
+ public:
+  MOCK_METHOD(bool, Submit, (TRouteTask), (override));
+};
+
+class MockPresencePublisher : public IPresencePublisher {
+ public:
+  MOCK_METHOD(void, Publish, (const NDomain::TUserId&), (override));
+  MOCK_METHOD(void, Revoke, (std::vector<NDomain::TUserId>), (override));
+  MOCK_METHOD(void, Renew, (std::vector<NDomain::TUserId>), (override));
+};
+
+class MockPresenceStore : public IPresenceStore {
+ public:
+  MOCK_METHOD(void, Upsert, (const NDomain::TNodeId&, const std::vector<NDomain::TUserId>&, std::chrono::seconds),
+              (override));
+  MOCK_METHOD(void, Revoke, (const NDomain::TNodeId&, const std::vector<NDomain::TUserId>&), (override));
+  MOCK_METHOD((std::unordered_map<NDomain::TUserId, std::vector<NDomain::TNodeId>>), Lookup,
+              (const std::vector<NDomain::TUserId>&), (const, override));
+};
+
+class MockNodeLocator : public INodeLocator {
+ public:
+  MOCK_METHOD((std::unordered_map<NDomain::TUserId, std::vector<NDomain::TNodeId>>), Locate,
+              (const std::vector<NDomain::TUserId>&), (const, override));
+};
+
 // Mock для IMailboxRegistry
 class MockMailboxRegistry : public IMailboxRegistry {
  public:
@@ -52,9 +106,15 @@ class MockMailboxRegistry : public IMailboxRegistry {
   MOCK_METHOD(void, RemoveMailbox, (const NDomain::TUserId&), (override));
   MOCK_METHOD(int64_t, GetOnlineAmount, (), (const, override));
   MOCK_METHOD(void, TraverseRegistry, (std::chrono::milliseconds), (override));
+  MOCK_METHOD(std::size_t, WakeConsumers, (), (override));
   MOCK_METHOD(void, Clear, (), (override));
 };
 
+class MockOverloadSensor : public IOverloadSensor {
+ public:
+  MOCK_METHOD(bool, IsOverloaded, (), (const, override));
+};
+
 inline NDomain::TMessage CreateTestMessage(const std::string& sender_id, const std::string& chat_id,
                                            const std::string& text) {
   auto payload = std::make_shared<NDomain::TMessagePayload>(NDomain::TUserId{sender_id}, NDomain::TMessageText(text));
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <core/messaging/bus/message_bus.hpp>
+
+namespace NChat::NCore {
+
+// Очередь между приемом отправки и доставкой: сообщения одного чата доставляются в порядке приема
+class IFanOutPipeline {
+ public:
+  // false - очередь чата переполнена, сообщение не принято
+  virtual bool Submit(TRouteTask task) = 0;
+
+  virtual ~IFanOutPipeline() = default;
+};
+
+}  // namespace NChat::NCore
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <core/common/ids.hpp>
+
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+namespace NChat::NCore {
+
+// Реестр почтовых ящиков сообщает, какие пользователи живут на этом узле
+class IPresencePublisher {
+ public:
+  // Hot path: почтовый ящик создан, публикация аренды откладывается и уходит пачкой
+  virtual void Publish(const NDomain::TUserId& user_id) = 0;
+
+  // Почтовые ящики удалены
+  virtual void Revoke(std::vector<NDomain::TUserId> users) = 0;
+
+  // Продление аренды всех живых почтовых ящиков, вызывается из периодической чистки реестра
+  virtual void Renew(std::vector<NDomain::TUserId> users) = 0;
+
+  virtual ~IPresencePublisher() = default;
+};
+
+// Общее для кластера хранилище аренд (user_id, node_id): с нескольких устройств у пользователя их несколько
+class IPresenceStore {
+ public:
+  // Продлевает или создает только аренды этого узла, чужие не трогает
+  virtual void Upsert(const NDomain::TNodeId& node_id, const std::vector<NDomain::TUserId>& users,
+                      std::chrono::seconds ttl) = 0;
+
+  // Отзываются только аренды этого узла: пользователь мог уже переехать на другой
+  virtual void Revoke(const NDomain::TNodeId& node_id, const std::vector<NDomain::TUserId>& users) = 0;
+
+  // Все узлы с живой арендой, пользователей без аренды в ответе нет
+  virtual std::unordered_map<NDomain::TUserId, std::vector<NDomain::TNodeId>> Lookup(
+      const std::vector<NDomain::TUserId>& users) const = 0;
+
+  virtual ~IPresenceStore() = default;
+};
+
+}  // namespace NChat::NCore
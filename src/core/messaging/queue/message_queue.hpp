@@ -24,6 +24,22 @@ class IMessageQueue {
 
   virtual bool HasConsumer() const = 0;
 
+  // True if the consumer lost messages since the last call (e.g. evicted from a shared ring)
+  virtual bool ConsumeMissed() {
+    return false;
+  }
+
+  // True if the queue charges its messages to the node memory budget itself (one copy shared by several sessions).
+  // The session then neither charges on push nor releases on pop
+  virtual bool ChargesMemory() const {
+    return false;
+  }
+
+  // Drops the oldest messages until at most keep remain and returns them. Drops nothing while the consumer polls
+  virtual std::vector<NDomain::TMessage> ShedOldest(std::size_t /*keep*/) {
+    return {};
+  }
+
   virtual ~IMessageQueue() = default;
 };
 
@@ -1,38 +1,131 @@
 #include "message_router.hpp"
 
+#include <algorithm>
+
 namespace NChat::NCore {
 
-TMessageRouter::TMessageRouter(IMailboxRegistry& registry) : Registry_(registry) {
+TMessageRouter::TMessageRouter(IMailboxRegistry& registry, IRecentMessages* recent, IMessageBus* bus)
+    : Registry_(registry), Recent_(recent), Bus_(bus) {
 }
 
 TSendStatus TMessageRouter::Route(std::vector<NDomain::TUserId> recipients, NDomain::TMessage message) const {
-  TSendStatus status;
+  std::vector<TSendStatus> status(1);
+  std::vector<NDomain::TUserId> remote;
+
+  if (Recent_) {
+    Recent_->Remember(message);
+  }
 
   for (auto it = recipients.begin(); it != recipients.end(); ++it) {
     auto mailbox = Registry_.GetMailbox(*it);
 
     if (!mailbox) {
-      ++status.Offline;
+      if (Bus_) {
+        remote.push_back(*it);
+      } else {
+        ++status[0].Offline;
+      }
       continue;
     }
 
-    bool success = false;
-
-    if (std::next(it) == recipients.end()) {
-      success = mailbox->SendMessage(std::move(message));
+    // Сообщение нужно шине, пока есть получатели на других узлах
+    if (std::next(it) == recipients.end() && remote.empty()) {
+      Deliver(mailbox, std::move(message), status[0]);
     } else {
       auto copy = message;
-      success = mailbox->SendMessage(std::move(copy));
+      Deliver(mailbox, std::move(copy), status[0]);
     }
+  }
 
-    if (success) {
-      ++status.Successful;
-    } else {
-      ++status.Dropped;
+  if (!remote.empty()) {
+    std::vector<TRouteTask> remote_batch;
+    remote_batch.push_back({std::move(remote), std::move(message)});
+    ForwardRemote(std::move(remote_batch), {0}, status);
+  }
+
+  return status[0];
+}
+
+std::vector<TSendStatus> TMessageRouter::RouteBatch(std::vector<TRouteTask> batch) const {
+  std::vector<TSendStatus> statuses(batch.size());
+  std::unordered_map<NDomain::TUserId, TMailboxPtr> mailboxes;
+
+  std::vector<TRouteTask> remote_batch;
+  std::vector<std::size_t> remote_positions;
+
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    auto& [recipients, message] = batch[i];
+    std::vector<NDomain::TUserId> remote;
+
+    if (Recent_) {
+      Recent_->Remember(message);
+    }
+
+    for (auto it = recipients.begin(); it != recipients.end(); ++it) {
+      auto [mailbox_it, inserted] = mailboxes.try_emplace(*it);
+      if (inserted) {
+        mailbox_it->second = Registry_.GetMailbox(*it);
+      }
+
+      const auto& mailbox = mailbox_it->second;
+
+      if (!mailbox) {
+        if (Bus_) {
+          remote.push_back(*it);
+        } else {
+          ++statuses[i].Offline;
+        }
+        continue;
+      }
+
+      if (std::next(it) == recipients.end() && remote.empty()) {
+        Deliver(mailbox, std::move(message), statuses[i]);
+      } else {
+        auto copy = message;
+        Deliver(mailbox, std::move(copy), statuses[i]);
+      }
+    }
+
+    if (!remote.empty()) {
+      remote_batch.push_back({std::move(remote), std::move(message)});
+      remote_positions.push_back(i);
     }
   }
 
-  return status;
+  if (!remote_batch.empty()) {
+    ForwardRemote(std::move(remote_batch), remote_positions, statuses);
+  }
+
+  return statuses;
+}
+
+void TMessageRouter::Deliver(const TMailboxPtr& mailbox, NDomain::TMessage&& message, TSendStatus& status) {
+  if (!mailbox->SendMessage(std::move(message))) {
+    ++status.Dropped;
+    ++status.Saturated;
+    status.MaxFillRatio = 1.0;
+    return;
+  }
+
+  ++status.Successful;
+
+  const auto fill_ratio = mailbox->GetFillRatio();
+  status.MaxFillRatio = std::max(status.MaxFillRatio, fill_ratio);
+  if (fill_ratio >= kSaturatedFillRatio) {
+    ++status.Saturated;
+  }
+}
+
+void TMessageRouter::ForwardRemote(std::vector<TRouteTask> remote, const std::vector<std::size_t>& positions,
+                                   std::vector<TSendStatus>& statuses) const {
+  const auto remote_statuses = Bus_->Forward(std::move(remote));
+
+  for (std::size_t i = 0; i < remote_statuses.size() && i < positions.size(); ++i) {
+    auto& status = statuses[positions[i]];
+    status.Forwarded += remote_statuses[i].Forwarded;
+    status.Offline += remote_statuses[i].Offline;
+    status.Dropped += remote_statuses[i].Dropped;
+  }
 }
 
 }  // namespace NChat::NCore
@@ -1,23 +1,36 @@
 #pragma once
 
+#include <core/messaging/bus/message_bus.hpp>
+#include <core/messaging/history/history_repo.hpp>
 #include <core/messaging/mailbox/mailbox_registry.hpp>
 #include <core/messaging/message.hpp>
 
-namespace NChat::NCore {
+#include <unordered_map>
+#include <vector>
 
-struct TSendStatus {
-  std::size_t Successful = 0;
-  std::size_t Dropped = 0;
-  std::size_t Offline = 0;
-};
+namespace NChat::NCore {
 
 class TMessageRouter {
  public:
-  explicit TMessageRouter(IMailboxRegistry& registry);
+  // recent может быть nullptr: маршрутизация без горячего хвоста истории
+  // bus может быть nullptr: получатели без локального почтового ящика считаются офлайн
+  explicit TMessageRouter(IMailboxRegistry& registry, IRecentMessages* recent = nullptr, IMessageBus* bus = nullptr);
   TSendStatus Route(std::vector<NDomain::TUserId> recipients, NDomain::TMessage message) const;
 
+  // Почтовые ящики получателей резолвятся один раз на весь батч, порядок сообщений сохраняется
+  std::vector<TSendStatus> RouteBatch(std::vector<TRouteTask> batch) const;
+
+ private:
+  static void Deliver(const TMailboxPtr& mailbox, NDomain::TMessage&& message, TSendStatus& status);
+
+  // Получатели, которых нет на этом узле, уходят в шину одной пачкой
+  void ForwardRemote(std::vector<TRouteTask> remote, const std::vector<std::size_t>& positions,
+                     std::vector<TSendStatus>& statuses) const;
+
  private:
   IMailboxRegistry& Registry_;
+  IRecentMessages* Recent_;
+  IMessageBus* Bus_;
 };
 
 }  // namespace NChat::NCore
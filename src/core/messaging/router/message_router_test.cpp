@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 using ::testing::_;
+using ::testing::ElementsAre;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::StrictMock;
@@ -20,6 +21,7 @@ class MockMailboxRegistry : public IMailboxRegistry {
   MOCK_METHOD(void, RemoveMailbox, (const NDomain::TUserId&), (override));
   MOCK_METHOD(int64_t, GetOnlineAmount, (), (const, override));
   MOCK_METHOD(void, TraverseRegistry, (std::chrono::milliseconds), (override));
+  MOCK_METHOD(std::size_t, WakeConsumers, (), (override));
   MOCK_METHOD(void, Clear, (), (override));
 };
 
@@ -378,4 +380,150 @@ TEST_F(TMessageRouterTest, DuplicateRecipients) {
   EXPECT_EQ(status.Successful, 2);
 }
 
+// Тест: батч резолвит mailbox каждого получателя один раз
+TEST_F(TMessageRouterTest, RouteBatchResolvesMailboxOnce) {
+  NDomain::TUserId user1{"user1"};
+  NDomain::TUserId user2{"user2"};
+
+  auto [mailbox, mock_sessions] = CreateMailboxWithMock(user1);
+  auto mailbox_ptr = std::make_shared<TUserMailbox>(std::move(mailbox));
+
+  EXPECT_CALL(*registry_, GetMailbox(user1)).WillOnce(Return(mailbox_ptr));
+  EXPECT_CALL(*registry_, GetMailbox(user2)).WillOnce(Return(nullptr));
+  EXPECT_CALL(*mock_sessions, FanOutMessage(_)).WillOnce(Return(true)).WillOnce(Return(false));
+
+  std::vector<TRouteTask> batch;
+  batch.push_back({{user1, user2}, CreateTestMessage("sender1", "chat1", "Hello")});
+  batch.push_back({{user2, user1}, CreateTestMessage("sender1", "chat2", "World")});
+
+  auto statuses = router_->RouteBatch(std::move(batch));
+
+  ASSERT_EQ(statuses.size(), 2);
+  EXPECT_EQ(statuses[0].Successful, 1);
+  EXPECT_EQ(statuses[0].Offline, 1);
+  EXPECT_EQ(statuses[1].Dropped, 1);
+  EXPECT_EQ(statuses[1].Offline, 1);
+}
+
+// Тест: пустой батч
+TEST_F(TMessageRouterTest, RouteBatchEmpty) {
+  auto statuses = router_->RouteBatch({});
+
+  EXPECT_TRUE(statuses.empty());
+}
+
+// Тест: горячий хвост истории получает сообщение, даже если все получатели офлайн
+TEST_F(TMessageRouterTest, RememberedForOfflineRecipients) {
+  StrictMock<MockRecentMessages> recent;
+  TMessageRouter router(*registry_, &recent);
+  NDomain::TUserId user1{"user1"};
+
+  EXPECT_CALL(*registry_, GetMailbox(user1)).Times(2).WillRepeatedly(Return(nullptr));
+  EXPECT_CALL(recent, Remember(_)).Times(3);
+
+  auto status = router.Route({user1}, CreateTestMessage("sender1", "chat1", "Hello"));
+  EXPECT_EQ(status.Offline, 1);
+
+  std::vector<TRouteTask> batch;
+  batch.push_back({{user1}, CreateTestMessage("sender1", "chat1", "one")});
+  batch.push_back({{user1}, CreateTestMessage("sender1", "chat1", "two")});
+  router.RouteBatch(std::move(batch));
+}
+
+// Тест: получатели без локального почтового ящика уходят в шину, сообщение доставляется и локально
+TEST_F(TMessageRouterTest, RemoteRecipientsForwardedToBus) {
+  StrictMock<MockMessageBus> bus;
+  TMessageRouter router(*registry_, nullptr, &bus);
+  NDomain::TUserId user1{"user1"};
+  NDomain::TUserId user2{"user2"};
+  NDomain::TUserId user3{"user3"};
+
+  auto [mailbox, mock_sessions] = CreateMailboxWithMock(user3);
+  auto mailbox_ptr = std::make_shared<TUserMailbox>(std::move(mailbox));
+
+  EXPECT_CALL(*registry_, GetMailbox(user1)).WillOnce(Return(nullptr));
+  EXPECT_CALL(*registry_, GetMailbox(user2)).WillOnce(Return(nullptr));
+  EXPECT_CALL(*registry_, GetMailbox(user3)).WillOnce(Return(mailbox_ptr));
+  EXPECT_CALL(*mock_sessions, FanOutMessage(_)).WillOnce(Return(true));
+
+  EXPECT_CALL(bus, Forward(_)).WillOnce([](std::vector<TRouteTask> batch) {
+    EXPECT_EQ(batch.size(), 1);
+    EXPECT_THAT(batch[0].Recipients, ElementsAre(NDomain::TUserId{"user1"}, NDomain::TUserId{"user2"}));
+    EXPECT_EQ(batch[0].Message.Payload->Text.Value(), "Hello");
+    return std::vector<TSendStatus>{{.Offline = 1, .Forwarded = 1}};
+  });
+
+  auto status = router.Route({user1, user2, user3}, CreateTestMessage("sender1", "chat1", "Hello"));
+
+  EXPECT_EQ(status.Successful, 1);
+  EXPECT_EQ(status.Forwarded, 1);
+  EXPECT_EQ(status.Offline, 1);
+  EXPECT_EQ(status.Dropped, 0);
+}
+
+// Тест: батч пересылается в шину одним вызовом, статусы возвращаются на свои позиции
+TEST_F(TMessageRouterTest, RouteBatchForwardsRemoteOnce) {
+  StrictMock<MockMessageBus> bus;
+  TMessageRouter router(*registry_, nullptr, &bus);
+  NDomain::TUserId local{"local"};
+  NDomain::TUserId remote{"remote"};
+
+  auto [mailbox, mock_sessions] = CreateMailboxWithMock(local);
+  auto mailbox_ptr = std::make_shared<TUserMailbox>(std::move(mailbox));
+
+  EXPECT_CALL(*registry_, GetMailbox(local)).WillOnce(Return(mailbox_ptr));
+  EXPECT_CALL(*registry_, GetMailbox(remote)).WillOnce(Return(nullptr));
+  EXPECT_CALL(*mock_sessions, FanOutMessage(_)).Times(2).WillRepeatedly(Return(true));
+
+  EXPECT_CALL(bus, Forward(_)).WillOnce([](std::vector<TRouteTask> batch) {
+    EXPECT_EQ(batch.size(), 2);
+    EXPECT_EQ(batch[0].Message.Payload->Text.Value(), "one");
+    EXPECT_EQ(batch[1].Message.Payload->Text.Value(), "three");
+    return std::vector<TSendStatus>{{.Forwarded = 1}, {.Dropped = 1}};
+  });
+
+  std::vector<TRouteTask> batch;
+  batch.push_back({{local, remote}, CreateTestMessage("sender1", "chat1", "one")});
+  batch.push_back({{local}, CreateTestMessage("sender1", "chat1", "two")});
+  batch.push_back({{remote}, CreateTestMessage("sender1", "chat1", "three")});
+
+  auto statuses = router.RouteBatch(std::move(batch));
+
+  ASSERT_EQ(statuses.size(), 3);
+  EXPECT_EQ(statuses[0].Successful, 1);
+  EXPECT_EQ(statuses[0].Forwarded, 1);
+  EXPECT_EQ(statuses[1].Successful, 1);
+  EXPECT_EQ(statuses[1].Forwarded, 0);
+  EXPECT_EQ(statuses[2].Dropped, 1);
+}
+
+// Тест: заполненность очередей получателей возвращается отправителю
+TEST_F(TMessageRouterTest, SaturatedRecipientsReported) {
+  NDomain::TUserId calm{"calm"};
+  NDomain::TUserId busy{"busy"};
+  NDomain::TUserId full{"full"};
+  auto [calm_mailbox, calm_sessions] = CreateMailboxWithMock(calm);
+  auto [busy_mailbox, busy_sessions] = CreateMailboxWithMock(busy);
+  auto [full_mailbox, full_sessions] = CreateMailboxWithMock(full);
+
+  EXPECT_CALL(*registry_, GetMailbox(calm)).WillOnce(Return(std::make_shared<TUserMailbox>(std::move(calm_mailbox))));
+  EXPECT_CALL(*registry_, GetMailbox(busy)).WillOnce(Return(std::make_shared<TUserMailbox>(std::move(busy_mailbox))));
+  EXPECT_CALL(*registry_, GetMailbox(full)).WillOnce(Return(std::make_shared<TUserMailbox>(std::move(full_mailbox))));
+
+  EXPECT_CALL(*calm_sessions, FanOutMessage(_)).WillOnce(Return(true));
+  EXPECT_CALL(*calm_sessions, GetFillRatio()).WillOnce(Return(0.1));
+  EXPECT_CALL(*busy_sessions, FanOutMessage(_)).WillOnce(Return(true));
+  EXPECT_CALL(*busy_sessions, GetFillRatio()).WillOnce(Return(0.9));
+  // Недоставленное сообщение насыщает получателя без запроса заполненности
+  EXPECT_CALL(*full_sessions, FanOutMessage(_)).WillOnce(Return(false));
+  EXPECT_CALL(*full_sessions, GetFillRatio()).Times(0);
+
+  auto status = router_->Route({calm, busy, full}, CreateTestMessage("sender1", "chat1", "Hello"));
+
+  EXPECT_EQ(status.Successful, 2);
+  EXPECT_EQ(status.Dropped, 1);
+  EXPECT_EQ(status.Saturated, 2);
+  EXPECT_DOUBLE_EQ(status.MaxFillRatio, 1.0);
+}
+
 }  // namespace NChat::NCore
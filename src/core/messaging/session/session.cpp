@@ -1,5 +1,9 @@
 #include "session.hpp"
 
+#include <utils/memory/memory_budget.hpp>
+
+#include <algorithm>
+
 namespace NChat::NCore {
 
 TUserSession::TUserSession(NDomain::TSessionId session_id, TQueuePtr queue, std::function<TTimePoint()> now)
@@ -11,7 +15,21 @@ TUserSession::TUserSession(NDomain::TSessionId session_id, TQueuePtr queue, std:
   LastConsumerActivity_.store(GetNow_());
 }
 
+TUserSession::~TUserSession() {
+  // Сообщения, оставшиеся в очереди, умирают вместе с сессией
+  NUtils::NMemory::Release(QueuedBytes_.load());
+}
+
 bool TUserSession::PushMessage(NDomain::TMessage message, int max_try_amount) {
+  // Бюджет памяти узла исчерпан: новые обычные сообщения не принимаем, пока GC не сбросит старые
+  if (message.Class == NDomain::EMessageClass::Regular && NUtils::NMemory::IsOverBudget()) {
+    max_try_amount = 0;
+  }
+
+  // Учитываем до Push: поллер может забрать сообщение и вернуть байты раньше, чем Push вернет управление
+  const auto bytes = message.GetFootprint();
+  Charge(bytes);
+
   for (int i = 0; i < max_try_amount; ++i) {
     // Message will only be moved if Push succeeds; on failure it remains unchanged
     if (MessageBus_->Push(std::move(message))) {
@@ -19,6 +37,8 @@ bool TUserSession::PushMessage(NDomain::TMessage message, int max_try_amount) {
     }
   }
 
+  Release(bytes);
+
   // Backpressure due to queue overload
   MissedMessages_.store(true);
 
@@ -30,13 +50,52 @@ TMessages TUserSession::GetMessages(std::size_t max_size, std::chrono::seconds t
   auto result = MessageBus_->PopBatch(max_size, timeout);
   LastConsumerActivity_.store(GetNow_());  // We could sleep in PopBatch
 
-  if (MissedMessages_.exchange(false)) {
+  std::size_t bytes = 0;
+  for (const auto& message : result) {
+    bytes += message.GetFootprint();
+  }
+  Release(bytes);
+
+  const bool queue_missed = MessageBus_->ConsumeMissed();
+  if (MissedMessages_.exchange(false) || queue_missed) {
     return {result, true};
   }
 
   return {result};
 }
 
+std::size_t TUserSession::ShedOldest(std::size_t keep) {
+  const auto shed = MessageBus_->ShedOldest(keep);
+  if (shed.empty()) {
+    return 0;
+  }
+
+  std::size_t bytes = 0;
+  for (const auto& message : shed) {
+    bytes += message.GetFootprint();
+  }
+  Release(bytes);
+  MissedMessages_.store(true);
+
+  return shed.size();
+}
+
+void TUserSession::Charge(std::size_t bytes) {
+  if (MessageBus_->ChargesMemory()) {
+    return;
+  }
+  QueuedBytes_.fetch_add(bytes);
+  NUtils::NMemory::Charge(bytes);
+}
+
+void TUserSession::Release(std::size_t bytes) {
+  if (MessageBus_->ChargesMemory()) {
+    return;
+  }
+  QueuedBytes_.fetch_sub(bytes);
+  NUtils::NMemory::Release(bytes);
+}
+
 bool TUserSession::IsActive(std::chrono::seconds idle_threshold) const {
   return MessageBus_->HasConsumer() || ((GetNow_() - LastConsumerActivity_.load()) <= idle_threshold);
 }
@@ -52,4 +111,13 @@ NDomain::TSessionId TUserSession::GetSessionId() const {
 std::size_t TUserSession::GetSizeApproximate() const {
   return MessageBus_->GetSizeApproximate();
 }
+
+double TUserSession::GetFillRatio() const {
+  const auto max_size = MessageBus_->GetMaxSize();
+  if (max_size == 0) {
+    return 1.0;
+  }
+
+  return std::min(1.0, static_cast<double>(MessageBus_->GetSizeApproximate()) / static_cast<double>(max_size));
+}
 }  // namespace NChat::NCore
@@ -18,15 +18,24 @@ class TUserSession {
   using TTimePoint = std::chrono::steady_clock::time_point;
 
   TUserSession(NDomain::TSessionId session_id, TQueuePtr queue, std::function<TTimePoint()> now);
+  ~TUserSession();
 
   bool PushMessage(NDomain::TMessage message, int max_try_amount = 3);
   TMessages GetMessages(std::size_t max_size, std::chrono::seconds timeout);
+  // Сброс самых старых сообщений при нехватке памяти узла, потребитель получит resync
+  std::size_t ShedOldest(std::size_t keep);
 
   bool IsActive(std::chrono::seconds idle_threshold) const;
   NDomain::TSessionId GetSessionId() const;
   std::size_t GetSizeApproximate() const;
+  // Доля заполнения очереди от 0 до 1
+  double GetFillRatio() const;
   std::chrono::seconds GetLifetimeSeconds() const;
 
+ private:
+  void Charge(std::size_t bytes);
+  void Release(std::size_t bytes);
+
  private:
   NDomain::TSessionId SessionId_;
   TQueuePtr MessageBus_;
@@ -34,6 +43,8 @@ class TUserSession {
   std::function<TTimePoint()> GetNow_;
   std::atomic<TTimePoint> LastConsumerActivity_{};
   std::atomic<bool> MissedMessages_{false};  // True if consumer must resync dropped messages
+  // Байты сообщений в очереди, учтенные в бюджете памяти узла
+  std::atomic<std::size_t> QueuedBytes_{0};
 };
 
 }  // namespace NChat::NCore
@@ -2,10 +2,13 @@
 #include <core/messaging/session/session.hpp>
 #include <core/messaging/value/message_text.hpp>
 
+#include <utils/memory/memory_budget.hpp>
+
 #include <gtest/gtest.h>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
 #include <userver/utils/mock_now.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 #include <chrono>
 
@@ -480,6 +483,74 @@ TEST_F(SessionTest, AlternatingPushAndPoll) {
   EXPECT_FALSE(r3.ResyncRequired);
 }
 
+TEST_F(SessionTest, ShedOldestRequiresResync) {
+  std::vector<NDomain::TMessage> shed(3, CreateTestMessage("sender1", "chat123", "Hello"));
+  EXPECT_CALL(*QueueRaw_, ShedOldest(5)).WillOnce(Return(shed));
+  EXPECT_EQ(Session_->ShedOldest(5), 3);
+
+  std::vector<NDomain::TMessage> empty_result;
+  EXPECT_CALL(*QueueRaw_, PopBatch(_, _)).WillOnce(Return(empty_result));
+
+  EXPECT_TRUE(Session_->GetMessages(10, 1s).ResyncRequired);
+}
+
+TEST_F(SessionTest, OverMemoryBudgetRejectsOnlyRegularMessages) {
+  NUtils::NMemory::Charge(1000);
+  userver::utils::ScopeGuard release([] { NUtils::NMemory::Release(1000); });
+  userver::utils::ScopeGuard restore_budget([budget = NUtils::NMemory::GetBudget()] {
+    NUtils::NMemory::SetBudget(budget);
+  });
+  NUtils::NMemory::SetBudget(1);
+
+  EXPECT_CALL(*QueueRaw_, Push(_)).WillOnce(Return(true));
+
+  EXPECT_FALSE(Session_->PushMessage(CreateTestMessage("sender1", "chat123", "Hello")));
+
+  auto notice = CreateTestMessage("sender1", "chat123", "Member joined");
+  notice.Class = NDomain::EMessageClass::Service;
+  EXPECT_TRUE(Session_->PushMessage(std::move(notice)));
+}
+
+TEST_F(SessionTest, QueuedMessageIsChargedUntilPopped) {
+  const auto before = NUtils::NMemory::GetChargedBytes();
+  const auto message = CreateTestMessage("sender1", "chat123", "Hello");
+
+  EXPECT_CALL(*QueueRaw_, Push(_)).WillOnce(Return(true));
+  EXPECT_TRUE(Session_->PushMessage(message));
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), before + message.GetFootprint());
+
+  EXPECT_CALL(*QueueRaw_, PopBatch(_, _)).WillOnce(Return(std::vector{message}));
+  EXPECT_EQ(Session_->GetMessages(10, 1s).Messages.size(), 1);
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), before);
+}
+
+TEST_F(SessionTest, RejectedMessageIsNotCharged) {
+  const auto before = NUtils::NMemory::GetChargedBytes();
+
+  EXPECT_CALL(*QueueRaw_, Push(_)).WillRepeatedly(Return(false));
+  EXPECT_FALSE(Session_->PushMessage(CreateTestMessage("sender1", "chat123", "Hello")));
+
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), before);
+}
+
+TEST_F(SessionTest, ShedAndDestroyedMessagesAreReleased) {
+  const auto before = NUtils::NMemory::GetChargedBytes();
+  const auto message = CreateTestMessage("sender1", "chat123", "Hello");
+
+  EXPECT_CALL(*QueueRaw_, Push(_)).WillRepeatedly(Return(true));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(Session_->PushMessage(message));
+  }
+
+  EXPECT_CALL(*QueueRaw_, ShedOldest(1)).WillOnce(Return(std::vector(2, message)));
+  EXPECT_EQ(Session_->ShedOldest(1), 2);
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), before + message.GetFootprint());
+
+  // Оставшееся в очереди возвращается в бюджет вместе с сессией
+  Session_.reset();
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), before);
+}
+
 // ============================================================================
 // Тесты с интеграцией userver datetime (опционально)
 // ============================================================================
@@ -16,6 +16,8 @@ class TSessionLimitExceeded : public std::runtime_error {
 class ISessionsRegistry {
  public:
   virtual bool FanOutMessage(NDomain::TMessage message) = 0;
+  // Заполненность самой загруженной очереди, замеренная последней рассылкой
+  virtual double GetFillRatio() const = 0;
   virtual std::shared_ptr<TUserSession> CreateSession(const NDomain::TSessionId& session_id) = 0;
   virtual std::shared_ptr<TUserSession> GetOrCreateSession(const NDomain::TSessionId& session_id) = 0;
   virtual std::shared_ptr<TUserSession> GetSession(const NDomain::TSessionId& session_id) = 0;
@@ -23,6 +25,7 @@ class ISessionsRegistry {
 
   // Offline cleaning and metrics
   virtual std::size_t CleanIdle() = 0;
+  virtual std::size_t ShedOldest(std::size_t keep) = 0;
   virtual bool HasNoConsumer() const = 0;
   virtual std::size_t GetOnlineAmount() const = 0;
 
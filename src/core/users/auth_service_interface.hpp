@@ -1,21 +1,30 @@
 #pragma once
 
 #include <core/common/ids.hpp>
+#include <core/users/profile.hpp>
 #include <core/users/value/hash_password.hpp>
 
 #include <optional>
+#include <stdexcept>
 #include <string>
 
 namespace NChat::NCore {
 
+// Password hashing is CPU-heavy and admission-limited, caller should retry later
+class TAuthServiceOverloaded : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
 class IAuthService {
  public:
   virtual NDomain::TPasswordHash HashPassword(std::string_view password) = 0;
   virtual bool CheckPassword(std::string_view input_password, std::string_view stored_password_hash,
                              std::string_view password_salt) = 0;
 
-  virtual std::string CreateJwt(NDomain::TUserId id) = 0;
-  virtual std::optional<NDomain::TUserId> DecodeJwt(std::string_view token) = 0;
+  // Profile is embedded into claims, so token checking does not need a profile lookup
+  virtual std::string CreateJwt(const NDomain::TUserTinyProfile& profile) = 0;
+  virtual std::optional<NDomain::TUserTinyProfile> DecodeJwt(std::string_view token) = 0;
 
   virtual ~IAuthService() = default;
 };
@@ -4,12 +4,17 @@
 #include <core/users/value/display_name.hpp>
 #include <core/users/value/username.hpp>
 
+#include <chrono>
+#include <string>
+
 namespace NChat::NCore::NDomain {
 
 struct TUserTinyProfile {
   TUserId Id;
   std::string Username;
   std::string DisplayName;
+  // Profile version: updated_at of the row the profile was read from, epoch if unknown
+  std::chrono::system_clock::time_point UpdatedAt{};
 };
 
 }  // namespace NChat::NCore::NDomain
@@ -12,6 +12,7 @@ TUser::TUser(TUserId user_id, const TUsername& username, const TDisplayName& nam
 
 TUser::TUser(TUserData data)
     : TUser(TUserId{data.UserId}, data.Username, data.DisplayName, data.PasswordHash, data.Salt, data.Biography) {
+  UpdatedAt_ = data.UpdatedAt;
 }
 
 TUser::TUser(TUserId user_id, std::string username, std::string display_name, std::string password_hash,
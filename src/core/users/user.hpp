@@ -7,6 +7,7 @@
 #include <core/users/value/hash_password.hpp>
 #include <core/users/value/username.hpp>
 
+#include <chrono>
 #include <string>
 
 namespace NChat::NCore::NDomain {
@@ -23,6 +24,7 @@ struct TUserData final {
   std::string PasswordHash;
   std::string Salt;
   std::string Biography;
+  std::chrono::system_clock::time_point UpdatedAt{};
 };
 
 class TUser {
@@ -52,6 +54,9 @@ class TUser {
   const std::string& GetBiography() const {
     return Biography_;
   }
+  std::chrono::system_clock::time_point GetUpdatedAt() const {
+    return UpdatedAt_;
+  }
 
   // Update methods
   void UpdateDisplayName(const TDisplayName& display_name);
@@ -77,6 +82,7 @@ class TUser {
   std::string PasswordHash_;
   std::string PasswordSalt_;
   std::string Biography_;
+  std::chrono::system_clock::time_point UpdatedAt_{};
   // fixme Заменить на Value Objects, порефакторить их
 };
 
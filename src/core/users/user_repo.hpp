@@ -3,7 +3,10 @@
 #include <core/users/profile.hpp>
 #include <core/users/user.hpp>
 
+#include <chrono>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace NChat::NCore {
 
@@ -30,7 +33,20 @@ class IUserRepository {
   virtual std::string UpdateUser(const TUsername& username_to_update, const TUserUpdateParams& params) const = 0;
 
   virtual std::optional<TUserId> FindByUsername(std::string_view username) const = 0;
+  // In-memory only: a user registered after the last cache update is not found
+  virtual std::optional<TUserId> FindCachedByUsername(std::string_view username) const = 0;
   virtual std::optional<TUserTinyProfile> GetProfileById(const TUserId& id) const = 0;
+  // One cache snapshot for all ids and at most one query for the misses; unknown and deleted users are absent
+  virtual std::unordered_map<TUserId, TUserTinyProfile> GetProfilesByIds(const std::vector<TUserId>& ids) const = 0;
+
+  struct TCachedProfile {
+    std::optional<TUserTinyProfile> Profile;
+    // Newest updated_at seen by the cache: every profile updated before it is already in the cache
+    std::chrono::system_clock::time_point Watermark{};
+  };
+
+  // In-memory only, never goes to the database
+  virtual TCachedProfile GetCachedProfileById(const TUserId& id) const = 0;
   virtual std::unique_ptr<TUser> GetUserByUsername(std::string_view username) const = 0;
 
   virtual ~IUserRepository() = default;
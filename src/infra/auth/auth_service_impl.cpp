@@ -1,45 +1,94 @@
 #include "auth_service_impl.hpp"
 
-#include <utils/jwt/jwt.hpp>
-
 #include <fmt/format.h>
-#include <userver/crypto/hash.hpp>
 #include <userver/crypto/random.hpp>
+#include <userver/logging/log.hpp>
+
+#include <stdexcept>
 
 namespace NChat::NInfra {
 using NCore::NDomain::TPasswordHash;
 using NCore::NDomain::TUserId;
+using NCore::NDomain::TUserTinyProfile;
 
-TAuthServiceImpl::TAuthServiceImpl(int expiry_duration_hours, std::size_t salt_length)
-    : ExpiryDuration_(expiry_duration_hours), SaltLength_(salt_length) {
+TAuthServiceImpl::TAuthServiceImpl(int expiry_duration_hours, std::size_t salt_length, const TJwtCodec* jwt_codec,
+                                   TVerifiedTokenCache* token_cache, NKdf::TKdfSettings kdf,
+                                   TAuthExecutor* executor)
+    : ExpiryDuration_(expiry_duration_hours),
+      SaltLength_(salt_length),
+      JwtCodec_(jwt_codec),
+      TokenCache_(token_cache),
+      Kdf_(kdf),
+      Executor_(executor) {
+}
+
+template <typename Func>
+std::invoke_result_t<Func> TAuthServiceImpl::RunKdf(Func&& func) {
+  if (Executor_) {
+    return Executor_->Execute(std::forward<Func>(func));
+  }
+
+  return std::forward<Func>(func)();
 }
 
 TPasswordHash TAuthServiceImpl::HashPassword(std::string_view password) {
   auto salt = userver::crypto::GenerateRandomBlock(SaltLength_);
-  auto combined = fmt::format("{}{}", password, salt);
-  auto hash_password = userver::crypto::hash::Sha256(combined);
+  auto hash_password = RunKdf([&] { return NKdf::DeriveHash(password, salt, Kdf_); });
 
   return {hash_password, salt};
 }
 
 bool TAuthServiceImpl::CheckPassword(std::string_view input_password, std::string_view stored_password_hash,
                                      std::string_view password_salt) {
-  auto salted_password = fmt::format("{}{}", input_password, password_salt);
-  auto computed_hash = userver::crypto::hash::Sha256(salted_password);
-
-  return computed_hash == stored_password_hash;
+  return RunKdf([&] { return NKdf::VerifyHash(input_password, password_salt, stored_password_hash); });
 }
 
-std::string TAuthServiceImpl::CreateJwt(TUserId id) {
-  return NUtils::NTokens::GenerateJWT(id.GetUnderlying(), ExpiryDuration_);
+std::string TAuthServiceImpl::CreateJwt(const TUserTinyProfile& profile) {
+  if (!JwtCodec_) {
+    throw std::logic_error("JWT codec is not configured");
+  }
+
+  const TTokenClaims claims{.Id = profile.Id.GetUnderlying(),
+                            .Username = profile.Username,
+                            .DisplayName = profile.DisplayName,
+                            .ProfileUpdatedAt = profile.UpdatedAt};
+
+  auto token = JwtCodec_->Encode(claims, std::chrono::hours(ExpiryDuration_));
+  if (!token.has_value()) {
+    throw std::runtime_error(fmt::format("Failed to create JWT: {}", ToString(token.error())));
+  }
+
+  return std::move(token.value());
 }
 
-std::optional<TUserId> TAuthServiceImpl::DecodeJwt(std::string_view token) {
-  if (auto user_id = NUtils::NTokens::DecodeJWT(token)) {
-    return TUserId{user_id.value()};
+std::optional<TUserTinyProfile> TAuthServiceImpl::DecodeJwt(std::string_view token) {
+  if (!JwtCodec_) {
+    return std::nullopt;
+  }
+
+  std::string key;
+  if (TokenCache_) {
+    key = TVerifiedTokenCache::MakeKey(token);
+    if (auto profile = TokenCache_->Get(key)) {
+      return profile;
+    }
+  }
+
+  auto claims = JwtCodec_->Decode(token);
+  if (!claims.has_value()) {
+    LOG_DEBUG() << "JWT rejected: " << ToString(claims.error());
+    return std::nullopt;
+  }
+
+  TUserTinyProfile profile{.Id = TUserId{std::move(claims->Id)},
+                           .Username = std::move(claims->Username),
+                           .DisplayName = std::move(claims->DisplayName),
+                           .UpdatedAt = claims->ProfileUpdatedAt};
+  if (TokenCache_) {
+    TokenCache_->Put(key, profile, claims->ExpiresAt);
   }
 
-  return std::nullopt;
+  return profile;
 }
 
 }  // namespace NChat::NInfra
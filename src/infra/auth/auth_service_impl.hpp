@@ -2,23 +2,42 @@
 
 #include <core/users/auth_service_interface.hpp>
 
+#include <infra/auth/executor/auth_executor.hpp>
+#include <infra/auth/jwt/jwt_codec.hpp>
+#include <infra/auth/password/kdf.hpp>
+#include <infra/auth/token_cache/token_cache.hpp>
+
 namespace NChat::NInfra {
 
 class TAuthServiceImpl : public NCore::IAuthService {
  public:
   using TUserId = NCore::NDomain::TUserId;
+  using TUserTinyProfile = NCore::NDomain::TUserTinyProfile;
 
-  TAuthServiceImpl(int expiry_duration_hours = 1, std::size_t salt_length = 32);
+  // Without jwt_codec only password methods are available.
+  // token_cache is optional, without it every token is verified.
+  // executor is optional, without it KDF runs on the caller's task processor
+  TAuthServiceImpl(int expiry_duration_hours = 1, std::size_t salt_length = 32, const TJwtCodec* jwt_codec = nullptr,
+                   TVerifiedTokenCache* token_cache = nullptr, NKdf::TKdfSettings kdf = {},
+                   TAuthExecutor* executor = nullptr);
 
   NCore::NDomain::TPasswordHash HashPassword(std::string_view password) override;
   bool CheckPassword(std::string_view password, std::string_view password_hash, std::string_view salt) override;
 
-  std::string CreateJwt(TUserId id) override;
-  std::optional<TUserId> DecodeJwt(std::string_view token) override;
+  std::string CreateJwt(const TUserTinyProfile& profile) override;
+  std::optional<TUserTinyProfile> DecodeJwt(std::string_view token) override;
+
+ private:
+  template <typename Func>
+  std::invoke_result_t<Func> RunKdf(Func&& func);
 
  private:
   int ExpiryDuration_ = 0;
   std::size_t SaltLength_ = 0;
+  const TJwtCodec* JwtCodec_ = nullptr;
+  TVerifiedTokenCache* TokenCache_ = nullptr;
+  NKdf::TKdfSettings Kdf_;
+  TAuthExecutor* Executor_ = nullptr;
 };
 
 }  // namespace NChat::NInfra
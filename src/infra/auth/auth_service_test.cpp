@@ -1,5 +1,8 @@
 #include "auth_service_impl.hpp"
 
+#include <fmt/format.h>
+#include <userver/crypto/hash.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/utest/utest.hpp>
 
 #include <thread>
@@ -7,10 +10,16 @@
 namespace NChat::NInfra::Tests {
 
 using NCore::NDomain::TUserId;
+using NCore::NDomain::TUserTinyProfile;
+
+inline TJwtCodecSettings MakeTestJwtSettings() {
+  return {.Issuer = "realtime-chat", .Keys = {{.Kid = "test", .Secret = "test_secret"}}, .SigningKid = "test"};
+}
 
 class AuthServiceImplTest : public testing::Test {
  protected:
-  TAuthServiceImpl auth_service_;
+  TJwtCodec jwt_codec_{MakeTestJwtSettings()};
+  TAuthServiceImpl auth_service_{1, 32, &jwt_codec_, nullptr, {.Pbkdf2Iterations = 1000}};
 
   static constexpr std::string_view kTestPassword = "secure_password_123";
   static constexpr std::string_view kWrongPassword = "wrong_password";
@@ -113,13 +122,13 @@ TEST_F(AuthServiceImplTest, CheckPasswordWithEmptyPassword) {
 // ============ CreateJwt Tests ============
 
 TEST_F(AuthServiceImplTest, CreateJwtReturnsNonEmptyString) {
-  auto token = auth_service_.CreateJwt(TUserId{kTestUserId});
+  auto token = auth_service_.CreateJwt({.Id = TUserId{kTestUserId}});
 
   EXPECT_FALSE(token.empty());
 }
 
 TEST_F(AuthServiceImplTest, CreateJwtReturnsValidJwtFormat) {
-  auto token = auth_service_.CreateJwt(TUserId{kTestUserId});
+  auto token = auth_service_.CreateJwt({.Id = TUserId{kTestUserId}});
 
   // JWT должен содержать три части разделенные точками
   int dot_count = std::count(token.begin(), token.end(), '.');
@@ -127,16 +136,16 @@ TEST_F(AuthServiceImplTest, CreateJwtReturnsValidJwtFormat) {
 }
 
 TEST_F(AuthServiceImplTest, CreateJwtGeneratesDifferentTokensForSameUser) {
-  auto token1 = auth_service_.CreateJwt(TUserId{kTestUserId});
-  auto token2 = auth_service_.CreateJwt(TUserId{kTestUserId});
+  auto token1 = auth_service_.CreateJwt({.Id = TUserId{kTestUserId}});
+  auto token2 = auth_service_.CreateJwt({.Id = TUserId{kTestUserId}});
 
   // Токены должны быть разными (из-за JTI)
   EXPECT_NE(token1, token2);
 }
 
 TEST_F(AuthServiceImplTest, CreateJwtWorksWithDifferentUserIds) {
-  auto token1 = auth_service_.CreateJwt(TUserId{"test"});
-  auto token2 = auth_service_.CreateJwt(TUserId{kTestUserId});
+  auto token1 = auth_service_.CreateJwt({.Id = TUserId{"test"}});
+  auto token2 = auth_service_.CreateJwt({.Id = TUserId{kTestUserId}});
 
   EXPECT_FALSE(token1.empty());
   EXPECT_FALSE(token2.empty());
@@ -147,12 +156,12 @@ TEST_F(AuthServiceImplTest, CreateJwtWorksWithDifferentUserIds) {
 
 TEST_F(AuthServiceImplTest, DecodeJwtReturnsOriginalUserIdForValidToken) {
   TUserId original_id{kTestUserId};
-  auto token = auth_service_.CreateJwt(original_id);
+  auto token = auth_service_.CreateJwt({.Id = original_id});
 
   auto decoded_id = auth_service_.DecodeJwt(token);
 
   ASSERT_TRUE(decoded_id.has_value());
-  EXPECT_EQ(decoded_id.value(), original_id);
+  EXPECT_EQ(decoded_id->Id, original_id);
 }
 
 TEST_F(AuthServiceImplTest, DecodeJwtReturnsNulloptForInvalidToken) {
@@ -178,14 +187,28 @@ TEST_F(AuthServiceImplTest, DecodeJwtRoundtripMultipleUsers) {
 
   for (auto uid : user_ids) {
     TUserId original{uid};
-    auto token = auth_service_.CreateJwt(original);
+    auto token = auth_service_.CreateJwt({.Id = original});
     auto decoded = auth_service_.DecodeJwt(token);
 
     ASSERT_TRUE(decoded.has_value()) << "Failed for user_id: " << uid;
-    EXPECT_EQ(decoded.value(), original);
+    EXPECT_EQ(decoded->Id, original);
   }
 }
 
+TEST_F(AuthServiceImplTest, DecodeJwtReturnsProfileClaims) {
+  const std::chrono::system_clock::time_point updated_at{std::chrono::microseconds{1'700'000'000'123'456}};
+  const TUserTinyProfile profile{
+      .Id = TUserId{kTestUserId}, .Username = "username", .DisplayName = "Display Name", .UpdatedAt = updated_at};
+
+  auto decoded = auth_service_.DecodeJwt(auth_service_.CreateJwt(profile));
+
+  ASSERT_TRUE(decoded.has_value());
+  EXPECT_EQ(decoded->Id, profile.Id);
+  EXPECT_EQ(decoded->Username, profile.Username);
+  EXPECT_EQ(decoded->DisplayName, profile.DisplayName);
+  EXPECT_EQ(decoded->UpdatedAt, profile.UpdatedAt);
+}
+
 // ============ Integration Tests ============
 
 TEST_F(AuthServiceImplTest, FullAuthenticationFlow) {
@@ -198,13 +221,13 @@ TEST_F(AuthServiceImplTest, FullAuthenticationFlow) {
   ASSERT_TRUE(is_password_valid);
 
   // 3. Выдаем JWT
-  auto token = auth_service_.CreateJwt(user_id);
+  auto token = auth_service_.CreateJwt({.Id = user_id});
   ASSERT_FALSE(token.empty());
 
   // 4. Проверяем JWT
   auto decoded_user_id = auth_service_.DecodeJwt(token);
   ASSERT_TRUE(decoded_user_id.has_value());
-  EXPECT_EQ(decoded_user_id.value(), user_id);
+  EXPECT_EQ(decoded_user_id->Id, user_id);
 }
 
 TEST_F(AuthServiceImplTest, TokenValidationAfterFailedPasswordCheck) {
@@ -216,11 +239,75 @@ TEST_F(AuthServiceImplTest, TokenValidationAfterFailedPasswordCheck) {
   EXPECT_FALSE(is_password_valid);
 
   // Даже если не логинились, можно создать токен для другого случая
-  auto token = auth_service_.CreateJwt(user_id);
+  auto token = auth_service_.CreateJwt({.Id = user_id});
   auto decoded = auth_service_.DecodeJwt(token);
 
   ASSERT_TRUE(decoded.has_value());
-  EXPECT_EQ(decoded.value(), user_id);
+  EXPECT_EQ(decoded->Id, user_id);
+}
+
+// ============ DecodeJwt with token cache ============
+
+UTEST(AuthServiceImplCachedTest, RepeatedTokenHitsCache) {
+  TTokenCacheStatistics stats;
+  TVerifiedTokenCache cache(4, 16, stats);
+  TJwtCodec jwt_codec(MakeTestJwtSettings());
+  TAuthServiceImpl auth_service(1, 32, &jwt_codec, &cache);
+
+  const auto token = auth_service.CreateJwt({.Id = TUserId{"test-user-id"}});
+
+  for (int i = 0; i < 3; ++i) {
+    auto decoded = auth_service.DecodeJwt(token);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->Id.GetUnderlying(), "test-user-id");
+  }
+
+  EXPECT_EQ(stats.misses_total.Load().value, 1);
+  EXPECT_EQ(stats.hits_total.Load().value, 2);
+}
+
+UTEST(AuthServiceImplCachedTest, InvalidTokenIsNotCached) {
+  TTokenCacheStatistics stats;
+  TVerifiedTokenCache cache(4, 16, stats);
+  TJwtCodec jwt_codec(MakeTestJwtSettings());
+  TAuthServiceImpl auth_service(1, 32, &jwt_codec, &cache);
+
+  EXPECT_FALSE(auth_service.DecodeJwt("not.a.valid.token").has_value());
+  EXPECT_FALSE(auth_service.DecodeJwt("not.a.valid.token").has_value());
+
+  EXPECT_EQ(cache.GetSize(), 0);
+  EXPECT_EQ(stats.hits_total.Load().value, 0);
+}
+
+// ============ Password hashing on auth executor ============
+
+UTEST(AuthServiceImplExecutorTest, HashesOnExecutor) {
+  TAuthExecutorStatistics stats;
+  TAuthExecutor executor(userver::engine::current_task::GetTaskProcessor(), 1, 4, stats);
+  TAuthServiceImpl auth_service(1, 32, nullptr, nullptr, {.Pbkdf2Iterations = 1000}, &executor);
+
+  auto password = auth_service.HashPassword("password");
+
+  EXPECT_TRUE(auth_service.CheckPassword("password", password.GetHash(), password.GetSalt()));
+  EXPECT_FALSE(auth_service.CheckPassword("Password", password.GetHash(), password.GetSalt()));
+  EXPECT_EQ(stats.queue_wait_ms_hist.GetView().GetTotalCount(), 3);
+  EXPECT_EQ(stats.kdf_duration_ms_hist.GetView().GetTotalCount(), 3);
+}
+
+TEST_F(AuthServiceImplTest, CheckPasswordAcceptsLegacySha256Hash) {
+  const std::string salt = "legacy_salt";
+  const auto legacy_hash = userver::crypto::hash::Sha256(fmt::format("{}{}", kTestPassword, salt));
+
+  EXPECT_TRUE(auth_service_.CheckPassword(kTestPassword, legacy_hash, salt));
+  EXPECT_FALSE(auth_service_.CheckPassword(kWrongPassword, legacy_hash, salt));
+}
+
+TEST(AuthServiceImplNoCodecTest, JwtIsUnavailableWithoutCodec) {
+  TAuthServiceImpl auth_service;
+
+  EXPECT_THROW(auth_service.CreateJwt({.Id = TUserId{"test-user-id"}}), std::logic_error);
+  EXPECT_FALSE(auth_service.DecodeJwt("header.payload.signature").has_value());
+  EXPECT_FALSE(auth_service.HashPassword("password").GetHash().empty());
 }
 
 }  // namespace NChat::NInfra::Tests
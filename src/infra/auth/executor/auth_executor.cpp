@@ -0,0 +1,33 @@
+#include "auth_executor.hpp"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+
+namespace NChat::NInfra {
+
+TAuthExecutor::TAuthExecutor(userver::engine::TaskProcessor& task_processor, std::size_t max_concurrency,
+                             std::size_t max_queue, TAuthExecutorStatistics& stats)
+    : TaskProcessor_(task_processor), Slots_(max_concurrency), MaxQueue_(max_queue), Stats_(stats) {
+  if (max_concurrency == 0) {
+    throw std::invalid_argument("Auth executor concurrency must be positive");
+  }
+}
+
+void TAuthExecutor::Admit() {
+  const auto queued = Queued_.fetch_add(1, std::memory_order_relaxed);
+  if (queued >= MaxQueue_) {
+    Queued_.fetch_sub(1, std::memory_order_relaxed);
+    ++Stats_.rejected_total;
+    throw NCore::TAuthServiceOverloaded(fmt::format("Auth queue is full: {} waiting", queued));
+  }
+
+  Stats_.queued_current.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TAuthExecutor::Dequeue() noexcept {
+  Queued_.fetch_sub(1, std::memory_order_relaxed);
+  Stats_.queued_current.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "metrics/auth_executor_stats.hpp"
+
+#include <core/users/auth_service_interface.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+
+namespace NChat::NInfra {
+
+/*
+Runs password hashing on a dedicated task processor, so KDF does not eat main-task-processor threads.
+At most max_concurrency functions run at once, at most max_queue callers wait for a slot.
+Callers above the queue limit are rejected with TAuthServiceOverloaded instead of piling up.
+*/
+class TAuthExecutor final {
+ public:
+  TAuthExecutor(userver::engine::TaskProcessor& task_processor, std::size_t max_concurrency, std::size_t max_queue,
+                TAuthExecutorStatistics& stats);
+
+  template <typename Func>
+  std::invoke_result_t<Func> Execute(Func&& func);
+
+ private:
+  void Admit();
+  void Dequeue() noexcept;
+
+ private:
+  using TClock = std::chrono::steady_clock;
+
+  userver::engine::TaskProcessor& TaskProcessor_;
+  userver::engine::Semaphore Slots_;
+  const std::size_t MaxQueue_;
+  std::atomic<std::size_t> Queued_{0};
+  TAuthExecutorStatistics& Stats_;
+};
+
+template <typename Func>
+std::invoke_result_t<Func> TAuthExecutor::Execute(Func&& func) {
+  Admit();
+  const auto enqueued_at = TClock::now();
+
+  userver::utils::FastScopeGuard dequeue([this]() noexcept { Dequeue(); });
+  std::shared_lock slot(Slots_);
+  dequeue.Release();
+  Dequeue();
+
+  auto task = userver::engine::AsyncNoSpan(TaskProcessor_, [this, enqueued_at, &func]() {
+    const auto started_at = TClock::now();
+    Stats_.queue_wait_ms_hist.Account(
+        std::chrono::duration_cast<std::chrono::milliseconds>(started_at - enqueued_at).count());
+
+    Stats_.running_current.fetch_add(1, std::memory_order_relaxed);
+    userver::utils::FastScopeGuard account([this, started_at]() noexcept {
+      Stats_.running_current.fetch_sub(1, std::memory_order_relaxed);
+      Stats_.kdf_duration_ms_hist.Account(
+          std::chrono::duration_cast<std::chrono::milliseconds>(TClock::now() - started_at).count());
+    });
+
+    return std::forward<Func>(func)();
+  });
+
+  return task.Get();
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,63 @@
+#include "auth_executor.hpp"
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <stdexcept>
+
+using namespace NChat::NInfra;
+
+namespace {
+void YieldUntil(const std::atomic<std::size_t>& counter, std::size_t expected) {
+  while (counter.load() != expected) {
+    userver::engine::Yield();
+  }
+}
+}  // namespace
+
+UTEST(AuthExecutor, ReturnsResult) {
+  TAuthExecutorStatistics stats;
+  TAuthExecutor executor(userver::engine::current_task::GetTaskProcessor(), 2, 2, stats);
+
+  EXPECT_EQ(executor.Execute([] { return 42; }), 42);
+  EXPECT_EQ(stats.queued_current.load(), 0);
+  EXPECT_EQ(stats.running_current.load(), 0);
+  EXPECT_EQ(stats.rejected_total.Load().value, 0);
+}
+
+UTEST(AuthExecutor, PropagatesException) {
+  TAuthExecutorStatistics stats;
+  TAuthExecutor executor(userver::engine::current_task::GetTaskProcessor(), 1, 1, stats);
+
+  EXPECT_THROW(executor.Execute([]() -> int { throw std::runtime_error("kdf failed"); }), std::runtime_error);
+  EXPECT_EQ(stats.running_current.load(), 0);
+}
+
+UTEST(AuthExecutor, RejectsAboveQueueLimit) {
+  TAuthExecutorStatistics stats;
+  TAuthExecutor executor(userver::engine::current_task::GetTaskProcessor(), 1, 1, stats);
+  userver::engine::SingleConsumerEvent release{userver::engine::SingleConsumerEvent::NoAutoReset{}};
+
+  auto blocking = [&] {
+    return executor.Execute([&] { return release.WaitForEvent(); });
+  };
+
+  auto running = userver::engine::AsyncNoSpan(blocking);
+  YieldUntil(stats.running_current, 1);
+
+  auto queued = userver::engine::AsyncNoSpan(blocking);
+  YieldUntil(stats.queued_current, 1);
+
+  EXPECT_THROW(executor.Execute([] { return true; }), NChat::NCore::TAuthServiceOverloaded);
+  EXPECT_EQ(stats.rejected_total.Load().value, 1);
+
+  release.Send();
+  EXPECT_TRUE(running.Get());
+  EXPECT_TRUE(queued.Get());
+
+  EXPECT_EQ(stats.queued_current.load(), 0);
+  EXPECT_EQ(executor.Execute([] { return 1; }), 1);
+}
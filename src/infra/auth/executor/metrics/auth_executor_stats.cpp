@@ -0,0 +1,21 @@
+#include "auth_executor_stats.hpp"
+
+#include <userver/utils/statistics/writer.hpp>
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TAuthExecutorStatistics& stats) {
+  writer["queued"]["current"] = stats.queued_current.load(std::memory_order_relaxed);
+  writer["running"]["current"] = stats.running_current.load(std::memory_order_relaxed);
+  writer["rejected"]["total"] = stats.rejected_total;
+  writer["queue_wait"]["ms"]["hist"] = stats.queue_wait_ms_hist;
+  writer["kdf"]["duration"]["ms"]["hist"] = stats.kdf_duration_ms_hist;
+}
+
+void ResetMetric(TAuthExecutorStatistics& stats) {
+  stats.queued_current = 0;
+  stats.running_current = 0;
+  stats.rejected_total.Store({0});
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <atomic>
+
+namespace NChat::NInfra {
+
+struct TAuthExecutorStatistics {
+  std::atomic<std::size_t> queued_current{0};
+  std::atomic<std::size_t> running_current{0};
+  userver::utils::statistics::RateCounter rejected_total{0};
+  userver::utils::statistics::Histogram queue_wait_ms_hist{{1, 5, 10, 25, 50, 100, 250, 500, 1000}};
+  userver::utils::statistics::Histogram kdf_duration_ms_hist{{1, 5, 10, 25, 50, 100, 250, 500, 1000}};
+};
+
+inline const userver::utils::statistics::MetricTag<TAuthExecutorStatistics> kAuthExecutorTag{"chat_auth_executor"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TAuthExecutorStatistics& stats);
+void ResetMetric(TAuthExecutorStatistics& stats);
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,216 @@
+#include "jwt_codec.hpp"
+
+#include <jwt-cpp/jwt.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <stdexcept>
+
+namespace NChat::NInfra {
+
+namespace {
+
+using TJsonTraits = jwt::traits::kazuho_picojson;
+using TVerifier = jwt::verifier<jwt::default_clock, TJsonTraits>;
+using TDecodedJwt = jwt::decoded_jwt<TJsonTraits>;
+
+constexpr std::size_t kMaxTokenLength = 8192;
+
+constexpr std::string_view kUsernameClaim = "username";
+constexpr std::string_view kDisplayNameClaim = "name";
+// Profile version, microseconds since epoch
+constexpr std::string_view kProfileVersionClaim = "pver";
+
+std::string GenerateRandomJti() {
+  static thread_local std::mt19937_64 rng{std::random_device{}()};
+  return std::to_string(rng());
+}
+
+bool IsBase64UrlChar(char c) {
+  return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_' ||
+         c == '=';
+}
+
+// Cheap structural check, so a flood of garbage never reaches base64/JSON parsing and exceptions
+bool LooksLikeJwt(std::string_view token) {
+  if (token.empty() || token.size() > kMaxTokenLength) {
+    return false;
+  }
+
+  const auto first_dot = token.find('.');
+  if (first_dot == std::string_view::npos || first_dot == 0) {
+    return false;
+  }
+
+  const auto second_dot = token.find('.', first_dot + 1);
+  if (second_dot == std::string_view::npos || second_dot == first_dot + 1 || second_dot + 1 == token.size()) {
+    return false;
+  }
+
+  return std::all_of(token.begin(), token.end(), [](char c) { return c == '.' || IsBase64UrlChar(c); }) &&
+         std::count(token.begin(), token.end(), '.') == 2;
+}
+
+const TJwtKey& FindSigningKey(const TJwtCodecSettings& settings) {
+  if (settings.Keys.empty()) {
+    throw std::invalid_argument("JWT codec requires at least one key");
+  }
+
+  if (settings.SigningKid.empty() && settings.Keys.size() == 1) {
+    return settings.Keys.front();
+  }
+
+  auto it = std::find_if(settings.Keys.begin(), settings.Keys.end(),
+                         [&settings](const TJwtKey& key) { return key.Kid == settings.SigningKid; });
+  if (it == settings.Keys.end()) {
+    throw std::invalid_argument("JWT signing kid is not in the key list");
+  }
+
+  return *it;
+}
+
+}  // namespace
+
+std::string_view ToString(EJwtError error) {
+  switch (error) {
+    case EJwtError::Malformed:
+      return "malformed";
+    case EJwtError::UnknownKey:
+      return "unknown_key";
+    case EJwtError::InvalidSignature:
+      return "invalid_signature";
+    case EJwtError::Expired:
+      return "expired";
+    case EJwtError::InvalidClaims:
+      return "invalid_claims";
+    case EJwtError::SignFailed:
+      return "sign_failed";
+  }
+
+  return "unknown";
+}
+
+struct TJwtCodec::TImpl {
+  TImpl(const TJwtCodecSettings& settings, const TJwtKey& signing_key)
+      : Issuer(settings.Issuer), SigningKid(signing_key.Kid), Signer(signing_key.Secret) {
+    for (const auto& key : settings.Keys) {
+      Verifiers.emplace(key.Kid, jwt::verify().allow_algorithm(jwt::algorithm::hs256{key.Secret}).with_issuer(Issuer));
+    }
+  }
+
+  std::string Issuer;
+  std::string SigningKid;
+  jwt::algorithm::hs256 Signer;
+  std::unordered_map<std::string, TVerifier> Verifiers;
+};
+
+TJwtCodec::TJwtCodec(TJwtCodecSettings settings)
+    : Impl_(std::make_unique<TImpl>(settings, FindSigningKey(settings))) {
+}
+
+TJwtCodec::~TJwtCodec() = default;
+
+std::expected<std::string, EJwtError> TJwtCodec::Encode(std::string_view id, std::chrono::seconds ttl) const {
+  return Encode(TTokenClaims{.Id = std::string(id)}, ttl);
+}
+
+std::expected<std::string, EJwtError> TJwtCodec::Encode(const TTokenClaims& claims, std::chrono::seconds ttl) const {
+  const auto now = std::chrono::system_clock::now();
+
+  auto builder = jwt::create()
+                     .set_issuer(Impl_->Issuer)
+                     .set_type("JWT")
+                     .set_key_id(Impl_->SigningKid)
+                     .set_issued_at(now)
+                     .set_expires_at(now + ttl)
+                     .set_payload_claim("id", jwt::claim(claims.Id))
+                     .set_payload_claim("jti", jwt::claim(GenerateRandomJti()));
+
+  if (!claims.Username.empty()) {
+    const auto version =
+        std::chrono::duration_cast<std::chrono::microseconds>(claims.ProfileUpdatedAt.time_since_epoch()).count();
+
+    builder.set_payload_claim(std::string(kUsernameClaim), jwt::claim(claims.Username))
+        .set_payload_claim(std::string(kDisplayNameClaim), jwt::claim(claims.DisplayName))
+        .set_payload_claim(std::string(kProfileVersionClaim), jwt::claim(picojson::value(std::int64_t{version})));
+  }
+
+  std::error_code ec;
+  auto token = builder.sign(Impl_->Signer, ec);
+
+  if (ec) {
+    return std::unexpected(EJwtError::SignFailed);
+  }
+
+  return token;
+}
+
+std::expected<TTokenClaims, EJwtError> TJwtCodec::Decode(std::string_view token) const {
+  if (!LooksLikeJwt(token)) {
+    return std::unexpected(EJwtError::Malformed);
+  }
+
+  // jwt-cpp has no non-throwing decode, but only structurally valid tokens get here
+  std::optional<TDecodedJwt> decoded;
+  try {
+    decoded.emplace(jwt::decode(std::string(token)));
+  } catch (const std::exception&) {
+    return std::unexpected(EJwtError::Malformed);
+  }
+
+  const auto& kid = decoded->has_key_id() ? decoded->get_key_id() : Impl_->SigningKid;
+  const auto verifier = Impl_->Verifiers.find(kid);
+  if (verifier == Impl_->Verifiers.end()) {
+    return std::unexpected(EJwtError::UnknownKey);
+  }
+
+  std::error_code ec;
+  verifier->second.verify(*decoded, ec);
+
+  if (ec) {
+    if (ec == jwt::error::token_verification_error::token_expired) {
+      return std::unexpected(EJwtError::Expired);
+    }
+    if (ec.category() == jwt::error::signature_verification_error_category()) {
+      return std::unexpected(EJwtError::InvalidSignature);
+    }
+    return std::unexpected(EJwtError::InvalidClaims);
+  }
+
+  if (!decoded->has_payload_claim("id")) {
+    return std::unexpected(EJwtError::InvalidClaims);
+  }
+
+  const auto id = decoded->get_payload_claim("id");
+  if (id.get_type() != jwt::json::type::string) {
+    return std::unexpected(EJwtError::InvalidClaims);
+  }
+
+  TTokenClaims claims{.Id = id.as_string()};
+  if (decoded->has_expires_at()) {
+    claims.ExpiresAt = decoded->get_expires_at();
+  }
+
+  // Profile claims are optional: a token without them is still valid, the profile is looked up instead
+  const auto& payload = decoded->get_payload_json();
+  const auto username = payload.find(std::string(kUsernameClaim));
+  const auto display_name = payload.find(std::string(kDisplayNameClaim));
+  const auto version = payload.find(std::string(kProfileVersionClaim));
+  if (username != payload.end() && display_name != payload.end() && version != payload.end()) {
+    if (!username->second.is<std::string>() || !display_name->second.is<std::string>() ||
+        !version->second.is<std::int64_t>()) {
+      return std::unexpected(EJwtError::InvalidClaims);
+    }
+
+    claims.Username = username->second.get<std::string>();
+    claims.DisplayName = display_name->second.get<std::string>();
+    claims.ProfileUpdatedAt = std::chrono::system_clock::time_point{
+        std::chrono::microseconds{version->second.get<std::int64_t>()}};
+  }
+
+  return claims;
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <expected>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NChat::NInfra {
+
+struct TJwtKey {
+  std::string Kid;
+  std::string Secret;
+};
+
+struct TJwtCodecSettings {
+  std::string Issuer{"realtime-chat"};
+  std::vector<TJwtKey> Keys;
+  // New tokens are signed with this key, tokens without kid are verified with it too
+  std::string SigningKid;
+};
+
+struct TTokenClaims {
+  std::string Id;
+  // Profile snapshot at issue time, empty for tokens issued without it
+  std::string Username;
+  std::string DisplayName;
+  std::chrono::system_clock::time_point ProfileUpdatedAt{};
+  // Ignored by Encode, it is computed from ttl
+  std::chrono::system_clock::time_point ExpiresAt = std::chrono::system_clock::time_point::max();
+};
+
+enum class EJwtError { Malformed, UnknownKey, InvalidSignature, Expired, InvalidClaims, SignFailed };
+
+std::string_view ToString(EJwtError error);
+
+/*
+HS256 codec with prebuilt signer and verifiers (one per kid) — nothing is constructed per request.
+Several keys can be active at once for rotation. Errors are returned, not thrown.
+*/
+class TJwtCodec final {
+ public:
+  explicit TJwtCodec(TJwtCodecSettings settings);
+  ~TJwtCodec();
+
+  TJwtCodec(const TJwtCodec&) = delete;
+  TJwtCodec& operator=(const TJwtCodec&) = delete;
+
+  std::expected<std::string, EJwtError> Encode(const TTokenClaims& claims, std::chrono::seconds ttl) const;
+  std::expected<std::string, EJwtError> Encode(std::string_view id, std::chrono::seconds ttl) const;
+  std::expected<TTokenClaims, EJwtError> Decode(std::string_view token) const;
+
+ private:
+  struct TImpl;
+  std::unique_ptr<TImpl> Impl_;
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,95 @@
+#include <infra/auth/jwt/jwt_codec.hpp>
+
+#include <benchmark/benchmark.h>
+#include <jwt-cpp/jwt.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace NChat::NInfra;
+
+namespace {
+
+TJwtCodecSettings MakeSettings() {
+  return {.Issuer = "realtime-chat", .Keys = {{.Kid = "main", .Secret = "very_secret_key"}}, .SigningKid = "main"};
+}
+
+std::vector<std::string> MakeGarbageTokens(std::size_t amount) {
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> length(16, 300);
+  std::uniform_int_distribution<int> symbol(33, 126);
+
+  std::vector<std::string> tokens;
+  tokens.reserve(amount);
+  for (std::size_t i = 0; i < amount; ++i) {
+    std::string token(length(rng), ' ');
+    for (auto& c : token) {
+      c = static_cast<char>(symbol(rng));
+    }
+    tokens.push_back(std::move(token));
+  }
+  return tokens;
+}
+
+}  // namespace
+
+// Валидный токен, прекомпилированный верификатор
+void BM_JwtCodec_DecodeValid(benchmark::State& state) {
+  TJwtCodec codec(MakeSettings());
+  const auto token = *codec.Encode("user_id", std::chrono::hours(1));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(codec.Decode(token));
+  }
+}
+BENCHMARK(BM_JwtCodec_DecodeValid);
+
+// Как было: верификатор собирается на каждый запрос, ошибки через исключения
+void BM_JwtCodec_DecodeValidRebuildVerifier(benchmark::State& state) {
+  TJwtCodec codec(MakeSettings());
+  const auto token = *codec.Encode("user_id", std::chrono::hours(1));
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto verifier =
+        jwt::verify().allow_algorithm(jwt::algorithm::hs256{"very_secret_key"}).with_issuer("realtime-chat");
+    auto decoded = jwt::decode(std::string(token));
+    verifier.verify(decoded);
+    benchmark::DoNotOptimize(decoded.get_payload_claim("id").as_string());
+  }
+}
+BENCHMARK(BM_JwtCodec_DecodeValidRebuildVerifier);
+
+// Поток мусорных токенов: отсекаются без base64/JSON и исключений
+void BM_JwtCodec_RejectGarbage(benchmark::State& state) {
+  TJwtCodec codec(MakeSettings());
+  const auto tokens = MakeGarbageTokens(1024);
+
+  std::size_t idx = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(codec.Decode(tokens[idx++ % tokens.size()]));
+  }
+}
+BENCHMARK(BM_JwtCodec_RejectGarbage);
+
+// Худший случай: корректная структура, чужая подпись — полная проверка HMAC
+void BM_JwtCodec_RejectBadSignature(benchmark::State& state) {
+  TJwtCodec codec(MakeSettings());
+  TJwtCodec foreign_codec(
+      {.Issuer = "realtime-chat", .Keys = {{.Kid = "main", .Secret = "attacker_key"}}, .SigningKid = "main"});
+  const auto token = *foreign_codec.Encode("user_id", std::chrono::hours(1));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(codec.Decode(token));
+  }
+}
+BENCHMARK(BM_JwtCodec_RejectBadSignature);
+
+void BM_JwtCodec_Encode(benchmark::State& state) {
+  TJwtCodec codec(MakeSettings());
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(codec.Encode("user_id", std::chrono::hours(1)));
+  }
+}
+BENCHMARK(BM_JwtCodec_Encode);
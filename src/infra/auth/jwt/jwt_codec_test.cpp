@@ -0,0 +1,151 @@
+#include "jwt_codec.hpp"
+
+#include <userver/utest/utest.hpp>
+
+#include <string>
+
+using namespace NChat::NInfra;
+
+namespace {
+
+TJwtCodecSettings MakeSettings(std::string signing_kid = "k1") {
+  return {.Issuer = "realtime-chat",
+          .Keys = {{.Kid = "k1", .Secret = "first_secret"}, {.Kid = "k2", .Secret = "second_secret"}},
+          .SigningKid = std::move(signing_kid)};
+}
+
+}  // namespace
+
+TEST(JwtCodecTest, EncodeAndDecodeSuccess) {
+  TJwtCodec codec(MakeSettings());
+  std::string user_id = "user_12345";
+
+  auto token = codec.Encode(user_id, std::chrono::hours(1));
+  ASSERT_TRUE(token.has_value());
+  ASSERT_FALSE(token->empty());
+
+  auto claims = codec.Decode(*token);
+
+  ASSERT_TRUE(claims.has_value()) << "Token should be successfully decoded";
+  EXPECT_EQ(claims->Id, user_id) << "Decoded ID must match original ID";
+  EXPECT_GT(claims->ExpiresAt, std::chrono::system_clock::now());
+}
+
+TEST(JwtCodecTest, ProfileClaimsRoundTrip) {
+  TJwtCodec codec(MakeSettings());
+  const TTokenClaims original{
+      .Id = "user",
+      .Username = "username",
+      .DisplayName = "Display Name",
+      .ProfileUpdatedAt = std::chrono::system_clock::time_point{std::chrono::microseconds{1'700'000'000'123'456}}};
+
+  auto claims = codec.Decode(*codec.Encode(original, std::chrono::hours(1)));
+
+  ASSERT_TRUE(claims.has_value());
+  EXPECT_EQ(claims->Username, original.Username);
+  EXPECT_EQ(claims->DisplayName, original.DisplayName);
+  EXPECT_EQ(claims->ProfileUpdatedAt, original.ProfileUpdatedAt);
+}
+
+TEST(JwtCodecTest, TokenWithoutProfileClaims) {
+  TJwtCodec codec(MakeSettings());
+
+  auto claims = codec.Decode(*codec.Encode("user", std::chrono::hours(1)));
+
+  ASSERT_TRUE(claims.has_value());
+  EXPECT_TRUE(claims->Username.empty());
+  EXPECT_EQ(claims->ProfileUpdatedAt, std::chrono::system_clock::time_point{});
+}
+
+TEST(JwtCodecTest, DecodeGarbageString) {
+  TJwtCodec codec(MakeSettings());
+
+  auto result = codec.Decode("not.a.valid.token");
+
+  ASSERT_FALSE(result.has_value()) << "Garbage token should be rejected";
+  EXPECT_EQ(result.error(), EJwtError::Malformed);
+}
+
+TEST(JwtCodecTest, DecodeWellFormedGarbage) {
+  TJwtCodec codec(MakeSettings());
+
+  auto result = codec.Decode("aaaa.bbbb.cccc");
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), EJwtError::Malformed);
+}
+
+TEST(JwtCodecTest, HandleEmptyString) {
+  TJwtCodec codec(MakeSettings());
+
+  auto result = codec.Decode("");
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), EJwtError::Malformed);
+}
+
+TEST(JwtCodecTest, SupportsDifferentIDs) {
+  TJwtCodec codec(MakeSettings());
+
+  auto t1 = codec.Encode("admin", std::chrono::hours(1));
+  auto t2 = codec.Encode("guest", std::chrono::hours(1));
+
+  EXPECT_NE(*t1, *t2) << "Tokens for different users must be different";
+  EXPECT_EQ(codec.Decode(*t1)->Id, "admin");
+  EXPECT_EQ(codec.Decode(*t2)->Id, "guest");
+}
+
+TEST(JwtCodecTest, ExpiredTokenIsRejected) {
+  TJwtCodec codec(MakeSettings());
+
+  auto token = codec.Encode("user", std::chrono::seconds(-10));
+  auto result = codec.Decode(*token);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), EJwtError::Expired);
+}
+
+TEST(JwtCodecTest, TamperedSignatureIsRejected) {
+  TJwtCodec codec(MakeSettings());
+
+  auto token = *codec.Encode("user", std::chrono::hours(1));
+  auto& signature_char = token[token.rfind('.') + 1];
+  signature_char = signature_char == 'A' ? 'B' : 'A';
+  auto result = codec.Decode(token);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), EJwtError::InvalidSignature);
+}
+
+TEST(JwtCodecTest, KeyRotation) {
+  TJwtCodec old_codec(MakeSettings("k1"));
+  TJwtCodec new_codec(MakeSettings("k2"));
+
+  // Token signed with the previous key is still accepted while the key is active
+  auto old_token = *old_codec.Encode("user", std::chrono::hours(1));
+  EXPECT_EQ(new_codec.Decode(old_token)->Id, "user");
+
+  // Once the key is dropped, its tokens are rejected
+  TJwtCodec rotated_codec(
+      {.Issuer = "realtime-chat", .Keys = {{.Kid = "k2", .Secret = "second_secret"}}, .SigningKid = "k2"});
+  auto result = rotated_codec.Decode(old_token);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), EJwtError::UnknownKey);
+}
+
+TEST(JwtCodecTest, ForeignSecretIsRejected) {
+  TJwtCodec codec(MakeSettings());
+  TJwtCodec foreign_codec(
+      {.Issuer = "realtime-chat", .Keys = {{.Kid = "k1", .Secret = "other_secret"}}, .SigningKid = "k1"});
+
+  auto result = codec.Decode(*foreign_codec.Encode("user", std::chrono::hours(1)));
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), EJwtError::InvalidSignature);
+}
+
+TEST(JwtCodecTest, InvalidSettings) {
+  EXPECT_THROW(TJwtCodec({.Issuer = "realtime-chat", .Keys = {}, .SigningKid = ""}), std::invalid_argument);
+  EXPECT_THROW(TJwtCodec(MakeSettings("k3")), std::invalid_argument);
+}
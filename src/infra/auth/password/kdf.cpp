@@ -0,0 +1,144 @@
+#include "kdf.hpp"
+
+#include <fmt/format.h>
+#include <userver/crypto/hash.hpp>
+#include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/from_string.hpp>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+
+#include <array>
+#include <optional>
+#include <stdexcept>
+#include <ranges>
+#include <vector>
+
+namespace NChat::NInfra::NKdf {
+
+namespace {
+
+constexpr std::size_t kKeyLength = 32;
+constexpr std::uint64_t kScryptMaxMemory = 256ULL * 1024 * 1024;
+
+constexpr std::string_view kPbkdf2Prefix = "$pbkdf2-sha256$";
+constexpr std::string_view kScryptPrefix = "$scrypt$";
+
+using TKey = std::array<unsigned char, kKeyLength>;
+
+std::optional<TKey> Pbkdf2(std::string_view password, std::string_view salt, std::uint32_t iterations) {
+  TKey key{};
+  const auto ok = PKCS5_PBKDF2_HMAC(password.data(), static_cast<int>(password.size()),
+                                    reinterpret_cast<const unsigned char*>(salt.data()), static_cast<int>(salt.size()),
+                                    static_cast<int>(iterations), EVP_sha256(), static_cast<int>(key.size()),
+                                    key.data());
+  return ok == 1 ? std::optional{key} : std::nullopt;
+}
+
+std::optional<TKey> Scrypt(std::string_view password, std::string_view salt, std::uint64_t n, std::uint32_t r,
+                           std::uint32_t p) {
+  TKey key{};
+  const auto ok = EVP_PBE_scrypt(password.data(), password.size(), reinterpret_cast<const unsigned char*>(salt.data()),
+                                 salt.size(), n, r, p, kScryptMaxMemory, key.data(), key.size());
+  return ok == 1 ? std::optional{key} : std::nullopt;
+}
+
+std::string ToHex(const TKey& key) {
+  return userver::utils::encoding::ToHex(key.data(), key.size());
+}
+
+bool ConstantTimeEquals(std::string_view lhs, std::string_view rhs) {
+  return lhs.size() == rhs.size() && CRYPTO_memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+}
+
+std::vector<std::string_view> SplitParams(std::string_view params) {
+  std::vector<std::string_view> parts;
+  for (auto part : params | std::views::split('$')) {
+    parts.emplace_back(part.begin(), part.end());
+  }
+  return parts;
+}
+
+std::string LegacySha256(std::string_view password, std::string_view salt) {
+  return userver::crypto::hash::Sha256(fmt::format("{}{}", password, salt));
+}
+
+}  // namespace
+
+EKdfType ParseKdfType(std::string_view name) {
+  if (name == "sha256") {
+    return EKdfType::Sha256;
+  }
+  if (name == "pbkdf2-sha256") {
+    return EKdfType::Pbkdf2Sha256;
+  }
+  if (name == "scrypt") {
+    return EKdfType::Scrypt;
+  }
+
+  throw std::invalid_argument(fmt::format("Unknown KDF: {}", name));
+}
+
+std::string DeriveHash(std::string_view password, std::string_view salt, const TKdfSettings& settings) {
+  switch (settings.Type) {
+    case EKdfType::Sha256:
+      return LegacySha256(password, salt);
+
+    case EKdfType::Pbkdf2Sha256: {
+      auto key = Pbkdf2(password, salt, settings.Pbkdf2Iterations);
+      if (!key) {
+        throw std::runtime_error("PBKDF2 failed");
+      }
+      return fmt::format("{}{}${}", kPbkdf2Prefix, settings.Pbkdf2Iterations, ToHex(*key));
+    }
+
+    case EKdfType::Scrypt: {
+      auto key = Scrypt(password, salt, settings.ScryptN, settings.ScryptR, settings.ScryptP);
+      if (!key) {
+        throw std::runtime_error("scrypt failed");
+      }
+      return fmt::format("{}{}${}${}${}", kScryptPrefix, settings.ScryptN, settings.ScryptR, settings.ScryptP,
+                         ToHex(*key));
+    }
+  }
+
+  throw std::invalid_argument("Unknown KDF");
+}
+
+bool VerifyHash(std::string_view password, std::string_view salt, std::string_view stored_hash) {
+  if (!stored_hash.starts_with('$')) {
+    return ConstantTimeEquals(LegacySha256(password, salt), stored_hash);
+  }
+
+  try {
+    if (stored_hash.starts_with(kPbkdf2Prefix)) {
+      // "<iterations>$<hex>"
+      const auto parts = SplitParams(stored_hash.substr(kPbkdf2Prefix.size()));
+      if (parts.size() != 2) {
+        return false;
+      }
+      const auto iterations = userver::utils::FromString<std::uint32_t>(parts[0]);
+      const auto key = Pbkdf2(password, salt, iterations);
+      return key && ConstantTimeEquals(ToHex(*key), parts[1]);
+    }
+
+    if (stored_hash.starts_with(kScryptPrefix)) {
+      // "<N>$<r>$<p>$<hex>"
+      const auto parts = SplitParams(stored_hash.substr(kScryptPrefix.size()));
+      if (parts.size() != 4) {
+        return false;
+      }
+      const auto n = userver::utils::FromString<std::uint64_t>(parts[0]);
+      const auto r = userver::utils::FromString<std::uint32_t>(parts[1]);
+      const auto p = userver::utils::FromString<std::uint32_t>(parts[2]);
+      const auto key = Scrypt(password, salt, n, r, p);
+      return key && ConstantTimeEquals(ToHex(*key), parts[3]);
+    }
+  } catch (const std::exception&) {
+    return false;  // Broken parameters
+  }
+
+  return false;
+}
+
+}  // namespace NChat::NInfra::NKdf
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace NChat::NInfra::NKdf {
+
+enum class EKdfType { Sha256, Pbkdf2Sha256, Scrypt };
+
+EKdfType ParseKdfType(std::string_view name);
+
+struct TKdfSettings {
+  EKdfType Type{EKdfType::Pbkdf2Sha256};
+  std::uint32_t Pbkdf2Iterations{600'000};
+  std::uint64_t ScryptN{1 << 15};
+  std::uint32_t ScryptR{8};
+  std::uint32_t ScryptP{1};
+};
+
+/*
+Parameters are stored with the hash: "$pbkdf2-sha256$<iterations>$<hex>", "$scrypt$<N>$<r>$<p>$<hex>".
+Hash without prefix is a legacy salted SHA-256, it is still verified so old users can log in.
+*/
+std::string DeriveHash(std::string_view password, std::string_view salt, const TKdfSettings& settings);
+bool VerifyHash(std::string_view password, std::string_view salt, std::string_view stored_hash);
+
+}  // namespace NChat::NInfra::NKdf
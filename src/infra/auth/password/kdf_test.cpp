@@ -0,0 +1,65 @@
+#include "kdf.hpp"
+
+#include <userver/crypto/hash.hpp>
+#include <userver/utest/utest.hpp>
+
+using namespace NChat::NInfra::NKdf;
+
+namespace {
+const TKdfSettings kPbkdf2{.Type = EKdfType::Pbkdf2Sha256, .Pbkdf2Iterations = 1000};
+const TKdfSettings kScrypt{.Type = EKdfType::Scrypt, .ScryptN = 1024, .ScryptR = 8, .ScryptP = 1};
+}  // namespace
+
+TEST(Kdf, Pbkdf2RoundTrip) {
+  const auto hash = DeriveHash("password", "salt", kPbkdf2);
+
+  EXPECT_TRUE(hash.starts_with("$pbkdf2-sha256$1000$"));
+  EXPECT_TRUE(VerifyHash("password", "salt", hash));
+  EXPECT_FALSE(VerifyHash("Password", "salt", hash));
+  EXPECT_FALSE(VerifyHash("password", "pepper", hash));
+}
+
+TEST(Kdf, Pbkdf2KnownVector) {
+  // RFC 7914, section 11: first 32 bytes of PBKDF2-HMAC-SHA256("passwd", "salt", 1)
+  const auto hash = DeriveHash("passwd", "salt", {.Type = EKdfType::Pbkdf2Sha256, .Pbkdf2Iterations = 1});
+
+  EXPECT_EQ(hash, "$pbkdf2-sha256$1$55ac046e56e3089fec1691c22544b605f94185216dde0465e68b9d57c20dacbc");
+}
+
+TEST(Kdf, ScryptRoundTrip) {
+  const auto hash = DeriveHash("password", "salt", kScrypt);
+
+  EXPECT_TRUE(hash.starts_with("$scrypt$1024$8$1$"));
+  EXPECT_TRUE(VerifyHash("password", "salt", hash));
+  EXPECT_FALSE(VerifyHash("password1", "salt", hash));
+}
+
+TEST(Kdf, ParametersAreTakenFromStoredHash) {
+  const auto weak = DeriveHash("password", "salt", {.Type = EKdfType::Pbkdf2Sha256, .Pbkdf2Iterations = 10});
+
+  EXPECT_TRUE(VerifyHash("password", "salt", weak));
+  EXPECT_NE(weak, DeriveHash("password", "salt", kPbkdf2));
+}
+
+TEST(Kdf, LegacySha256StillVerifies) {
+  const auto legacy = userver::crypto::hash::Sha256("passwordsalt");
+
+  EXPECT_EQ(DeriveHash("password", "salt", {.Type = EKdfType::Sha256}), legacy);
+  EXPECT_TRUE(VerifyHash("password", "salt", legacy));
+  EXPECT_FALSE(VerifyHash("wrong", "salt", legacy));
+}
+
+TEST(Kdf, MalformedHashIsRejected) {
+  EXPECT_FALSE(VerifyHash("password", "salt", "$pbkdf2-sha256$abc$00"));
+  EXPECT_FALSE(VerifyHash("password", "salt", "$pbkdf2-sha256$1000"));
+  EXPECT_FALSE(VerifyHash("password", "salt", "$scrypt$1024$8$00"));
+  EXPECT_FALSE(VerifyHash("password", "salt", "$argon2id$v=19$00"));
+  EXPECT_FALSE(VerifyHash("password", "salt", ""));
+}
+
+TEST(Kdf, ParseKdfType) {
+  EXPECT_EQ(ParseKdfType("sha256"), EKdfType::Sha256);
+  EXPECT_EQ(ParseKdfType("pbkdf2-sha256"), EKdfType::Pbkdf2Sha256);
+  EXPECT_EQ(ParseKdfType("scrypt"), EKdfType::Scrypt);
+  EXPECT_THROW(ParseKdfType("md5"), std::invalid_argument);
+}
@@ -0,0 +1,21 @@
+#include "token_cache_stats.hpp"
+
+#include <userver/utils/statistics/writer.hpp>
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TTokenCacheStatistics& stats) {
+  writer["size"]["current"] = stats.size.load(std::memory_order_relaxed);
+  writer["hits"]["total"] = stats.hits_total;
+  writer["misses"]["total"] = stats.misses_total;
+  writer["expired"]["total"] = stats.expired_total;
+}
+
+void ResetMetric(TTokenCacheStatistics& stats) {
+  stats.size = 0;
+  stats.hits_total.Store({0});
+  stats.misses_total.Store({0});
+  stats.expired_total.Store({0});
+}
+
+}  // namespace NChat::NInfra
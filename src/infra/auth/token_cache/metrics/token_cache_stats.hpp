@@ -0,0 +1,23 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <atomic>
+
+namespace NChat::NInfra {
+
+struct TTokenCacheStatistics {
+  std::atomic<std::size_t> size{0};
+  userver::utils::statistics::RateCounter hits_total{0};
+  userver::utils::statistics::RateCounter misses_total{0};
+  userver::utils::statistics::RateCounter expired_total{0};
+};
+
+inline const userver::utils::statistics::MetricTag<TTokenCacheStatistics> kTokenCacheTag{"chat_token_cache"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TTokenCacheStatistics& stats);
+void ResetMetric(TTokenCacheStatistics& stats);
+
+}  // namespace NChat::NInfra
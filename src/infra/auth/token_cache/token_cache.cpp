@@ -0,0 +1,51 @@
+#include "token_cache.hpp"
+
+#include <userver/crypto/hash.hpp>
+#include <userver/utils/datetime.hpp>
+
+namespace NChat::NInfra {
+
+TVerifiedTokenCache::TVerifiedTokenCache(std::size_t ways, std::size_t way_size, TTokenCacheStatistics& stats)
+    : Cache_(ways, way_size), Stats_(stats) {
+}
+
+std::string TVerifiedTokenCache::MakeKey(std::string_view token) {
+  return userver::crypto::hash::Sha256(token, userver::crypto::hash::OutputEncoding::kBinary);
+}
+
+std::optional<TVerifiedTokenCache::TUserTinyProfile> TVerifiedTokenCache::Get(const std::string& key) {
+  const auto now = userver::utils::datetime::Now();
+  bool expired = false;
+
+  // Expired entry is evicted by the validator
+  auto entry = Cache_.Get(key, [now, &expired](const TEntry& entry) {
+    expired = entry.ExpiresAt <= now;
+    return !expired;
+  });
+
+  if (!entry.has_value()) {
+    if (expired) {
+      ++Stats_.expired_total;
+    }
+    ++Stats_.misses_total;
+    return std::nullopt;
+  }
+
+  ++Stats_.hits_total;
+  return std::move(entry->Profile);
+}
+
+void TVerifiedTokenCache::Put(const std::string& key, TUserTinyProfile profile, TTimePoint expires_at) {
+  if (expires_at <= userver::utils::datetime::Now()) {
+    return;
+  }
+
+  Cache_.Put(key, TEntry{.Profile = std::move(profile), .ExpiresAt = expires_at});
+  Stats_.size.store(Cache_.GetSize(), std::memory_order_relaxed);
+}
+
+std::size_t TVerifiedTokenCache::GetSize() const {
+  return Cache_.GetSize();
+}
+
+}  // namespace NChat::NInfra
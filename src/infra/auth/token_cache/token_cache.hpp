@@ -0,0 +1,44 @@
+#pragma once
+
+#include "infra/auth/token_cache/metrics/token_cache_stats.hpp"
+
+#include <core/users/profile.hpp>
+
+#include <userver/cache/nway_lru_cache.hpp>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace NChat::NInfra {
+
+/*
+Cache of successfully verified tokens: SHA-256 of the token -> (profile claims, exp).
+Only signature/JSON work is skipped: expiry is checked on every hit, profile freshness is checked in the use case.
+*/
+class TVerifiedTokenCache final {
+ public:
+  using TUserTinyProfile = NCore::NDomain::TUserTinyProfile;
+  using TTimePoint = std::chrono::system_clock::time_point;
+
+  TVerifiedTokenCache(std::size_t ways, std::size_t way_size, TTokenCacheStatistics& stats);
+
+  static std::string MakeKey(std::string_view token);
+
+  std::optional<TUserTinyProfile> Get(const std::string& key);
+  void Put(const std::string& key, TUserTinyProfile profile, TTimePoint expires_at);
+
+  std::size_t GetSize() const;
+
+ private:
+  struct TEntry {
+    TUserTinyProfile Profile;
+    TTimePoint ExpiresAt;
+  };
+
+  userver::cache::NWayLRU<std::string, TEntry> Cache_;
+  TTokenCacheStatistics& Stats_;
+};
+
+}  // namespace NChat::NInfra
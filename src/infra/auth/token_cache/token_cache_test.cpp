@@ -0,0 +1,77 @@
+#include "token_cache.hpp"
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+using namespace NChat::NInfra;
+using NChat::NCore::NDomain::TUserId;
+
+namespace {
+const auto kNow = userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000");
+}  // namespace
+
+UTEST(VerifiedTokenCache, MissThenHit) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TTokenCacheStatistics stats;
+  TVerifiedTokenCache cache(4, 16, stats);
+
+  const auto key = TVerifiedTokenCache::MakeKey("token");
+  EXPECT_FALSE(cache.Get(key).has_value());
+
+  cache.Put(key, {.Id = TUserId{"user"}, .Username = "username"}, kNow + std::chrono::hours(1));
+  auto profile = cache.Get(key);
+
+  ASSERT_TRUE(profile.has_value());
+  EXPECT_EQ(profile->Id.GetUnderlying(), "user");
+  EXPECT_EQ(profile->Username, "username");
+  EXPECT_EQ(stats.hits_total.Load().value, 1);
+  EXPECT_EQ(stats.misses_total.Load().value, 1);
+  EXPECT_EQ(stats.size.load(), 1);
+}
+
+UTEST(VerifiedTokenCache, KeyIsDigest) {
+  const auto key = TVerifiedTokenCache::MakeKey("header.payload.signature");
+
+  EXPECT_EQ(key.size(), 32);
+  EXPECT_EQ(key, TVerifiedTokenCache::MakeKey("header.payload.signature"));
+  EXPECT_NE(key, TVerifiedTokenCache::MakeKey("header.payload.signaturf"));
+}
+
+UTEST(VerifiedTokenCache, ExpiredTokenIsRejected) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TTokenCacheStatistics stats;
+  TVerifiedTokenCache cache(4, 16, stats);
+
+  const auto key = TVerifiedTokenCache::MakeKey("token");
+  cache.Put(key, {.Id = TUserId{"user"}}, kNow + std::chrono::seconds(10));
+  EXPECT_TRUE(cache.Get(key).has_value());
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(10));
+  EXPECT_FALSE(cache.Get(key).has_value());
+  EXPECT_EQ(stats.expired_total.Load().value, 1);
+
+  // Evicted, not just hidden
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+UTEST(VerifiedTokenCache, AlreadyExpiredIsNotStored) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TTokenCacheStatistics stats;
+  TVerifiedTokenCache cache(4, 16, stats);
+
+  cache.Put(TVerifiedTokenCache::MakeKey("token"), {.Id = TUserId{"user"}}, kNow);
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+UTEST(VerifiedTokenCache, SizeIsBounded) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TTokenCacheStatistics stats;
+  TVerifiedTokenCache cache(2, 8, stats);
+
+  for (int i = 0; i < 1000; ++i) {
+    cache.Put(TVerifiedTokenCache::MakeKey(std::to_string(i)), {.Id = TUserId{"user"}}, kNow + std::chrono::hours(1));
+  }
+
+  EXPECT_LE(cache.GetSize(), 16);
+}
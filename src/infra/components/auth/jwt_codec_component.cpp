@@ -0,0 +1,95 @@
+#include "jwt_codec_component.hpp"
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/secdist/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+namespace {
+
+// Keys from secdist: {"jwt_keys": [{"kid": "...", "secret": "..."}]}
+struct TJwtSecdistKeys {
+  explicit TJwtSecdistKeys(const userver::formats::json::Value& doc) {
+    // Secdist parses every registered type on load: without keys the codec itself rejects the empty set
+    if (doc["jwt_keys"].IsMissing()) {
+      return;
+    }
+
+    for (const auto& key : doc["jwt_keys"]) {
+      Keys.push_back({.Kid = key["kid"].As<std::string>(), .Secret = key["secret"].As<std::string>()});
+    }
+  }
+
+  std::vector<TJwtKey> Keys;
+};
+
+}  // namespace
+
+TJwtCodecComponent::TJwtCodecComponent(const userver::components::ComponentConfig& config,
+                                       const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context), Codec_(ParseSettings(config, context)) {
+}
+
+TJwtCodecSettings TJwtCodecComponent::ParseSettings(const userver::components::ComponentConfig& config,
+                                                    const userver::components::ComponentContext& context) {
+  TJwtCodecSettings settings;
+  settings.Issuer = config["issuer"].As<std::string>(settings.Issuer);
+  settings.SigningKid = config["signing-kid"].As<std::string>("");
+
+  // Inline keys are for testsuite only, real secrets never live in config vars
+  const bool inline_keys = !config["keys"].IsMissing();
+  if (inline_keys) {
+    for (const auto& key : config["keys"]) {
+      settings.Keys.push_back({.Kid = key["kid"].As<std::string>(), .Secret = key["secret"].As<std::string>()});
+    }
+  } else {
+    const auto& secdist = context.FindComponent<userver::components::Secdist>().Get();
+    settings.Keys = secdist.Get<TJwtSecdistKeys>().Keys;
+  }
+
+  LOG_INFO() << fmt::format("JWT codec: {} active keys from {}, signing kid '{}'", settings.Keys.size(),
+                            inline_keys ? "static config" : "secdist", settings.SigningKid);
+
+  return settings;
+}
+
+const TJwtCodec& TJwtCodecComponent::GetCodec() const {
+  return Codec_;
+}
+
+userver::yaml_config::Schema TJwtCodecComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: Component with prebuilt JWT signer and verifiers
+additionalProperties: false
+properties:
+    issuer:
+        type: string
+        description: Value of iss claim
+    signing-kid:
+        type: string
+        description: Kid of the key for new tokens, also used for tokens without kid
+    keys:
+        type: array
+        description: |
+            Active HS256 keys, old keys stay here until their tokens expire.
+            For tests only, if missing the keys are read from secdist jwt_keys
+        items:
+            type: object
+            description: HS256 key
+            additionalProperties: false
+            properties:
+                kid:
+                    type: string
+                    description: Key id
+                secret:
+                    type: string
+                    description: HMAC secret
+)");
+}
+}  // namespace NChat::NInfra::NComponents
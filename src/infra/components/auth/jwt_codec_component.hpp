@@ -0,0 +1,28 @@
+#pragma once
+
+#include <infra/auth/jwt/jwt_codec.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TJwtCodecComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "jwt-codec-component";
+
+  TJwtCodecComponent(const userver::components::ComponentConfig& config,
+                     const userver::components::ComponentContext& context);
+
+  const TJwtCodec& GetCodec() const;
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  static TJwtCodecSettings ParseSettings(const userver::components::ComponentConfig& config,
+                                         const userver::components::ComponentContext& context);
+
+ private:
+  TJwtCodec Codec_;
+};
+
+}  // namespace NChat::NInfra::NComponents
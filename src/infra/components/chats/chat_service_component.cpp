@@ -1,6 +1,8 @@
 #include "chat_service_component.hpp"
 
 #include <infra/components/chats/chat_repository_component.hpp>
+#include <infra/components/messaging/bus/message_bus_component.hpp>
+#include <infra/components/messaging/registry/mailbox_registry_component.hpp>
 #include <infra/components/users/user_repository_component.hpp>
 #include <infra/db/user/postgres_user_repository.hpp>
 
@@ -16,7 +18,10 @@ TChatServiceComponent::TChatServiceComponent(const userver::components::Componen
   auto& chat_repo = context.FindComponent<NComponents::TChatRepoComponent>().GetRepository();
   auto& user_repo = context.FindComponent<NComponents::TUserRepoComponent>().GetRepository();
 
-  ChatService_ = std::make_unique<NApp::NServices::TChatService>(chat_repo, user_repo);
+  auto& mailbox_registry = context.FindComponent<NComponents::TMailboxRegistryComponent>().GetRegistry();
+  auto& bus = context.FindComponent<NComponents::TMessageBusComponent>().GetBus();
+
+  ChatService_ = std::make_unique<NApp::NServices::TChatService>(chat_repo, user_repo, &mailbox_registry, &bus);
 }
 
 NApp::NServices::TChatService& TChatServiceComponent::GetService() {
@@ -1,21 +1,33 @@
 #include "components.hpp"
 
+#include <infra/components/auth/jwt_codec_component.hpp>
 #include <infra/components/chats/chat_repository_component.hpp>
 #include <infra/components/chats/chat_service_component.hpp>
+#include <infra/components/config/config_cache_component.hpp>
+#include <infra/components/messaging/admission/overload_sensor_component.hpp>
+#include <infra/components/messaging/backpressure/send_backpressure_component.hpp>
+#include <infra/components/messaging/bus/message_bus_component.hpp>
+#include <infra/components/messaging/drain/drain_component.hpp>
 #include <infra/components/messaging/garbage_collector/gc_task_component.hpp>
+#include <infra/components/messaging/history/message_history_component.hpp>
+#include <infra/components/messaging/idempotency/idempotency_store_component.hpp>
 #include <infra/components/messaging/limiter/send_limiter_component.hpp>
 #include <infra/components/messaging/messaging_service_component.hpp>
+#include <infra/components/messaging/pipeline/fanout_pipeline_component.hpp>
+#include <infra/components/messaging/presence/presence_component.hpp>
 #include <infra/components/messaging/registry/mailbox_registry_component.hpp>
 #include <infra/components/messaging/sessions/sessions_registry_component.hpp>
 #include <infra/components/users/user_repository_component.hpp>
 #include <infra/components/users/user_service_component.hpp>
-#include <infra/db/user/postgres_profile_by_user_id_cache.hpp>
-#include <infra/db/user/postgres_profile_by_username_cache.hpp>
+#include <infra/db/user/postgres_profile_cache.hpp>
 
+#include <api/http/internal/bus/bus_deliver_handler.hpp>
 #include <api/http/middlewares/auth_bearer.hpp>
+#include <api/http/v1/chats/history/chat_history_handler.hpp>
 #include <api/http/v1/chats/private/chat_private_handler.hpp>
 #include <api/http/v1/messages/polling/poll_messages_handler.hpp>
 #include <api/http/v1/messages/send/send_message_handler.hpp>
+#include <api/http/v1/messages/send_batch/send_batch_handler.hpp>
 #include <api/http/v1/messages/session/start_session_handler.hpp>
 #include <api/http/v1/users/delete_by_username_handler.hpp>
 #include <api/http/v1/users/get_by_username_handler.hpp>
@@ -33,6 +45,8 @@
 #include <userver/server/handlers/server_monitor.hpp>
 #include <userver/server/handlers/tests_control.hpp>
 #include <userver/storages/postgres/component.hpp>
+#include <userver/storages/secdist/component.hpp>
+#include <userver/storages/secdist/provider_component.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
 
 namespace NChat::NInfra {
@@ -45,7 +59,9 @@ void RegisterUserverComponents(userver::components::ComponentList& list) {
       .Append<userver::clients::dns::Component>()
       .Append<userver::server::handlers::ServerMonitor>()
       .Append<userver::server::handlers::TestsControl>()
-      .Append<userver::congestion_control::Component>();
+      .Append<userver::congestion_control::Component>()
+      .Append<userver::components::Secdist>()
+      .Append<userver::components::DefaultSecdistProvider>();
 }
 
 void RegisterAuthCheckerFactory() {
@@ -59,8 +75,7 @@ void RegisterPostrgesComponent(userver::components::ComponentList& list) {
 
 // Caches
 void RegisterCacheComponent(userver::components::ComponentList& list) {
-  list.Append<TProfileByUserIdCache>();
-  list.Append<TProfileByUsernameCache>();
+  list.Append<TProfileCache>();
 }
 
 // Handlers
@@ -74,21 +89,34 @@ void RegisterUserHandlers(userver::components::ComponentList& list) {
 
 void RegisterMessagesHandlers(userver::components::ComponentList& list) {
   list.Append<NHandlers::TSendMessageHandler>();
+  list.Append<NHandlers::TSendBatchHandler>();
   list.Append<NHandlers::TPollMessageHandler>();
   list.Append<NHandlers::TStartSessionHandler>();
+  list.Append<NHandlers::TBusDeliverHandler>();
 }
 
 void RegisterChatHandlers(userver::components::ComponentList& list) {
   list.Append<NHandlers::TPrivateChatHandler>();
+  list.Append<NHandlers::TChatHistoryHandler>();
 }
 
 // Components
 void RegisterServiceComponents(userver::components::ComponentList& list) {
   list.Append<NComponents::TUserServiceComponent>()
+      .Append<NComponents::TJwtCodecComponent>()
       .Append<NComponents::TMessagingServiceComponent>()
+      .Append<NComponents::TConfigCacheComponent>()
       .Append<NComponents::TGarbageCollectorComponent>()
       .Append<NComponents::TMailboxRegistryComponent>()
       .Append<NComponents::TSendLimiterComponent>()
+      .Append<NComponents::TIdempotencyStoreComponent>()
+      .Append<NComponents::TMessageHistoryComponent>()
+      .Append<NComponents::TMessageBusComponent>()
+      .Append<NComponents::TPresenceComponent>()
+      .Append<NComponents::TFanOutPipelineComponent>()
+      .Append<NComponents::TSendBackpressureComponent>()
+      .Append<NComponents::TOverloadSensorComponent>()
+      .Append<NComponents::TDrainComponent>()
       .Append<NComponents::TSessionsFactoryComponent>()
       .Append<NComponents::TChatServiceComponent>();
 }
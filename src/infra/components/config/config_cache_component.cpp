@@ -0,0 +1,29 @@
+#include "config_cache_component.hpp"
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/dynamic_config/storage/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+TConfigCacheComponent::TConfigCacheComponent(const userver::components::ComponentConfig& config,
+                                             const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      Cache_(context.FindComponent<userver::components::DynamicConfig>().GetSource()) {
+}
+
+const TConfigCache& TConfigCacheComponent::GetCache() const {
+  return Cache_;
+}
+
+userver::yaml_config::Schema TConfigCacheComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: Component with parsed dynamic configs for hot paths
+additionalProperties: false
+properties: {}
+)");
+}
+}  // namespace NChat::NInfra::NComponents
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <infra/config/config_cache.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TConfigCacheComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "config-cache-component";
+
+  TConfigCacheComponent(const userver::components::ComponentConfig& config,
+                        const userver::components::ComponentContext& context);
+
+  const TConfigCache& GetCache() const;
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  TConfigCache Cache_;
+};
+
+}  // namespace NChat::NInfra::NComponents
@@ -0,0 +1,65 @@
+#include "overload_sensor_component.hpp"
+
+#include <infra/messaging/admission/task_lag_sensor.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/dynamic_config/storage/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+TOverloadSensorComponent::TOverloadSensorComponent(const userver::components::ComponentConfig& config,
+                                                   const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context), Sensor_(GetSensorFactory().Create(config, context, "type")) {
+}
+
+TObjectFactory<NCore::IOverloadSensor> TOverloadSensorComponent::GetSensorFactory() {
+  TObjectFactory<NCore::IOverloadSensor> sensor_factory;
+
+  sensor_factory.Register("TaskLag", [](const auto& config, const auto& context) {
+    const auto check_period =
+        config["check-period"].template As<std::chrono::milliseconds>(std::chrono::milliseconds{100});
+    auto config_source = context.template FindComponent<userver::components::DynamicConfig>().GetSource();
+    auto& admission_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                                .GetMetricsStorage()
+                                ->GetMetric(kAdmissionTag);
+
+    return std::make_unique<TTaskLagSensor>(config_source, check_period, admission_stats);
+  });
+
+  sensor_factory.Register("None", [](const auto& /* config */, const auto& /* context */) {
+    return std::unique_ptr<NCore::IOverloadSensor>{};
+  });
+
+  return sensor_factory;
+}
+
+const NCore::IOverloadSensor* TOverloadSensorComponent::GetSensor() const {
+  return Sensor_.get();
+}
+
+userver::yaml_config::Schema TOverloadSensorComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: |
+    Component estimating node overload for admission of new users;
+    thresholds are set by ADMISSION_CONFIG
+additionalProperties: false
+properties:
+    type:
+        type: string
+        description: Realization of overload sensor
+        enum:
+          - None
+          - TaskLag
+    check-period:
+        type: string
+        description: Period of task processor lag measurement
+        defaultDescription: 100ms
+)");
+}
+
+}  // namespace NChat::NInfra::NComponents
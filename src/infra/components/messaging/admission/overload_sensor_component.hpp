@@ -0,0 +1,30 @@
+#pragma once
+
+#include <core/messaging/admission/overload_sensor.hpp>
+
+#include <infra/components/object_factory.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TOverloadSensorComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "overload-sensor-component";
+
+  TOverloadSensorComponent(const userver::components::ComponentConfig& config,
+                           const userver::components::ComponentContext& context);
+
+  // nullptr при type: None - новых пользователей ограничивает только REGISTRY_CONFIG
+  const NCore::IOverloadSensor* GetSensor() const;
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  TObjectFactory<NCore::IOverloadSensor> GetSensorFactory();
+
+ private:
+  std::unique_ptr<NCore::IOverloadSensor> Sensor_;
+};
+
+}  // namespace NChat::NInfra::NComponents
@@ -0,0 +1,69 @@
+#include "send_backpressure_component.hpp"
+
+#include <infra/components/config/config_cache_component.hpp>
+#include <infra/messaging/backpressure/sharded_backpressure.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+TSendBackpressureComponent::TSendBackpressureComponent(const userver::components::ComponentConfig& config,
+                                                       const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context), Backpressure_(GetBackpressureFactory().Create(config, context, "type")) {
+}
+
+TObjectFactory<NApp::ISendBackpressure> TSendBackpressureComponent::GetBackpressureFactory() {
+  TObjectFactory<NApp::ISendBackpressure> backpressure_factory;
+
+  backpressure_factory.Register("ShardedMap", [](const auto& config, const auto& context) {
+    const auto shards_amount = config["shards-amount"].template As<std::size_t>(256);
+    const auto chats_amount = config["chats-amount"].template As<std::size_t>(100000);
+    const auto& config_cache = context.template FindComponent<TConfigCacheComponent>().GetCache();
+    auto& backpressure_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                                   .GetMetricsStorage()
+                                   ->GetMetric(kBackpressureTag);
+
+    return std::make_unique<TShardedBackpressure>(shards_amount, chats_amount, config_cache, backpressure_stats);
+  });
+
+  backpressure_factory.Register("None", [](const auto& /* config */, const auto& /* context */) {
+    return std::unique_ptr<NApp::ISendBackpressure>{};
+  });
+
+  return backpressure_factory;
+}
+
+NApp::ISendBackpressure* TSendBackpressureComponent::GetBackpressure() {
+  return Backpressure_.get();
+}
+
+userver::yaml_config::Schema TSendBackpressureComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: |
+    Component for per-chat backpressure from saturated recipient queues to senders;
+    thresholds are set by SEND_BACKPRESSURE_CONFIG
+additionalProperties: false
+properties:
+    type:
+        type: string
+        description: Realization of backpressure
+        enum:
+          - None
+          - ShardedMap
+    shards-amount:
+        type: integer
+        description: Amount of shards with throttled chats
+        defaultDescription: 256
+    chats-amount:
+        type: integer
+        description: Max amount of throttled chats kept at once, least recently reported are evicted
+        defaultDescription: 100000
+)");
+}
+
+}  // namespace NChat::NInfra::NComponents
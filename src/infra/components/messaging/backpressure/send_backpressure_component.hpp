@@ -0,0 +1,30 @@
+#pragma once
+
+#include <app/services/message/send_backpressure.hpp>
+
+#include <infra/components/object_factory.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TSendBackpressureComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "send-backpressure-component";
+
+  TSendBackpressureComponent(const userver::components::ComponentConfig& config,
+                             const userver::components::ComponentContext& context);
+
+  // nullptr при type: None - отправители не получают обратной связи от медленных получателей
+  NApp::ISendBackpressure* GetBackpressure();
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  TObjectFactory<NApp::ISendBackpressure> GetBackpressureFactory();
+
+ private:
+  std::unique_ptr<NApp::ISendBackpressure> Backpressure_;
+};
+
+}  // namespace NChat::NInfra::NComponents
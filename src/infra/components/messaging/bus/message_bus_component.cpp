@@ -0,0 +1,151 @@
+#include "message_bus_component.hpp"
+
+#include <infra/components/messaging/presence/presence_component.hpp>
+#include <infra/messaging/bus/broadcast_locator.hpp>
+#include <infra/messaging/bus/dummy_message_bus.hpp>
+#include <infra/messaging/bus/http_message_bus.hpp>
+
+#include <utils/seq/message_seq.hpp>
+
+#include <userver/clients/http/component.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+namespace {
+std::unordered_map<NCore::NDomain::TNodeId, std::string> ParsePeers(const userver::yaml_config::YamlConfig& peers) {
+  std::unordered_map<NCore::NDomain::TNodeId, std::string> result;
+
+  for (auto it = peers.begin(); it != peers.end(); ++it) {
+    result.emplace(NCore::NDomain::TNodeId{it.GetName()}, it->As<std::string>());
+  }
+
+  return result;
+}
+}  // namespace
+
+TMessageBusComponent::TMessageBusComponent(const userver::components::ComponentConfig& config,
+                                           const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      NodeId_(config["node-id"].As<std::string>("node-1")),
+      Secret_(config["secret"].As<std::string>("")),
+      Forwarding_(config["type"].As<std::string>() != "None"),
+      Bus_(GetBusFactory().Create(config, context, "type")) {
+  NUtils::NId::SetMessageSeqNode(config["node-index"].As<std::uint32_t>(0));
+}
+
+TObjectFactory<NCore::IMessageBus> TMessageBusComponent::GetBusFactory() {
+  TObjectFactory<NCore::IMessageBus> bus_factory;
+
+  bus_factory.Register("Http", [this](const auto& config, const auto& context) {
+    auto& http_client = context.template FindComponent<userver::components::HttpClient>().GetHttpClient();
+    auto& bus_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                          .GetMetricsStorage()
+                          ->GetMetric(kMessageBusTag);
+
+    TMessageBusSettings settings;
+    settings.LocalNode = NodeId_;
+    settings.Peers = ParsePeers(config["peers"]);
+    settings.Secret = Secret_;
+    settings.MaxBatchSize = config["max-batch-size"].template As<std::size_t>(settings.MaxBatchSize);
+    settings.MaxPendingTasks = config["max-pending-tasks"].template As<std::size_t>(settings.MaxPendingTasks);
+    settings.FlushInterval = config["flush-interval"].template As<std::chrono::milliseconds>(settings.FlushInterval);
+    settings.Timeout = config["timeout"].template As<std::chrono::milliseconds>(settings.Timeout);
+
+    auto* locator = context.template FindComponent<TPresenceComponent>().GetLocator();
+
+    // Без каталога присутствия получатель ищется на всех остальных узлах
+    if (!locator) {
+      std::vector<NCore::NDomain::TNodeId> peers;
+      for (const auto& [node, url] : settings.Peers) {
+        if (node != NodeId_) {
+          peers.push_back(node);
+        }
+      }
+      Locator_ = std::make_unique<TBroadcastNodeLocator>(std::move(peers));
+      locator = Locator_.get();
+    }
+
+    return std::make_unique<THttpMessageBus>(http_client, *locator, std::move(settings), bus_stats);
+  });
+
+  bus_factory.Register("None", [](const auto& /* config */, const auto& /* context */) {
+    return std::make_unique<TDummyMessageBus>();
+  });
+
+  return bus_factory;
+}
+
+NCore::IMessageBus& TMessageBusComponent::GetBus() {
+  return *Bus_;
+}
+
+const NCore::NDomain::TNodeId& TMessageBusComponent::GetNodeId() const {
+  return NodeId_;
+}
+
+const std::string& TMessageBusComponent::GetSecret() const {
+  return Secret_;
+}
+
+bool TMessageBusComponent::IsForwarding() const {
+  return Forwarding_;
+}
+
+userver::yaml_config::Schema TMessageBusComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: Component for routing messages to recipients on other service instances
+additionalProperties: false
+properties:
+    type:
+        type: string
+        description: Realization of message bus
+        enum:
+          - None
+          - Http
+    node-id:
+        type: string
+        description: Name of this instance in the cluster
+        defaultDescription: node-1
+    node-index:
+        type: integer
+        description: Index of this instance in the cluster, unique per node, keeps message seq unique across nodes
+        minimum: 0
+        maximum: 63
+        defaultDescription: 0
+    peers:
+        type: object
+        description: Instances of the cluster, node name to base URL; this node may be listed too
+        properties: {}
+        additionalProperties:
+            type: string
+            description: Base URL of the node, e.g. http://127.0.0.1:8080
+    secret:
+        type: string
+        description: Shared secret of the cluster, forwarded batches with another secret are rejected
+        defaultDescription: empty, forwarding to this node is disabled
+    max-batch-size:
+        type: integer
+        description: Max amount of messages in one request to a node
+        defaultDescription: 100
+    max-pending-tasks:
+        type: integer
+        description: Max amount of messages waiting for a node, new ones are dropped
+        defaultDescription: 10000
+    flush-interval:
+        type: string
+        description: Max time a message waits for a batch to a node
+        defaultDescription: 5ms
+    timeout:
+        type: string
+        description: Timeout of one forward request
+        defaultDescription: 500ms
+)");
+}
+
+}  // namespace NChat::NInfra::NComponents
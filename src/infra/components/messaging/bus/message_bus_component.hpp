@@ -0,0 +1,41 @@
+#pragma once
+
+#include <core/messaging/bus/message_bus.hpp>
+#include <core/messaging/bus/node_locator.hpp>
+
+#include <infra/components/object_factory.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TMessageBusComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "message-bus-component";
+
+  TMessageBusComponent(const userver::components::ComponentConfig& config,
+                       const userver::components::ComponentContext& context);
+
+  NCore::IMessageBus& GetBus();
+  const NCore::NDomain::TNodeId& GetNodeId() const;
+
+  // Пустой секрет - узел не принимает пересылку от других узлов
+  const std::string& GetSecret() const;
+
+  // Сообщения чата расходятся по нескольким узлам: ни один узел не видит всю историю
+  bool IsForwarding() const;
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  TObjectFactory<NCore::IMessageBus> GetBusFactory();
+
+ private:
+  const NCore::NDomain::TNodeId NodeId_;
+  const std::string Secret_;
+  const bool Forwarding_;
+  std::unique_ptr<NCore::INodeLocator> Locator_;
+  std::unique_ptr<NCore::IMessageBus> Bus_;
+};
+
+}  // namespace NChat::NInfra::NComponents
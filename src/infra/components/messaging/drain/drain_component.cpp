@@ -0,0 +1,54 @@
+#include "drain_component.hpp"
+
+#include <infra/components/messaging/registry/mailbox_registry_component.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+TDrainComponent::TDrainComponent(const userver::components::ComponentConfig& config,
+                                 const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context) {
+  auto& registry = context.FindComponent<TMailboxRegistryComponent>().GetRegistry();
+  auto& drain_stats =
+      context.FindComponent<userver::components::StatisticsStorage>().GetMetricsStorage()->GetMetric(kDrainTag);
+
+  TDrainSettings settings;
+  settings.ReconnectAfter = config["reconnect-after"].As<std::chrono::milliseconds>(settings.ReconnectAfter);
+  settings.ReconnectJitter = config["reconnect-jitter"].As<std::chrono::milliseconds>(settings.ReconnectJitter);
+
+  Drain_ = std::make_unique<TNodeDrain>(registry, settings, drain_stats);
+}
+
+NApp::IDrainMode& TDrainComponent::GetDrain() {
+  return *Drain_;
+}
+
+void TDrainComponent::OnAllComponentsAreStopping() {
+  Drain_->Start();
+}
+
+userver::yaml_config::Schema TDrainComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: |
+    Component draining the node on shutdown: new sessions are refused,
+    long polls are released at once with a jittered reconnect hint
+additionalProperties: false
+properties:
+    reconnect-after:
+        type: string
+        description: Minimal delay before a released client reconnects
+        defaultDescription: 1s
+    reconnect-jitter:
+        type: string
+        description: Reconnect delays are spread uniformly over this interval after reconnect-after
+        defaultDescription: 10s
+)");
+}
+
+}  // namespace NChat::NInfra::NComponents
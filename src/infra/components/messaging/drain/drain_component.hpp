@@ -0,0 +1,29 @@
+#pragma once
+
+#include <app/services/message/drain_mode.hpp>
+
+#include <infra/messaging/drain/node_drain.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TDrainComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "drain-component";
+
+  TDrainComponent(const userver::components::ComponentConfig& config,
+                  const userver::components::ComponentContext& context);
+
+  NApp::IDrainMode& GetDrain();
+
+  // Остановка сервиса: отпускаем поллеров до того, как сервер начнет ждать завершения запросов
+  void OnAllComponentsAreStopping() override;
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::unique_ptr<TNodeDrain> Drain_;
+};
+
+}  // namespace NChat::NInfra::NComponents
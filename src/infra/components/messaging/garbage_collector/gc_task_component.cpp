@@ -1,6 +1,7 @@
 #include "gc_task_component.hpp"
 
 #include <infra/components/messaging/garbage_collector/config/gc_config.hpp>
+#include <infra/components/messaging/idempotency/idempotency_store_component.hpp>
 #include <infra/components/messaging/limiter/send_limiter_component.hpp>
 #include <infra/components/messaging/registry/mailbox_registry_component.hpp>
 
@@ -19,6 +20,7 @@ TGarbageCollectorComponent::TGarbageCollectorComponent(const userver::components
     : LoggableComponentBase(config, context),
       Registry_(context.FindComponent<TMailboxRegistryComponent>().GetRegistry()),
       Limiter_(context.FindComponent<TSendLimiterComponent>().GetLimiter()),
+      IdempotencyStore_(context.FindComponent<TIdempotencyStoreComponent>().GetStore()),
       ConfigSource_(context.FindComponent<userver::components::DynamicConfig>().GetSource()) {
   StartPeriodicTraverse();
   SetupTestsuite(context);
@@ -44,6 +46,7 @@ void TGarbageCollectorComponent::Traverse() {
 
   Registry_.TraverseRegistry(task_config.InternalPause);
   Limiter_.TraverseLimiters();
+  IdempotencyStore_.TraverseKeys();
 }
 
 void TGarbageCollectorComponent::SetupTestsuite(const userver::components::ComponentContext& context) {
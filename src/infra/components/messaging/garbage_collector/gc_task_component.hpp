@@ -2,6 +2,7 @@
 
 #include <core/messaging/mailbox/mailbox_registry.hpp>
 
+#include <app/services/message/idempotency_store.hpp>
 #include <app/services/message/send_limiter.hpp>
 
 #include <userver/components/loggable_component_base.hpp>
@@ -27,6 +28,7 @@ class TGarbageCollectorComponent final : public userver::components::LoggableCom
  private:
   NCore::IMailboxRegistry& Registry_;
   NApp::ISendLimiter& Limiter_;
+  NApp::IIdempotencyStore& IdempotencyStore_;
 
   userver::dynamic_config::Source ConfigSource_;
   userver::utils::PeriodicTask Task_;
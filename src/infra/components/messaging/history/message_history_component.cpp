@@ -0,0 +1,160 @@
+#include "message_history_component.hpp"
+
+#include <infra/components/messaging/bus/message_bus_component.hpp>
+#include <infra/db/history/postgres_history_repository.hpp>
+#include <infra/messaging/history/dummy_history.hpp>
+#include <infra/messaging/history/dummy_history_writer.hpp>
+#include <infra/messaging/history/hot_tail/hot_tail_cache.hpp>
+#include <infra/messaging/history/postgres_history_writer.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+TMessageHistoryComponent::TMessageHistoryComponent(const userver::components::ComponentConfig& config,
+                                                   const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      Repository_(GetRepositoryFactory().Create(config, context, "type")),
+      Writer_(GetWriterFactory().Create(config, context, "type")) {
+  auto hot_tail_messages = config["hot-tail-messages"].As<std::size_t>(50);
+
+  // Кольцо видит только сообщения, прошедшие через этот узел, и перестает быть суффиксом истории чата
+  if (hot_tail_messages > 0 && context.FindComponent<TMessageBusComponent>().IsForwarding()) {
+    LOG_WARNING() << "Hot tail disabled: message bus forwards messages between nodes, history is read from storage";
+    hot_tail_messages = 0;
+  }
+
+  if (hot_tail_messages > 0) {
+    auto& hot_tail_stats =
+        context.FindComponent<userver::components::StatisticsStorage>().GetMetricsStorage()->GetMetric(kHotTailTag);
+
+    Recent_ = std::make_unique<THotTailCache>(config["hot-tail-shards-amount"].As<std::size_t>(64),
+                                              config["hot-tail-chats"].As<std::size_t>(100'000), hot_tail_messages,
+                                              hot_tail_stats);
+  } else {
+    Recent_ = std::make_unique<TDummyRecentMessages>();
+  }
+}
+
+TObjectFactory<NApp::IHistoryWriter> TMessageHistoryComponent::GetWriterFactory() {
+  TObjectFactory<NApp::IHistoryWriter> writer_factory;
+
+  writer_factory.Register("Postgres", [](const auto& config, const auto& context) {
+    const auto pg_component_name = config["postgres-component"].template As<std::string>("chat-postgres-database");
+    auto& pg_component = context.template FindComponent<userver::components::Postgres>(pg_component_name);
+    auto& history_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                              .GetMetricsStorage()
+                              ->GetMetric(kHistoryWriterTag);
+
+    THistoryWriterSettings settings;
+    settings.MaxQueueSize = config["max-queue-size"].template As<std::size_t>(settings.MaxQueueSize);
+    settings.MaxBatchSize = config["max-batch-size"].template As<std::size_t>(settings.MaxBatchSize);
+    settings.FlushInterval = config["flush-interval"].template As<std::chrono::milliseconds>(settings.FlushInterval);
+    settings.OverflowPolicy = ParseOverflowPolicy(config["overflow-policy"].template As<std::string>("drop"));
+    settings.OverflowWait = config["overflow-wait"].template As<std::chrono::milliseconds>(settings.OverflowWait);
+    settings.FlushAttempts = config["flush-attempts"].template As<std::size_t>(settings.FlushAttempts);
+
+    return std::make_unique<TPostgresHistoryWriter>(pg_component.GetCluster(), settings, history_stats);
+  });
+
+  writer_factory.Register("None", [](const auto& /* config */, const auto& /* context */) {
+    return std::make_unique<TDummyHistoryWriter>();
+  });
+
+  return writer_factory;
+}
+
+TObjectFactory<NCore::IMessageHistoryRepository> TMessageHistoryComponent::GetRepositoryFactory() {
+  TObjectFactory<NCore::IMessageHistoryRepository> repository_factory;
+
+  repository_factory.Register("Postgres", [](const auto& config, const auto& context) {
+    const auto pg_component_name = config["postgres-component"].template As<std::string>("chat-postgres-database");
+    auto& pg_component = context.template FindComponent<userver::components::Postgres>(pg_component_name);
+
+    return std::make_unique<NRepository::TPostgresHistoryRepository>(pg_component.GetCluster());
+  });
+
+  repository_factory.Register("None", [](const auto& /* config */, const auto& /* context */) {
+    return std::make_unique<TDummyHistoryRepository>();
+  });
+
+  return repository_factory;
+}
+
+NApp::IHistoryWriter& TMessageHistoryComponent::GetWriter() {
+  return *Writer_;
+}
+
+NCore::IRecentMessages& TMessageHistoryComponent::GetRecentMessages() {
+  return *Recent_;
+}
+
+NCore::IMessageHistoryRepository& TMessageHistoryComponent::GetRepository() {
+  return *Repository_;
+}
+
+userver::yaml_config::Schema TMessageHistoryComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: Component for write-behind persistence and paged reads of sent messages
+additionalProperties: false
+properties:
+    type:
+        type: string
+        description: Realization of history writer
+        enum:
+          - None
+          - Postgres
+    postgres-component:
+        type: string
+        description: Name of the Postgres component to use
+        defaultDescription: chat-postgres-database
+    max-queue-size:
+        type: integer
+        description: Max amount of messages waiting for the background writer
+        defaultDescription: 100000
+    max-batch-size:
+        type: integer
+        description: Max amount of rows in one multi-row INSERT
+        defaultDescription: 500
+    flush-interval:
+        type: string
+        description: Max time a message waits in a partial batch before flush
+        defaultDescription: 50ms
+    overflow-policy:
+        type: string
+        description: What to do with a message when the queue is full
+        defaultDescription: drop
+        enum:
+          - drop
+          - wait
+    overflow-wait:
+        type: string
+        description: How long the sender waits for a free slot with wait policy before the message is dropped
+        defaultDescription: 10ms
+    flush-attempts:
+        type: integer
+        description: Attempts to write a batch before its messages are counted as failed
+        defaultDescription: 3
+    hot-tail-messages:
+        type: integer
+        description: Last messages of a chat kept in memory for history reads, 0 disables hot tail; ignored when
+            the message bus type is not None, the tail would only see messages sent through this node
+        defaultDescription: 50
+    hot-tail-chats:
+        type: integer
+        description: Max amount of chats with a hot tail, least recently written chats are evicted
+        defaultDescription: 100000
+    hot-tail-shards-amount:
+        type: integer
+        description: Amount of independently locked hot tail shards
+        defaultDescription: 64
+)");
+}
+}  // namespace NChat::NInfra::NComponents
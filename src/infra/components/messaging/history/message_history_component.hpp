@@ -0,0 +1,36 @@
+#pragma once
+
+#include <core/messaging/history/history_repo.hpp>
+
+#include <app/services/message/history_writer.hpp>
+
+#include <infra/components/object_factory.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TMessageHistoryComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "message-history-component";
+
+  TMessageHistoryComponent(const userver::components::ComponentConfig& config,
+                           const userver::components::ComponentContext& context);
+
+  NApp::IHistoryWriter& GetWriter();
+  NCore::IRecentMessages& GetRecentMessages();
+  NCore::IMessageHistoryRepository& GetRepository();
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  TObjectFactory<NApp::IHistoryWriter> GetWriterFactory();
+  TObjectFactory<NCore::IMessageHistoryRepository> GetRepositoryFactory();
+
+ private:
+  std::unique_ptr<NCore::IRecentMessages> Recent_;
+  std::unique_ptr<NCore::IMessageHistoryRepository> Repository_;
+  std::unique_ptr<NApp::IHistoryWriter> Writer_;
+};
+
+}  // namespace NChat::NInfra::NComponents
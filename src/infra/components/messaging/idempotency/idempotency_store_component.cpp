@@ -0,0 +1,61 @@
+#include "idempotency_store_component.hpp"
+
+#include <infra/messaging/idempotency/dummy_idempotency_store.hpp>
+#include <infra/messaging/idempotency/sharded_idempotency_store.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/dynamic_config/storage/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+TIdempotencyStoreComponent::TIdempotencyStoreComponent(const userver::components::ComponentConfig& config,
+                                                       const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context), Store_(GetStoreFactory().Create(config, context, "type")) {
+}
+
+TObjectFactory<NApp::IIdempotencyStore> TIdempotencyStoreComponent::GetStoreFactory() {
+  TObjectFactory<NApp::IIdempotencyStore> store_factory;
+
+  store_factory.Register("ShardedMap", [](const auto& config, const auto& context) {
+    const auto shards_amount = config["shards-amount"].template As<std::size_t>(256);
+    auto config_source = context.template FindComponent<userver::components::DynamicConfig>().GetSource();
+    auto& idempotency_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                                  .GetMetricsStorage()
+                                  ->GetMetric(kIdempotencyTag);
+
+    return std::make_unique<TShardedIdempotencyStore>(shards_amount, config_source, idempotency_stats);
+  });
+
+  store_factory.Register("None", [](const auto& /* config */, const auto& /* context */) {
+    return std::make_unique<TDummyIdempotencyStore>();
+  });
+
+  return store_factory;
+}
+
+NApp::IIdempotencyStore& TIdempotencyStoreComponent::GetStore() {
+  return *Store_;
+}
+
+userver::yaml_config::Schema TIdempotencyStoreComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: Component for idempotency keys deduplication on send
+additionalProperties: false
+properties:
+    shards-amount:
+        type: integer
+        description: Amount of shards in Sharded Map of dedup windows
+    type:
+        type: string
+        description: Realization of idempotency store
+        enum:
+          - None
+          - ShardedMap
+)");
+}
+}  // namespace NChat::NInfra::NComponents
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <app/services/message/idempotency_store.hpp>
+
+#include <infra/components/object_factory.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TIdempotencyStoreComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "idempotency-store-component";
+
+  TIdempotencyStoreComponent(const userver::components::ComponentConfig& config,
+                             const userver::components::ComponentContext& context);
+
+  NApp::IIdempotencyStore& GetStore();
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  TObjectFactory<NApp::IIdempotencyStore> GetStoreFactory();
+
+ private:
+  std::unique_ptr<NApp::IIdempotencyStore> Store_;
+};
+
+}  // namespace NChat::NInfra::NComponents
@@ -1,12 +1,13 @@
 #include "send_limiter_component.hpp"
 
+#include <infra/components/config/config_cache_component.hpp>
+#include <infra/messaging/limiter/atomic_limiter.hpp>
 #include <infra/messaging/limiter/dummy_limiter.hpp>
 #include <infra/messaging/limiter/sharded_limiter.hpp>
 
 #include <userver/components/component.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/components/statistics_storage.hpp>
-#include <userver/dynamic_config/storage/component.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -22,12 +23,22 @@ TObjectFactory<NApp::ISendLimiter> TSendLimiterComponent::GetLimiterFactory() {
 
   limiter_factory.Register("ShardedMap", [](const auto& config, const auto& context) {
     const auto shards_amount = config["shards-amount"].template As<std::size_t>(256);
-    auto config_source = context.template FindComponent<userver::components::DynamicConfig>().GetSource();
+    const auto& config_cache = context.template FindComponent<TConfigCacheComponent>().GetCache();
     auto& limiter_stats = context.template FindComponent<userver::components::StatisticsStorage>()
                               .GetMetricsStorage()
                               ->GetMetric(kLimiterTag);
 
-    return std::make_unique<TSendLimiter>(shards_amount, config_source, limiter_stats);
+    return std::make_unique<TSendLimiter>(shards_amount, config_cache, limiter_stats);
+  });
+
+  limiter_factory.Register("AtomicArray", [](const auto& config, const auto& context) {
+    const auto slots_amount = config["slots-amount"].template As<std::size_t>(1 << 16);
+    const auto& config_cache = context.template FindComponent<TConfigCacheComponent>().GetCache();
+    auto& limiter_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                              .GetMetricsStorage()
+                              ->GetMetric(kLimiterTag);
+
+    return std::make_unique<TAtomicLimiter>(slots_amount, config_cache, limiter_stats);
   });
 
   limiter_factory.Register(
@@ -50,12 +61,16 @@ properties:
     shards-amount:
         type: integer
         description: Amount of shards in Sharded Map in Registry/Limiter
+    slots-amount:
+        type: integer
+        description: Amount of slots in AtomicArray limiter, must be a degree of 2
     type:
         type: string
         description: Realization of limiter
         enum:
           - None  
           - ShardedMap
+          - AtomicArray
 )");
 }
 }  // namespace NChat::NInfra::NComponents
@@ -1,7 +1,13 @@
 #include "messaging_service_component.hpp"
 
 #include <infra/components/chats/chat_repository_component.hpp>
+#include <infra/components/messaging/backpressure/send_backpressure_component.hpp>
+#include <infra/components/messaging/bus/message_bus_component.hpp>
+#include <infra/components/messaging/drain/drain_component.hpp>
+#include <infra/components/messaging/history/message_history_component.hpp>
+#include <infra/components/messaging/idempotency/idempotency_store_component.hpp>
 #include <infra/components/messaging/limiter/send_limiter_component.hpp>
+#include <infra/components/messaging/pipeline/fanout_pipeline_component.hpp>
 #include <infra/components/messaging/registry/mailbox_registry_component.hpp>
 #include <infra/components/users/user_repository_component.hpp>
 #include <infra/concurrency/queue/vyukov_queue.hpp>
@@ -27,9 +33,16 @@ TMessagingServiceComponent::TMessagingServiceComponent(const userver::components
   auto& limiter = context.FindComponent<NComponents::TSendLimiterComponent>().GetLimiter();
   auto& user_repo = context.FindComponent<NComponents::TUserRepoComponent>().GetRepository();
   auto& chat_repo = context.FindComponent<NComponents::TChatRepoComponent>().GetRepository();
+  auto& idempotency_store = context.FindComponent<NComponents::TIdempotencyStoreComponent>().GetStore();
+  auto& history_component = context.FindComponent<NComponents::TMessageHistoryComponent>();
+  auto& bus = context.FindComponent<NComponents::TMessageBusComponent>().GetBus();
+  auto* pipeline = context.FindComponent<NComponents::TFanOutPipelineComponent>().GetPipeline();
+  auto* backpressure = context.FindComponent<NComponents::TSendBackpressureComponent>().GetBackpressure();
+  auto& drain = context.FindComponent<NComponents::TDrainComponent>().GetDrain();
 
-  MessageService_ = std::make_unique<NApp::NServices::TMessagingService>(mailbox_registry, limiter, user_repo,
-                                                                         chat_repo);
+  MessageService_ = std::make_unique<NApp::NServices::TMessagingService>(
+      mailbox_registry, limiter, user_repo, chat_repo, idempotency_store, history_component.GetWriter(),
+      history_component.GetRecentMessages(), history_component.GetRepository(), bus, pipeline, backpressure, &drain);
 }
 
 NApp::NServices::TMessagingService& TMessagingServiceComponent::GetService() {
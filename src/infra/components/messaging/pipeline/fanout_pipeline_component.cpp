@@ -0,0 +1,76 @@
+#include "fanout_pipeline_component.hpp"
+
+#include <infra/components/messaging/backpressure/send_backpressure_component.hpp>
+#include <infra/components/messaging/bus/message_bus_component.hpp>
+#include <infra/components/messaging/history/message_history_component.hpp>
+#include <infra/components/messaging/registry/mailbox_registry_component.hpp>
+#include <infra/messaging/pipeline/worker_pipeline.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/dynamic_config/storage/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+TFanOutPipelineComponent::TFanOutPipelineComponent(const userver::components::ComponentConfig& config,
+                                                   const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      Pipeline_(GetPipelineFactory().Create(config, context, "type")) {
+}
+
+TObjectFactory<NCore::IFanOutPipeline> TFanOutPipelineComponent::GetPipelineFactory() {
+  TObjectFactory<NCore::IFanOutPipeline> pipeline_factory;
+
+  pipeline_factory.Register("Workers", [](const auto& config, const auto& context) {
+    auto& registry = context.template FindComponent<TMailboxRegistryComponent>().GetRegistry();
+    auto& recent = context.template FindComponent<TMessageHistoryComponent>().GetRecentMessages();
+    auto& bus = context.template FindComponent<TMessageBusComponent>().GetBus();
+    auto* backpressure = context.template FindComponent<TSendBackpressureComponent>().GetBackpressure();
+    auto config_source = context.template FindComponent<userver::components::DynamicConfig>().GetSource();
+    auto& pipeline_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                               .GetMetricsStorage()
+                               ->GetMetric(kFanOutTag);
+
+    TFanOutPipelineSettings settings;
+    settings.MaxBatchSize = config["max-batch-size"].template As<std::size_t>(settings.MaxBatchSize);
+
+    return std::make_unique<TWorkerFanOutPipeline>(registry, &recent, &bus, config_source, settings,
+                                                   pipeline_stats, backpressure);
+  });
+
+  pipeline_factory.Register("None", [](const auto& /* config */, const auto& /* context */) {
+    return std::unique_ptr<NCore::IFanOutPipeline>{};
+  });
+
+  return pipeline_factory;
+}
+
+NCore::IFanOutPipeline* TFanOutPipelineComponent::GetPipeline() {
+  return Pipeline_.get();
+}
+
+userver::yaml_config::Schema TFanOutPipelineComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: |
+    Component for the fan-out pipeline between accepting a send and delivering it;
+    amount and size of queues are set by FANOUT_PIPELINE_CONFIG
+additionalProperties: false
+properties:
+    type:
+        type: string
+        description: Realization of fan-out
+        enum:
+          - None
+          - Workers
+    max-batch-size:
+        type: integer
+        description: Max amount of messages a worker routes in one pass
+        defaultDescription: 100
+)");
+}
+
+}  // namespace NChat::NInfra::NComponents
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <core/messaging/pipeline/fanout_pipeline.hpp>
+
+#include <infra/components/object_factory.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TFanOutPipelineComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "fanout-pipeline-component";
+
+  TFanOutPipelineComponent(const userver::components::ComponentConfig& config,
+                           const userver::components::ComponentContext& context);
+
+  // nullptr при type: None - отправка маршрутизируется синхронно в корутине запроса
+  NCore::IFanOutPipeline* GetPipeline();
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  TObjectFactory<NCore::IFanOutPipeline> GetPipelineFactory();
+
+ private:
+  std::unique_ptr<NCore::IFanOutPipeline> Pipeline_;
+};
+
+}  // namespace NChat::NInfra::NComponents
@@ -0,0 +1,117 @@
+#include "presence_component.hpp"
+
+#include <infra/db/presence/postgres_presence_store.hpp>
+#include <infra/messaging/presence/in_memory_presence_store.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/storages/postgres/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+TPresenceComponent::TPresenceComponent(const userver::components::ComponentConfig& config,
+                                       const userver::components::ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      Store_(GetStoreFactory().Create(config, context, "type")) {
+  if (!Store_) {
+    return;
+  }
+
+  auto& presence_stats =
+      context.FindComponent<userver::components::StatisticsStorage>().GetMetricsStorage()->GetMetric(kPresenceTag);
+
+  TPresenceSettings settings;
+  settings.NodeId = NCore::NDomain::TNodeId{config["node-id"].As<std::string>("node-1")};
+  settings.LeaseTtl = config["lease-ttl"].As<std::chrono::seconds>(settings.LeaseTtl);
+  settings.CacheTtl = config["cache-ttl"].As<std::chrono::milliseconds>(settings.CacheTtl);
+  settings.CacheSize = config["cache-size"].As<std::size_t>(settings.CacheSize);
+  settings.CacheShardsAmount = config["cache-shards-amount"].As<std::size_t>(settings.CacheShardsAmount);
+  settings.PublishInterval = config["publish-interval"].As<std::chrono::milliseconds>(settings.PublishInterval);
+  settings.BatchSize = config["batch-size"].As<std::size_t>(settings.BatchSize);
+
+  Directory_ = std::make_unique<TPresenceDirectory>(*Store_, std::move(settings), presence_stats);
+}
+
+TObjectFactory<NCore::IPresenceStore> TPresenceComponent::GetStoreFactory() {
+  TObjectFactory<NCore::IPresenceStore> store_factory;
+
+  store_factory.Register("Postgres", [](const auto& config, const auto& context) {
+    const auto pg_component_name = config["postgres-component"].template As<std::string>("chat-postgres-database");
+    auto& pg_component = context.template FindComponent<userver::components::Postgres>(pg_component_name);
+
+    return std::make_unique<NRepository::TPostgresPresenceStore>(pg_component.GetCluster());
+  });
+
+  store_factory.Register("InMemory", [](const auto& /* config */, const auto& /* context */) {
+    return std::make_unique<TInMemoryPresenceStore>();
+  });
+
+  store_factory.Register("None", [](const auto& /* config */, const auto& /* context */) {
+    return std::unique_ptr<NCore::IPresenceStore>{};
+  });
+
+  return store_factory;
+}
+
+NCore::IPresencePublisher* TPresenceComponent::GetPublisher() {
+  return Directory_.get();
+}
+
+NCore::INodeLocator* TPresenceComponent::GetLocator() {
+  return Directory_.get();
+}
+
+userver::yaml_config::Schema TPresenceComponent::GetStaticConfigSchema() {
+  return userver::yaml_config::MergeSchemas<userver::components::LoggableComponentBase>(
+      R"(
+type: object
+description: Component for the user to node presence directory of the cluster
+additionalProperties: false
+properties:
+    type:
+        type: string
+        description: Storage of presence leases
+        enum:
+          - None
+          - InMemory
+          - Postgres
+    node-id:
+        type: string
+        description: Name of this instance in the cluster, must match node-id of message-bus-component
+        defaultDescription: node-1
+    postgres-component:
+        type: string
+        description: Name of the postgres component for the Postgres type
+        defaultDescription: chat-postgres-database
+    lease-ttl:
+        type: string
+        description: |
+            Lifetime of a lease; the mailbox garbage collector rewrites a lease once less than
+            a third of it is left, so a third must span several GC periods, and GC must stay enabled
+        defaultDescription: 60s
+    cache-ttl:
+        type: string
+        description: How long a looked up location (or its absence) is trusted without asking the storage
+        defaultDescription: 2000ms
+    cache-size:
+        type: integer
+        description: Max amount of cached user locations
+        defaultDescription: 100000
+    cache-shards-amount:
+        type: integer
+        description: Amount of shards in the location cache
+        defaultDescription: 64
+    publish-interval:
+        type: string
+        description: Max time a new or removed mailbox waits before its lease is published or revoked
+        defaultDescription: 100ms
+    batch-size:
+        type: integer
+        description: Max amount of users in one storage request
+        defaultDescription: 1000
+)");
+}
+
+}  // namespace NChat::NInfra::NComponents
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <core/messaging/bus/node_locator.hpp>
+#include <core/messaging/presence/presence.hpp>
+
+#include <infra/components/object_factory.hpp>
+#include <infra/messaging/presence/presence_directory.hpp>
+
+#include <userver/components/loggable_component_base.hpp>
+
+namespace NChat::NInfra::NComponents {
+
+class TPresenceComponent final : public userver::components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "presence-component";
+
+  TPresenceComponent(const userver::components::ComponentConfig& config,
+                     const userver::components::ComponentContext& context);
+
+  // nullptr при type: None - узел не публикует своих пользователей и не ищет чужих
+  NCore::IPresencePublisher* GetPublisher();
+  NCore::INodeLocator* GetLocator();
+
+  static userver::yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  TObjectFactory<NCore::IPresenceStore> GetStoreFactory();
+
+ private:
+  std::unique_ptr<NCore::IPresenceStore> Store_;
+  std::unique_ptr<TPresenceDirectory> Directory_;
+};
+
+}  // namespace NChat::NInfra::NComponents
@@ -1,5 +1,8 @@
 #include "mailbox_registry_component.hpp"
 
+#include <infra/components/config/config_cache_component.hpp>
+#include <infra/components/messaging/admission/overload_sensor_component.hpp>
+#include <infra/components/messaging/presence/presence_component.hpp>
 #include <infra/components/messaging/sessions/sessions_registry_component.hpp>
 #include <infra/messaging/queue/vyukov_queue_factory.hpp>
 #include <infra/messaging/registry/sharded_registry.hpp>
@@ -7,7 +10,6 @@
 #include <userver/components/component.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/components/statistics_storage.hpp>
-#include <userver/dynamic_config/storage/component.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -25,12 +27,15 @@ TObjectFactory<NCore::IMailboxRegistry> TMailboxRegistryComponent::GetRegistryFa
 
   registry_factory.Register("ShardedMap", [this](const auto& config, const auto& context) {
     const auto shards_amount = config["shards-amount"].template As<std::size_t>(256);
-    auto config_source = context.template FindComponent<userver::components::DynamicConfig>().GetSource();
+    const auto& config_cache = context.template FindComponent<TConfigCacheComponent>().GetCache();
     auto& registry_stats = context.template FindComponent<userver::components::StatisticsStorage>()
                                .GetMetricsStorage()
                                ->GetMetric(kMailboxTag);
+    auto* presence = context.template FindComponent<TPresenceComponent>().GetPublisher();
+    const auto* overload = context.template FindComponent<TOverloadSensorComponent>().GetSensor();
 
-    return std::make_unique<TShardedRegistry>(shards_amount, SessionsFactory_, config_source, registry_stats);
+    return std::make_unique<TShardedRegistry>(shards_amount, SessionsFactory_, config_cache, registry_stats,
+                                              presence, overload);
   });
 
   return registry_factory;
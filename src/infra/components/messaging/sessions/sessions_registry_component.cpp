@@ -1,6 +1,8 @@
 #include "sessions_registry_component.hpp"
 
+#include <infra/components/config/config_cache_component.hpp>
 #include <infra/components/messaging/sessions/sessions_registry_component.hpp>
+#include <infra/messaging/queue/priority_queue_factory.hpp>
 #include <infra/messaging/queue/vyukov_queue_factory.hpp>
 #include <infra/messaging/registry/sharded_registry.hpp>
 #include <infra/messaging/sessions/factory/rcu_sessions_factory.hpp>
@@ -26,12 +28,21 @@ TObjectFactory<NCore::ISessionsFactory> TSessionsFactoryComponent::GetSessionsFa
   TObjectFactory<NCore::ISessionsFactory> sessions_factory;
 
   sessions_factory.Register("RcuFlatMap", [this](const auto& /*config*/, const auto& context) {
-    auto config_source = context.template FindComponent<userver::components::DynamicConfig>().GetSource();
+    const auto& config_cache = context.template FindComponent<TConfigCacheComponent>().GetCache();
+    auto& sessions_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                               .GetMetricsStorage()
+                               ->GetMetric(kSessionsTag);
+
+    return std::make_unique<TRcuSessionsFactory>(*QueueFactory_, config_cache, sessions_stats);
+  });
+
+  sessions_factory.Register("RcuSharedRing", [this](const auto& /*config*/, const auto& context) {
+    const auto& config_cache = context.template FindComponent<TConfigCacheComponent>().GetCache();
     auto& sessions_stats = context.template FindComponent<userver::components::StatisticsStorage>()
                                .GetMetricsStorage()
                                ->GetMetric(kSessionsTag);
 
-    return std::make_unique<TRcuSessionsFactory>(*QueueFactory_, config_source, sessions_stats);
+    return std::make_unique<TRcuSessionsFactory>(*QueueFactory_, config_cache, sessions_stats, true);
   });
 
   return sessions_factory;
@@ -45,6 +56,11 @@ TObjectFactory<NCore::IMessageQueueFactory> TSessionsFactoryComponent::GetQueueF
     return std::make_unique<TVyukovQueueFactory>(config_source);
   });
 
+  queue_factory.Register("PriorityLanes", [](const auto& /*config*/, const auto& context) {
+    auto config_source = context.template FindComponent<userver::components::DynamicConfig>().GetSource();
+    return std::make_unique<TPriorityQueueFactory>(config_source);
+  });
+
   return queue_factory;
 }
 
@@ -61,14 +77,16 @@ additionalProperties: false
 properties:
     registry-type:
         type: string
-        description: Type of the Map in Sessions Registry
+        description: Type of the Map in Sessions Registry (RcuSharedRing - one queue per mailbox for all sessions)
         enum:
           - RcuFlatMap
+          - RcuSharedRing
     queue-type:
         type: string
-        description: Type of the MPSC Queue in Mailbox
+        description: Type of the MPSC Queue in Mailbox (PriorityLanes - service messages bypass the full queue)
         enum:
           - Vyukov
+          - PriorityLanes
 )");
 }
 }  // namespace NChat::NInfra::NComponents
@@ -1,30 +1,60 @@
 #include "user_repository_component.hpp"
 
 #include <infra/components/object_factory.hpp>
+#include <infra/db/user/metrics/profile_cache_stats.hpp>
+#include <infra/db/user/metrics/user_lookup_stats.hpp>
 #include <infra/db/user/postgres_user_repository.hpp>
 
 #include <userver/components/component.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/storages/postgres/component.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <algorithm>
+#include <chrono>
+
 namespace NChat::NInfra::NComponents {
 
 TUserRepoComponent::TUserRepoComponent(const userver::components::ComponentConfig& config,
                                        const userver::components::ComponentContext& context)
     : LoggableComponentBase(config, context) {
+  const auto absent_cache_size = config["absent-cache-size"].As<std::size_t>(0);
+  if (absent_cache_size > 0) {
+    const auto ways = config["absent-cache-ways"].As<std::size_t>(16);
+    AbsentCache_ = std::make_unique<TAbsentUsernameCache>(
+        ways, std::max<std::size_t>(absent_cache_size / ways, 1),
+        config["absent-cache-ttl"].As<std::chrono::milliseconds>(std::chrono::seconds(2)));
+  }
+
   TObjectFactory<NCore::IUserRepository> repo_factory;
 
-  repo_factory.Register("postgres", [](const auto& config, const auto& context) {
+  repo_factory.Register("postgres", [this](const auto& config, const auto& context) {
     const auto pg_component_name = config["postgres-component"].template As<std::string>("chat-postgres-database");
     auto& pg_component = context.template FindComponent<userver::components::Postgres>(pg_component_name);
+    auto& lookup_stats = context.template FindComponent<userver::components::StatisticsStorage>()
+                             .GetMetricsStorage()
+                             ->GetMetric(kUserLookupTag);
 
     return std::make_unique<NRepository::TPostgresUserRepository>(
-        pg_component.GetCluster(), context.template FindComponent<TProfileByUsernameCache>(),
-        context.template FindComponent<TProfileByUserIdCache>());
+        pg_component.GetCluster(), context.template FindComponent<TProfileCache>(), lookup_stats, AbsentCache_.get());
   });
 
   UserRepo_ = repo_factory.Create(config, context, "storage-type");
+
+  if (config["storage-type"].As<std::string>() == "postgres") {
+    const auto& profile_cache = context.FindComponent<TProfileCache>();
+    auto& storage = context.FindComponent<userver::components::StatisticsStorage>().GetStorage();
+
+    ProfileCacheStats_ = storage.RegisterWriter(
+        "chat_profile_cache",
+        [&profile_cache](userver::utils::statistics::Writer& writer) { writer = *profile_cache.Get(); });
+  }
+}
+
+TUserRepoComponent::~TUserRepoComponent() {
+  ProfileCacheStats_.Unregister();
 }
 
 NCore::IUserRepository& TUserRepoComponent::GetRepository() {
@@ -52,6 +82,18 @@ properties:
         type: string
         description: Name of the YDB component to use
         defaultDescription: chat-ydb-database
+    absent-cache-size:
+        type: integer
+        description: Max amount of usernames remembered as absent after a database miss, 0 disables cache
+        defaultDescription: 0
+    absent-cache-ways:
+        type: integer
+        description: Amount of independently locked LRU ways in absent usernames cache
+        defaultDescription: 16
+    absent-cache-ttl:
+        type: string
+        description: How long a database miss is trusted, bounds the delay before a user registered elsewhere is found
+        defaultDescription: 2s
 )");
 }
 }  // namespace NChat::NInfra::NComponents
@@ -2,7 +2,10 @@
 
 #include <core/users/user_repo.hpp>
 
+#include <infra/db/user/absent_cache/absent_username_cache.hpp>
+
 #include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 namespace NChat::NInfra::NComponents {
 
@@ -12,13 +15,16 @@ class TUserRepoComponent final : public userver::components::LoggableComponentBa
 
   TUserRepoComponent(const userver::components::ComponentConfig& config,
                      const userver::components::ComponentContext& context);
+  ~TUserRepoComponent() override;
 
   NCore::IUserRepository& GetRepository();
 
   static userver::yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  std::unique_ptr<TAbsentUsernameCache> AbsentCache_;
   std::unique_ptr<NCore::IUserRepository> UserRepo_;
+  userver::utils::statistics::Entry ProfileCacheStats_;
 };
 
 }  // namespace NChat::NInfra::NComponents
@@ -1,13 +1,19 @@
 #include "user_service_component.hpp"
 
 #include <infra/auth/auth_service_impl.hpp>
+#include <infra/components/auth/jwt_codec_component.hpp>
 #include <infra/components/users/user_repository_component.hpp>
 #include <infra/db/user/postgres_user_repository.hpp>
 
 #include <userver/components/component.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <algorithm>
+#include <optional>
+#include <string>
+
 namespace NChat::NInfra::NComponents {
 
 TUserServiceComponent::TUserServiceComponent(const userver::components::ComponentConfig& config,
@@ -15,7 +21,39 @@ TUserServiceComponent::TUserServiceComponent(const userver::components::Componen
     : LoggableComponentBase(config, context) {
   auto& user_repo = context.FindComponent<NComponents::TUserRepoComponent>().GetRepository();
 
-  AuthService_ = std::make_unique<TAuthServiceImpl>(config["token-expiry-hours"].As<int>());
+  const auto token_cache_size = config["token-cache-size"].As<std::size_t>(0);
+  if (token_cache_size > 0) {
+    const auto ways = config["token-cache-ways"].As<std::size_t>(16);
+    auto& cache_stats = context.FindComponent<userver::components::StatisticsStorage>()
+                            .GetMetricsStorage()
+                            ->GetMetric(kTokenCacheTag);
+
+    TokenCache_ = std::make_unique<TVerifiedTokenCache>(ways, std::max<std::size_t>(token_cache_size / ways, 1),
+                                                        cache_stats);
+  }
+
+  const auto& jwt_codec = context.FindComponent<TJwtCodecComponent>().GetCodec();
+
+  const NKdf::TKdfSettings kdf{
+      .Type = NKdf::ParseKdfType(config["password-kdf"].As<std::string>("pbkdf2-sha256")),
+      .Pbkdf2Iterations = config["pbkdf2-iterations"].As<std::uint32_t>(600'000),
+      .ScryptN = config["scrypt-n"].As<std::uint64_t>(1 << 15),
+      .ScryptR = config["scrypt-r"].As<std::uint32_t>(8),
+      .ScryptP = config["scrypt-p"].As<std::uint32_t>(1),
+  };
+
+  if (auto task_processor = config["auth-task-processor"].As<std::optional<std::string>>()) {
+    auto& executor_stats = context.FindComponent<userver::components::StatisticsStorage>()
+                               .GetMetricsStorage()
+                               ->GetMetric(kAuthExecutorTag);
+
+    AuthExecutor_ = std::make_unique<TAuthExecutor>(context.GetTaskProcessor(*task_processor),
+                                                    config["auth-max-concurrency"].As<std::size_t>(4),
+                                                    config["auth-max-queue"].As<std::size_t>(256), executor_stats);
+  }
+
+  AuthService_ = std::make_unique<TAuthServiceImpl>(config["token-expiry-hours"].As<int>(), 32, &jwt_codec,
+                                                    TokenCache_.get(), kdf, AuthExecutor_.get());
   UserService_ = std::make_unique<NApp::NServices::TUserService>(user_repo, *AuthService_);
 }
 
@@ -33,6 +71,40 @@ properties:
     token-expiry-hours:
       type: integer
       description: Token expiry duration in hours
+    token-cache-size:
+      type: integer
+      description: Max amount of verified tokens in cache, 0 disables cache
+    token-cache-ways:
+      type: integer
+      description: Amount of independently locked LRU ways in token cache
+    password-kdf:
+      type: string
+      description: Password KDF for new hashes, old hashes are verified with their own parameters
+      enum:
+        - sha256
+        - pbkdf2-sha256
+        - scrypt
+    pbkdf2-iterations:
+      type: integer
+      description: PBKDF2-HMAC-SHA256 iterations count
+    scrypt-n:
+      type: integer
+      description: scrypt CPU/memory cost, power of two
+    scrypt-r:
+      type: integer
+      description: scrypt block size
+    scrypt-p:
+      type: integer
+      description: scrypt parallelization
+    auth-task-processor:
+      type: string
+      description: Task processor for password hashing, without it KDF runs on the request task processor
+    auth-max-concurrency:
+      type: integer
+      description: Max amount of password hashes computed at once
+    auth-max-queue:
+      type: integer
+      description: Max amount of requests waiting for hashing, above it requests are rejected with 429
 )");
 }
 }  // namespace NChat::NInfra::NComponents
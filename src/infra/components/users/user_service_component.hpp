@@ -2,6 +2,9 @@
 
 #include <app/services/user/user_service.hpp>
 
+#include <infra/auth/executor/auth_executor.hpp>
+#include <infra/auth/token_cache/token_cache.hpp>
+
 #include <userver/components/loggable_component_base.hpp>
 
 namespace NChat::NInfra::NComponents {
@@ -18,6 +21,8 @@ class TUserServiceComponent final : public userver::components::LoggableComponen
   static userver::yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  std::unique_ptr<TVerifiedTokenCache> TokenCache_;
+  std::unique_ptr<TAuthExecutor> AuthExecutor_;
   std::unique_ptr<NCore::IAuthService> AuthService_;
   std::unique_ptr<NApp::NServices::TUserService> UserService_;
 };
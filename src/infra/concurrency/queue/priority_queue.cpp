@@ -0,0 +1,95 @@
+#include "priority_queue.hpp"
+
+#include <userver/utils/datetime_light.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+#include <mutex>
+
+namespace NChat::NInfra {
+
+TPriorityMessageQueue::TPriorityMessageQueue(std::size_t max_size, std::size_t max_service_size)
+    : ServiceQueue_(TQueue::Create(max_service_size)),
+      ServiceProducer_(ServiceQueue_->GetMultiProducer()),
+      ServiceConsumer_(ServiceQueue_->GetConsumer()),
+      Queue_(TQueue::Create(max_size)),
+      Producer_(Queue_->GetMultiProducer()),
+      Consumer_(Queue_->GetConsumer()) {
+}
+
+bool TPriorityMessageQueue::Push(TMessage&& message) {
+  message.Context.Enqueued = userver::utils::datetime::SteadyNow();
+
+  auto& producer = message.Class != NCore::NDomain::EMessageClass::Regular ? ServiceProducer_ : Producer_;
+  if (!producer.PushNoblock(std::move(message))) {
+    return false;
+  }
+
+  NonEmptyEvent_.Send();
+  return true;
+}
+
+std::vector<NCore::NDomain::TMessage> TPriorityMessageQueue::PopBatch(std::size_t max_batch_size,
+                                                                     std::chrono::milliseconds timeout) {
+  if (HasConsumer_.exchange(true)) {
+    throw NCore::TConsumerAlreadyExists("Queue already has a consumer. Multi-consumer access is not allowed.");
+  }
+  userver::utils::FastScopeGuard guard([this] noexcept { HasConsumer_.store(false); });
+
+  // ShedOldest держит consumer недолго и без ожиданий: поллер дожидается его, а не получает отказ
+  std::lock_guard consumer_lock(ConsumerMutex_);
+
+  const auto deadline = userver::engine::Deadline::FromDuration(timeout);
+  std::vector<TMessage> message_batch;
+
+  // Событие могло остаться взведенным от уже выбранных сообщений: после пробуждения лейны снова могут быть пусты
+  while (true) {
+    Drain(ServiceConsumer_, message_batch, max_batch_size);
+    Drain(Consumer_, message_batch, max_batch_size);
+
+    if (!message_batch.empty() || !NonEmptyEvent_.WaitForEventUntil(deadline)) {
+      return message_batch;
+    }
+  }
+}
+
+void TPriorityMessageQueue::Drain(TQueue::Consumer& consumer, std::vector<TMessage>& batch,
+                                  std::size_t max_batch_size) {
+  TMessage message;
+  while (batch.size() < max_batch_size && consumer.PopNoblock(message)) {
+    message.Context.Dequeued = userver::utils::datetime::SteadyNow();
+    batch.emplace_back(std::move(message));
+  }
+}
+
+std::vector<NCore::NDomain::TMessage> TPriorityMessageQueue::ShedOldest(std::size_t keep) {
+  std::unique_lock consumer_lock(ConsumerMutex_, std::try_to_lock);
+  if (!consumer_lock.owns_lock()) {
+    return {};  // поллер сам разбирает очередь
+  }
+
+  std::vector<TMessage> shed;
+  TMessage message;
+  while (Queue_->GetSizeApproximate() > keep && Consumer_.PopNoblock(message)) {
+    shed.push_back(std::move(message));
+  }
+
+  return shed;
+}
+
+std::size_t TPriorityMessageQueue::GetSizeApproximate() const {
+  return ServiceQueue_->GetSizeApproximate() + Queue_->GetSizeApproximate();
+}
+
+bool TPriorityMessageQueue::HasConsumer() const {
+  return HasConsumer_.load();
+}
+
+void TPriorityMessageQueue::SetMaxSize(std::size_t max_size) {
+  Queue_->SetSoftMaxSize(max_size);
+}
+
+std::size_t TPriorityMessageQueue::GetMaxSize() const {
+  return Queue_->GetSoftMaxSize();
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <core/messaging/queue/message_queue.hpp>
+
+#include <userver/concurrent/mpsc_queue.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+namespace NChat::NInfra {
+
+/*
+Two lanes over Vyukov MPSC queues. Service messages go to their own lane, which PopBatch drains first:
+a normal lane full of chat messages neither rejects nor delays control traffic. Each lane has its own max size.
+A service lane that is still full is a stuck consumer: the push is rejected like a normal overflow,
+and the session reports resync so the client refetches chat state instead of trusting a gap.
+The consumer sleeps on a single event that both lanes signal after a successful push.
+*/
+class TPriorityMessageQueue : public NCore::IMessageQueue {
+ public:
+  using TMessage = NCore::NDomain::TMessage;
+  using TQueue = userver::concurrent::MpscQueue<TMessage>;
+
+  TPriorityMessageQueue(std::size_t max_size, std::size_t max_service_size);
+
+  bool Push(TMessage&& message) override;
+
+  std::vector<TMessage> PopBatch(std::size_t max_batch_size, std::chrono::milliseconds timeout) override;
+
+  std::size_t GetSizeApproximate() const override;
+
+  // Только из обычной лейны: служебные сообщения не теряются
+  std::vector<TMessage> ShedOldest(std::size_t keep) override;
+
+  bool HasConsumer() const override;
+
+  // Только обычная лейна; размер служебной задается при создании
+  void SetMaxSize(std::size_t max_size) override;
+  std::size_t GetMaxSize() const override;
+
+ private:
+  void Drain(TQueue::Consumer& consumer, std::vector<TMessage>& batch, std::size_t max_batch_size);
+
+ private:
+  std::shared_ptr<TQueue> ServiceQueue_;
+  TQueue::MultiProducer ServiceProducer_;
+  TQueue::Consumer ServiceConsumer_;
+
+  std::shared_ptr<TQueue> Queue_;
+  TQueue::MultiProducer Producer_;
+  TQueue::Consumer Consumer_;
+
+  userver::engine::SingleConsumerEvent NonEmptyEvent_;
+  std::atomic_bool HasConsumer_;
+
+  // Единственный consumer MPSC-очереди: поллер держит его всю выборку, ShedOldest - только если он свободен
+  userver::engine::Mutex ConsumerMutex_;
+};
+
+}  // namespace NChat::NInfra
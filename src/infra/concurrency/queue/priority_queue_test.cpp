@@ -0,0 +1,132 @@
+#include "priority_queue.hpp"
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+#include <atomic>
+
+namespace NChat::NInfra {
+
+namespace {
+
+using NCore::NDomain::EMessageClass;
+using NCore::NDomain::TMessage;
+
+constexpr std::size_t kServiceSize = 4;
+
+TMessage CreateTestMessage(const std::string& text, EMessageClass message_class = EMessageClass::Regular) {
+  return TMessage{.Payload = std::make_shared<NCore::NDomain::TMessagePayload>(NCore::NDomain::TUserId("user1"),
+                                                                               NCore::NDomain::TMessageText(text)),
+                  .ChatId = NCore::NDomain::TChatId{"chat2"},
+                  .Context = {},
+                  .Class = message_class};
+}
+}  // namespace
+
+UTEST(PriorityMessageQueue, ServiceLaneDrainedFirst) {
+  TPriorityMessageQueue queue(10, kServiceSize);
+
+  EXPECT_TRUE(queue.Push(CreateTestMessage("first")));
+  EXPECT_TRUE(queue.Push(CreateTestMessage("second")));
+  EXPECT_TRUE(queue.Push(CreateTestMessage("member joined", EMessageClass::Service)));
+
+  auto batch = queue.PopBatch(10, std::chrono::milliseconds(100));
+  ASSERT_EQ(batch.size(), 3);
+  EXPECT_EQ(batch[0].Payload->Text.Value(), "member joined");
+  EXPECT_EQ(batch[1].Payload->Text.Value(), "first");
+  EXPECT_EQ(batch[2].Payload->Text.Value(), "second");
+}
+
+UTEST(PriorityMessageQueue, FullNormalLaneDoesNotRejectService) {
+  constexpr std::size_t kMaxSize = 2;
+  TPriorityMessageQueue queue(kMaxSize, kServiceSize);
+
+  std::size_t accepted = 0;
+  for (std::size_t i = 0; i < kMaxSize + 2; ++i) {
+    accepted += queue.Push(CreateTestMessage("Message " + std::to_string(i)));
+  }
+  ASSERT_LT(accepted, kMaxSize + 2) << "Normal lane should reject at least one message";
+
+  EXPECT_TRUE(queue.Push(CreateTestMessage("member left", EMessageClass::Service)));
+
+  // Служебное сообщение не ждет, пока разберут обычные
+  auto batch = queue.PopBatch(1, std::chrono::milliseconds(100));
+  ASSERT_EQ(batch.size(), 1);
+  EXPECT_EQ(batch[0].Class, EMessageClass::Service);
+}
+
+UTEST(PriorityMessageQueue, ShedOldestKeepsServiceLane) {
+  TPriorityMessageQueue queue(10, kServiceSize);
+
+  for (std::size_t i = 0; i < 6; ++i) {
+    EXPECT_TRUE(queue.Push(CreateTestMessage("Message " + std::to_string(i))));
+  }
+  EXPECT_TRUE(queue.Push(CreateTestMessage("member joined", EMessageClass::Service)));
+
+  EXPECT_EQ(queue.ShedOldest(2).size(), 4);
+
+  auto batch = queue.PopBatch(10, std::chrono::milliseconds(100));
+  ASSERT_EQ(batch.size(), 3);
+  EXPECT_EQ(batch[0].Class, EMessageClass::Service);
+  EXPECT_EQ(batch[1].Payload->Text.Value(), "Message 4");
+  EXPECT_EQ(batch[2].Payload->Text.Value(), "Message 5");
+}
+
+UTEST(PriorityMessageQueue, ServiceLaneIsBounded) {
+  TPriorityMessageQueue queue(10, kServiceSize);
+
+  std::size_t accepted = 0;
+  for (std::size_t i = 0; i < kServiceSize + 2; ++i) {
+    accepted += queue.Push(CreateTestMessage("notice " + std::to_string(i), EMessageClass::Service));
+  }
+  ASSERT_LT(accepted, kServiceSize + 2) << "Service lane should reject pushes once full";
+
+  // Переполнение служебной лейны не трогает обычную
+  EXPECT_TRUE(queue.Push(CreateTestMessage("regular")));
+
+  auto batch = queue.PopBatch(20, std::chrono::milliseconds(100));
+  ASSERT_EQ(batch.size(), accepted + 1);
+  EXPECT_EQ(batch[0].Payload->Text.Value(), "notice 0");
+  EXPECT_EQ(batch.back().Payload->Text.Value(), "regular");
+}
+
+UTEST(PriorityMessageQueue, PopBatchWakesOnServiceMessage) {
+  TPriorityMessageQueue queue(10, kServiceSize);
+
+  auto pop_task = userver::utils::Async("pop_task", [&queue] { return queue.PopBatch(10, std::chrono::seconds(5)); });
+
+  userver::engine::SleepFor(std::chrono::milliseconds(100));
+  EXPECT_TRUE(queue.Push(CreateTestMessage("notice", EMessageClass::Service)));
+
+  auto batch = pop_task.Get();
+  ASSERT_EQ(batch.size(), 1);
+  EXPECT_EQ(batch[0].Payload->Text.Value(), "notice");
+}
+
+UTEST_MT(PriorityMessageQueue, ShedOldestDoesNotRejectPoller, 3) {
+  TPriorityMessageQueue queue(100, kServiceSize);
+  std::atomic<bool> stop{false};
+
+  auto shedder_task = userver::utils::Async("shedder", [&] {
+    while (!stop.load()) {
+      for (std::size_t i = 0; i < 10; ++i) {
+        queue.Push(CreateTestMessage("Message " + std::to_string(i)));
+      }
+      queue.ShedOldest(2);
+      userver::engine::Yield();
+    }
+  });
+
+  auto consumer_task = userver::utils::Async("consumer", [&] {
+    for (std::size_t i = 0; i < 500; ++i) {
+      queue.PopBatch(10, std::chrono::milliseconds(1));
+    }
+  });
+
+  EXPECT_NO_THROW(consumer_task.Get());
+  stop.store(true);
+  shedder_task.Get();
+}
+
+}  // namespace NChat::NInfra
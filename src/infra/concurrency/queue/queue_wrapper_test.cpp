@@ -346,4 +346,30 @@ UTEST(VyukovMessageQueue, MultipleBatchesExhaustQueue) {
   EXPECT_EQ(queue.GetSizeApproximate(), 0);
 }
 
+UTEST_MT(VyukovMessageQueue, ShedOldestDoesNotRejectPoller, 3) {
+  TVyukovMessageQueue queue(100);
+  std::atomic<bool> stop{false};
+
+  // Сборщик мусора постоянно срезает очередь: поллер ждет его, а не получает TConsumerAlreadyExists
+  auto shedder_task = userver::utils::Async("shedder", [&] {
+    while (!stop.load()) {
+      for (std::size_t i = 0; i < 10; ++i) {
+        queue.Push(CreateTestMessage("Message " + std::to_string(i)));
+      }
+      queue.ShedOldest(2);
+      userver::engine::Yield();
+    }
+  });
+
+  auto consumer_task = userver::utils::Async("consumer", [&] {
+    for (std::size_t i = 0; i < 500; ++i) {
+      queue.PopBatch(10, std::chrono::milliseconds(1));
+    }
+  });
+
+  EXPECT_NO_THROW(consumer_task.Get());
+  stop.store(true);
+  shedder_task.Get();
+}
+
 }  // namespace NChat::NInfra
@@ -0,0 +1,195 @@
+#include "shared_ring_queue.hpp"
+
+#include <utils/memory/memory_budget.hpp>
+
+#include <userver/utils/datetime_light.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+#include <algorithm>
+
+namespace NChat::NInfra {
+
+TSharedMessageRing::TSharedMessageRing(std::size_t max_size) : MaxSize_(max_size) {
+}
+
+TSharedMessageRing::~TSharedMessageRing() {
+  while (!Buffer_.empty()) {
+    PopFront();
+  }
+}
+
+TSharedMessageRing::TCursorId TSharedMessageRing::AddCursor() {
+  std::lock_guard lock(Mutex_);
+  const auto cursor_id = NextCursorId_++;
+  Cursors_.emplace(cursor_id, TCursor{.Seq = GetHeadSeq()});
+  return cursor_id;
+}
+
+void TSharedMessageRing::RemoveCursor(TCursorId cursor_id) {
+  std::lock_guard lock(Mutex_);
+  Cursors_.erase(cursor_id);
+  TrimConsumed();
+}
+
+bool TSharedMessageRing::Push(TMessage&& message) {
+  message.Context.Enqueued = userver::utils::datetime::SteadyNow();
+
+  {
+    std::lock_guard lock(Mutex_);
+
+    // Nobody would ever read it
+    if (Cursors_.empty()) {
+      return true;
+    }
+
+    const auto max_size = std::max<std::size_t>(1, MaxSize_.load(std::memory_order_relaxed));
+    while (Buffer_.size() >= max_size) {
+      for (auto& [_, cursor] : Cursors_) {
+        if (cursor.Seq == BaseSeq_) {
+          ++cursor.Seq;
+          cursor.Missed = true;
+        }
+      }
+
+      PopFront();
+    }
+
+    NUtils::NMemory::Charge(message.GetFootprint());
+    Buffer_.push_back(std::move(message));
+  }
+
+  NewMessages_.NotifyAll();
+  return true;
+}
+
+std::vector<TSharedMessageRing::TMessage> TSharedMessageRing::Read(TCursorId cursor_id, std::size_t max_batch_size,
+                                                                   userver::engine::Deadline deadline) {
+  std::unique_lock lock(Mutex_);
+
+  auto has_unread = [this, cursor_id] {
+    auto it = Cursors_.find(cursor_id);
+    return it == Cursors_.end() || it->second.Seq < GetHeadSeq();
+  };
+
+  if (!NewMessages_.WaitUntil(lock, deadline, has_unread)) {
+    return {};
+  }
+
+  auto it = Cursors_.find(cursor_id);
+  if (it == Cursors_.end()) {
+    return {};
+  }
+
+  auto& cursor = it->second;
+  const auto amount = std::min<std::uint64_t>(max_batch_size, GetHeadSeq() - cursor.Seq);
+  const auto now = userver::utils::datetime::SteadyNow();
+
+  std::vector<TMessage> message_batch;
+  message_batch.reserve(amount);
+
+  for (std::uint64_t seq = cursor.Seq; seq < cursor.Seq + amount; ++seq) {
+    auto& message = message_batch.emplace_back(Buffer_[seq - BaseSeq_]);
+    message.Context.Dequeued = now;
+  }
+
+  cursor.Seq += amount;
+  TrimConsumed();
+
+  return message_batch;
+}
+
+bool TSharedMessageRing::ConsumeMissed(TCursorId cursor_id) {
+  std::lock_guard lock(Mutex_);
+
+  auto it = Cursors_.find(cursor_id);
+  return it != Cursors_.end() && std::exchange(it->second.Missed, false);
+}
+
+std::size_t TSharedMessageRing::GetSize() const {
+  std::lock_guard lock(Mutex_);
+  return Buffer_.size();
+}
+
+std::size_t TSharedMessageRing::GetLag(TCursorId cursor_id) const {
+  std::lock_guard lock(Mutex_);
+
+  auto it = Cursors_.find(cursor_id);
+  return it != Cursors_.end() ? GetHeadSeq() - it->second.Seq : 0;
+}
+
+void TSharedMessageRing::SetMaxSize(std::size_t max_size) {
+  MaxSize_.store(max_size, std::memory_order_relaxed);
+}
+
+std::size_t TSharedMessageRing::GetMaxSize() const {
+  return MaxSize_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t TSharedMessageRing::GetHeadSeq() const {
+  return BaseSeq_ + Buffer_.size();
+}
+
+void TSharedMessageRing::TrimConsumed() {
+  auto min_seq = GetHeadSeq();
+  for (const auto& [_, cursor] : Cursors_) {
+    min_seq = std::min(min_seq, cursor.Seq);
+  }
+
+  while (BaseSeq_ < min_seq) {
+    PopFront();
+  }
+}
+
+void TSharedMessageRing::PopFront() {
+  NUtils::NMemory::Release(Buffer_.front().GetFootprint());
+  Buffer_.pop_front();
+  ++BaseSeq_;
+}
+
+TSharedRingCursorQueue::TSharedRingCursorQueue(std::shared_ptr<TSharedMessageRing> ring)
+    : Ring_(std::move(ring)), CursorId_(Ring_->AddCursor()) {
+}
+
+TSharedRingCursorQueue::~TSharedRingCursorQueue() {
+  Ring_->RemoveCursor(CursorId_);
+}
+
+bool TSharedRingCursorQueue::Push(TMessage&& message) {
+  return Ring_->Push(std::move(message));
+}
+
+std::vector<TSharedRingCursorQueue::TMessage> TSharedRingCursorQueue::PopBatch(std::size_t max_batch_size,
+                                                                               std::chrono::milliseconds timeout) {
+  if (HasConsumer_.exchange(true)) {
+    throw NCore::TConsumerAlreadyExists("Queue already has a consumer. Multi-consumer access is not allowed.");
+  }
+
+  userver::utils::FastScopeGuard guard([this] noexcept { HasConsumer_.store(false); });
+  return Ring_->Read(CursorId_, max_batch_size, userver::engine::Deadline::FromDuration(timeout));
+}
+
+std::size_t TSharedRingCursorQueue::GetSizeApproximate() const {
+  return Ring_->GetLag(CursorId_);
+}
+
+void TSharedRingCursorQueue::SetMaxSize(std::size_t max_size) {
+  Ring_->SetMaxSize(max_size);
+}
+
+std::size_t TSharedRingCursorQueue::GetMaxSize() const {
+  return Ring_->GetMaxSize();
+}
+
+bool TSharedRingCursorQueue::HasConsumer() const {
+  return HasConsumer_.load();
+}
+
+bool TSharedRingCursorQueue::ConsumeMissed() {
+  return Ring_->ConsumeMissed(CursorId_);
+}
+
+bool TSharedRingCursorQueue::ChargesMemory() const {
+  return true;
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <core/messaging/queue/message_queue.hpp>
+
+#include <boost/container/flat_map.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+namespace NChat::NInfra {
+
+// Общее кольцо сообщений почтового ящика: одна запись на все сессии, у каждой сессии свой курсор чтения.
+// Сообщение хранится, пока его не вычитали все курсоры. При переполнении вытесняется самое старое,
+// а отстающие курсоры помечаются как пропустившие сообщения.
+// Бюджет памяти узла кольцо учитывает само: сообщение учитывается один раз на все сессии, пока лежит в кольце.
+class TSharedMessageRing {
+ public:
+  using TMessage = NCore::NDomain::TMessage;
+  using TCursorId = std::uint64_t;
+
+  explicit TSharedMessageRing(std::size_t max_size);
+  ~TSharedMessageRing();
+
+  TCursorId AddCursor();
+  void RemoveCursor(TCursorId cursor_id);
+
+  bool Push(TMessage&& message);
+  std::vector<TMessage> Read(TCursorId cursor_id, std::size_t max_batch_size, userver::engine::Deadline deadline);
+
+  // true, если курсор потерял сообщения с прошлого вызова
+  bool ConsumeMissed(TCursorId cursor_id);
+
+  std::size_t GetSize() const;
+  std::size_t GetLag(TCursorId cursor_id) const;
+
+  void SetMaxSize(std::size_t max_size);
+  std::size_t GetMaxSize() const;
+
+ private:
+  struct TCursor {
+    std::uint64_t Seq = 0;
+    bool Missed = false;
+  };
+
+  std::uint64_t GetHeadSeq() const;
+  void PopFront();
+  void TrimConsumed();
+
+ private:
+  mutable userver::engine::Mutex Mutex_;
+  userver::engine::ConditionVariable NewMessages_;
+
+  std::deque<TMessage> Buffer_;
+  std::uint64_t BaseSeq_ = 0;  // Sequence number of Buffer_.front()
+  boost::container::flat_map<TCursorId, TCursor> Cursors_;
+  TCursorId NextCursorId_ = 0;
+
+  std::atomic<std::size_t> MaxSize_;
+};
+
+// Очередь сессии поверх общего кольца: Push пишет сразу для всех сессий ящика
+class TSharedRingCursorQueue : public NCore::IMessageQueue {
+ public:
+  using TMessage = NCore::NDomain::TMessage;
+
+  explicit TSharedRingCursorQueue(std::shared_ptr<TSharedMessageRing> ring);
+  ~TSharedRingCursorQueue() override;
+
+  bool Push(TMessage&& message) override;
+  std::vector<TMessage> PopBatch(std::size_t max_batch_size, std::chrono::milliseconds timeout) override;
+
+  std::size_t GetSizeApproximate() const override;
+
+  void SetMaxSize(std::size_t max_size) override;
+  std::size_t GetMaxSize() const override;
+
+  bool HasConsumer() const override;
+  bool ConsumeMissed() override;
+  bool ChargesMemory() const override;
+
+ private:
+  std::shared_ptr<TSharedMessageRing> Ring_;
+  TSharedMessageRing::TCursorId CursorId_;
+  std::atomic_bool HasConsumer_{false};
+};
+
+}  // namespace NChat::NInfra
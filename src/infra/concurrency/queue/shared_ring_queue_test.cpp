@@ -0,0 +1,195 @@
+#include "shared_ring_queue.hpp"
+
+#include <core/messaging/session/session.hpp>
+
+#include <utils/memory/memory_budget.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+
+namespace NChat::NInfra {
+
+namespace {
+
+NCore::NDomain::TMessage CreateTestMessage(const std::string& text) {
+  return NCore::NDomain::TMessage{
+      .Payload = std::make_shared<NCore::NDomain::TMessagePayload>(NCore::NDomain::TUserId("user1"),
+                                                                   NCore::NDomain::TMessageText(text)),
+      .ChatId = NCore::NDomain::TChatId{"chat1"},
+      .Context = {}};
+}
+}  // namespace
+
+UTEST(SharedRingQueue, SinglePushReadByAllCursors) {
+  auto ring = std::make_shared<TSharedMessageRing>(10);
+  TSharedRingCursorQueue tab1(ring);
+  TSharedRingCursorQueue tab2(ring);
+
+  EXPECT_TRUE(tab1.Push(CreateTestMessage("Hello")));
+
+  // Stored once for both tabs
+  EXPECT_EQ(ring->GetSize(), 1);
+  EXPECT_EQ(tab1.GetSizeApproximate(), 1);
+  EXPECT_EQ(tab2.GetSizeApproximate(), 1);
+
+  auto batch1 = tab1.PopBatch(10, std::chrono::milliseconds(100));
+  ASSERT_EQ(batch1.size(), 1);
+  EXPECT_EQ(batch1[0].Payload->Text.Value(), "Hello");
+
+  // Still held for the second tab
+  EXPECT_EQ(ring->GetSize(), 1);
+
+  auto batch2 = tab2.PopBatch(10, std::chrono::milliseconds(100));
+  ASSERT_EQ(batch2.size(), 1);
+  EXPECT_EQ(ring->GetSize(), 0);
+}
+
+UTEST(SharedRingQueue, NewCursorStartsAtHead) {
+  auto ring = std::make_shared<TSharedMessageRing>(10);
+  TSharedRingCursorQueue tab1(ring);
+  tab1.Push(CreateTestMessage("old"));
+
+  TSharedRingCursorQueue tab2(ring);
+  EXPECT_EQ(tab2.GetSizeApproximate(), 0);
+  EXPECT_TRUE(tab2.PopBatch(10, std::chrono::milliseconds(10)).empty());
+}
+
+UTEST(SharedRingQueue, RemovedCursorReleasesMessages) {
+  auto ring = std::make_shared<TSharedMessageRing>(10);
+  TSharedRingCursorQueue tab1(ring);
+
+  {
+    TSharedRingCursorQueue tab2(ring);
+    tab1.Push(CreateTestMessage("msg"));
+    tab1.PopBatch(10, std::chrono::milliseconds(10));
+    EXPECT_EQ(ring->GetSize(), 1);
+  }
+
+  EXPECT_EQ(ring->GetSize(), 0);
+}
+
+UTEST(SharedRingQueue, OverflowMarksOnlyLaggingCursor) {
+  auto ring = std::make_shared<TSharedMessageRing>(2);
+  TSharedRingCursorQueue fast(ring);
+  TSharedRingCursorQueue slow(ring);
+
+  for (int i = 0; i < 3; ++i) {
+    ring->Push(CreateTestMessage(std::to_string(i)));
+    fast.PopBatch(10, std::chrono::milliseconds(10));
+  }
+
+  EXPECT_FALSE(fast.ConsumeMissed());
+  EXPECT_TRUE(slow.ConsumeMissed());
+  EXPECT_FALSE(slow.ConsumeMissed());
+
+  auto batch = slow.PopBatch(10, std::chrono::milliseconds(10));
+  ASSERT_EQ(batch.size(), 2);
+  EXPECT_EQ(batch[0].Payload->Text.Value(), "1");
+  EXPECT_EQ(batch[1].Payload->Text.Value(), "2");
+}
+
+UTEST(SharedRingQueue, BatchLimit) {
+  auto ring = std::make_shared<TSharedMessageRing>(10);
+  TSharedRingCursorQueue tab(ring);
+
+  for (int i = 0; i < 5; ++i) {
+    tab.Push(CreateTestMessage(std::to_string(i)));
+  }
+
+  EXPECT_EQ(tab.PopBatch(3, std::chrono::milliseconds(10)).size(), 3);
+  EXPECT_EQ(tab.PopBatch(3, std::chrono::milliseconds(10)).size(), 2);
+}
+
+UTEST(SharedRingQueue, LongPollWakesUp) {
+  auto ring = std::make_shared<TSharedMessageRing>(10);
+  TSharedRingCursorQueue tab(ring);
+
+  auto consumer = userver::engine::AsyncNoSpan([&] { return tab.PopBatch(10, std::chrono::seconds(5)); });
+
+  userver::engine::SleepFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(tab.HasConsumer());
+  ring->Push(CreateTestMessage("wake"));
+
+  auto batch = consumer.Get();
+  ASSERT_EQ(batch.size(), 1);
+  EXPECT_EQ(batch[0].Payload->Text.Value(), "wake");
+}
+
+UTEST(SharedRingQueue, SingleConsumerPerCursor) {
+  auto ring = std::make_shared<TSharedMessageRing>(10);
+  TSharedRingCursorQueue tab(ring);
+
+  auto consumer = userver::engine::AsyncNoSpan([&] { return tab.PopBatch(10, std::chrono::milliseconds(200)); });
+  userver::engine::SleepFor(std::chrono::milliseconds(50));
+
+  EXPECT_THROW(tab.PopBatch(10, std::chrono::milliseconds(10)), NCore::TConsumerAlreadyExists);
+  consumer.Get();
+}
+
+// Сообщение учитывается один раз на все курсоры и освобождается, когда покидает кольцо
+UTEST(SharedRingQueue, ChargedOncePerPush) {
+  const auto baseline = NUtils::NMemory::GetChargedBytes();
+  auto ring = std::make_shared<TSharedMessageRing>(2);
+  TSharedRingCursorQueue tab1(ring);
+  TSharedRingCursorQueue tab2(ring);
+
+  const auto message = CreateTestMessage("Hello");
+  const auto footprint = message.GetFootprint();
+
+  ring->Push(NCore::NDomain::TMessage{message});
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), baseline + footprint);
+
+  tab1.PopBatch(10, std::chrono::milliseconds(10));
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), baseline + footprint);
+
+  tab2.PopBatch(10, std::chrono::milliseconds(10));
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), baseline);
+
+  // Вытеснение при переполнении и разрушение кольца тоже освобождают байты
+  for (int i = 0; i < 3; ++i) {
+    ring->Push(NCore::NDomain::TMessage{message});
+  }
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), baseline + 2 * footprint);
+}
+
+UTEST(SharedRingQueue, DestroyedRingReleasesMessages) {
+  const auto baseline = NUtils::NMemory::GetChargedBytes();
+  {
+    auto ring = std::make_shared<TSharedMessageRing>(10);
+    TSharedRingCursorQueue tab(ring);
+    ring->Push(CreateTestMessage("unread"));
+    EXPECT_GT(NUtils::NMemory::GetChargedBytes(), baseline);
+  }
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), baseline);
+}
+
+// Сессии над общим кольцом не учитывают сообщения сами: иначе каждая вкладка освобождала бы чужие байты
+UTEST(SharedRingQueue, SessionsDoNotReleaseRingBytes) {
+  const auto baseline = NUtils::NMemory::GetChargedBytes();
+  auto ring = std::make_shared<TSharedMessageRing>(10);
+  auto now = [] { return userver::utils::datetime::SteadyNow(); };
+
+  {
+    NCore::TUserSession tab1(NCore::NDomain::TSessionId{"tab1"}, std::make_unique<TSharedRingCursorQueue>(ring), now);
+    NCore::TUserSession tab2(NCore::NDomain::TSessionId{"tab2"}, std::make_unique<TSharedRingCursorQueue>(ring), now);
+
+    for (int i = 0; i < 3; ++i) {
+      ring->Push(CreateTestMessage(std::to_string(i)));
+    }
+
+    EXPECT_EQ(tab1.GetMessages(10, std::chrono::seconds(0)).Messages.size(), 3);
+    EXPECT_EQ(tab2.GetMessages(10, std::chrono::seconds(0)).Messages.size(), 3);
+    EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), baseline);
+
+    // Запись через сессию, как при обычной доставке, тоже учитывается только кольцом
+    EXPECT_TRUE(tab1.PushMessage(CreateTestMessage("direct"), 1));
+    EXPECT_GT(NUtils::NMemory::GetChargedBytes(), baseline);
+  }
+
+  ring.reset();
+  EXPECT_EQ(NUtils::NMemory::GetChargedBytes(), baseline);
+}
+
+}  // namespace NChat::NInfra
@@ -3,6 +3,8 @@
 #include <userver/utils/datetime_light.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
+#include <mutex>
+
 namespace {
 std::chrono::steady_clock::time_point GetNowTimePoint() {
   return userver::utils::datetime::SteadyNow();
@@ -20,18 +22,24 @@ bool TVyukovMessageQueue::Push(TMessage&& message) {
   return Producer_.PushNoblock(std::move(message));
 }
 
+bool TVyukovMessageQueue::PushWithDeadline(TMessage&& message, userver::engine::Deadline deadline) {
+  message.Context.Enqueued = GetNowTimePoint();
+  return Producer_.Push(std::move(message), deadline);
+}
+
 std::vector<TMessage> TVyukovMessageQueue::PopBatch(std::size_t max_batch_size, std::chrono::milliseconds timeout) {
   TMessage message;
   if (HasConsumer_.exchange(true)) {
     throw NCore::TConsumerAlreadyExists("Queue already has a consumer. Multi-consumer access is not allowed.");
   }
-  {
-    userver::utils::FastScopeGuard guard([this] noexcept { HasConsumer_.store(false); });
+  userver::utils::FastScopeGuard guard([this] noexcept { HasConsumer_.store(false); });
+
+  // ShedOldest держит consumer недолго и без ожиданий: поллер дожидается его, а не получает отказ
+  std::lock_guard consumer_lock(ConsumerMutex_);
 
-    // Здесь как раз и сидит Long Polling
-    if (!Consumer_.Pop(message, userver::engine::Deadline::FromDuration(timeout))) {
-      return {};
-    }
+  // Здесь как раз и сидит Long Polling
+  if (!Consumer_.Pop(message, userver::engine::Deadline::FromDuration(timeout))) {
+    return {};
   }
   message.Context.Dequeued = GetNowTimePoint();
 
@@ -47,6 +55,21 @@ std::vector<TMessage> TVyukovMessageQueue::PopBatch(std::size_t max_batch_size,
   return message_batch;
 }
 
+std::vector<TMessage> TVyukovMessageQueue::ShedOldest(std::size_t keep) {
+  std::unique_lock consumer_lock(ConsumerMutex_, std::try_to_lock);
+  if (!consumer_lock.owns_lock()) {
+    return {};  // поллер сам разбирает очередь
+  }
+
+  std::vector<TMessage> shed;
+  TMessage message;
+  while (Queue_->GetSizeApproximate() > keep && Consumer_.PopNoblock(message)) {
+    shed.push_back(std::move(message));
+  }
+
+  return shed;
+}
+
 std::size_t TVyukovMessageQueue::GetSizeApproximate() const {
   return Queue_->GetSizeApproximate();
 }
@@ -3,6 +3,7 @@
 #include <core/messaging/queue/message_queue.hpp>
 
 #include <userver/concurrent/mpsc_queue.hpp>
+#include <userver/engine/mutex.hpp>
 
 namespace NChat::NInfra {
 
@@ -16,10 +17,15 @@ class TVyukovMessageQueue : public NCore::IMessageQueue {
 
   bool Push(TMessage&& message) override;
 
+  // Ждет освобождения места до дедлайна, для продюсеров, которым нельзя терять сообщения
+  bool PushWithDeadline(TMessage&& message, userver::engine::Deadline deadline);
+
   std::vector<TMessage> PopBatch(std::size_t max_batch_size, std::chrono::milliseconds timeout) override;
 
   std::size_t GetSizeApproximate() const override;
 
+  std::vector<TMessage> ShedOldest(std::size_t keep) override;
+
   bool HasConsumer() const override;
 
   void SetMaxSize(std::size_t max_size) override;
@@ -30,6 +36,9 @@ class TVyukovMessageQueue : public NCore::IMessageQueue {
   TQueue::MultiProducer Producer_;
   TQueue::Consumer Consumer_;
   std::atomic_bool HasConsumer_;
+
+  // Единственный consumer MPSC-очереди: поллер держит его всю выборку, ShedOldest - только если он свободен
+  userver::engine::Mutex ConsumerMutex_;
 };
 
 }  // namespace NChat::NInfra
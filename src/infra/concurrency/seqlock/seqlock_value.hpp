@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace NChat::NInfra::NConcurrency {
+
+/*
+Value for read-mostly data with a single writer.
+Readers only load atomics of one cache line and never write shared memory, so they don't contend with each other.
+Reader retries if it overlaps with a write.
+*/
+template <typename T>
+class TSeqLockValue {
+  static_assert(std::is_trivially_copyable_v<T>, "TSeqLockValue requires trivially copyable type");
+  static_assert(std::is_default_constructible_v<T>);
+
+ public:
+  explicit TSeqLockValue(const T& value = T{}) {
+    Store(value);
+  }
+
+  TSeqLockValue(const TSeqLockValue&) = delete;
+  TSeqLockValue& operator=(const TSeqLockValue&) = delete;
+
+  T Load() const noexcept {
+    TWords words;
+
+    while (true) {
+      const auto seq_before = Sequence_.load(std::memory_order_acquire);
+      if (seq_before & 1) {
+        continue;  // Write in progress, it is short
+      }
+
+      for (std::size_t i = 0; i < kWordsAmount; ++i) {
+        words[i] = Words_[i].load(std::memory_order_relaxed);
+      }
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (Sequence_.load(std::memory_order_relaxed) == seq_before) {
+        break;
+      }
+    }
+
+    T value;
+    std::memcpy(&value, words.data(), sizeof(T));
+    return value;
+  }
+
+  // Not thread-safe between writers
+  void Store(const T& value) noexcept {
+    TWords words{};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    const auto seq = Sequence_.load(std::memory_order_relaxed);
+    Sequence_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t i = 0; i < kWordsAmount; ++i) {
+      Words_[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    Sequence_.store(seq + 2, std::memory_order_release);
+  }
+
+ private:
+  static constexpr std::size_t kWordsAmount = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+  using TWords = std::array<std::uint64_t, kWordsAmount>;
+
+  std::atomic<std::uint64_t> Sequence_{0};
+  std::array<std::atomic<std::uint64_t>, kWordsAmount> Words_{};
+};
+
+}  // namespace NChat::NInfra::NConcurrency
@@ -0,0 +1,73 @@
+#include "seqlock_value.hpp"
+
+#include <gtest/gtest.h>
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace NChat::NInfra::NConcurrency;
+
+namespace {
+struct TTestConfig {
+  bool IsEnabled{false};
+  std::size_t First{0};
+  std::size_t Second{0};
+  std::chrono::seconds Timeout{0};
+};
+}  // namespace
+
+UTEST(SeqLockValue, DefaultValue) {
+  TSeqLockValue<TTestConfig> value;
+  const auto loaded = value.Load();
+
+  EXPECT_FALSE(loaded.IsEnabled);
+  EXPECT_EQ(loaded.First, 0);
+  EXPECT_EQ(loaded.Timeout, std::chrono::seconds(0));
+}
+
+UTEST(SeqLockValue, StoreLoad) {
+  TSeqLockValue<TTestConfig> value({.IsEnabled = true, .First = 1, .Second = 2, .Timeout = std::chrono::seconds(3)});
+  EXPECT_TRUE(value.Load().IsEnabled);
+
+  value.Store({.IsEnabled = false, .First = 10, .Second = 20, .Timeout = std::chrono::seconds(30)});
+  const auto loaded = value.Load();
+
+  EXPECT_FALSE(loaded.IsEnabled);
+  EXPECT_EQ(loaded.First, 10);
+  EXPECT_EQ(loaded.Second, 20);
+  EXPECT_EQ(loaded.Timeout, std::chrono::seconds(30));
+}
+
+UTEST_MT(SeqLockValue, ReadersNeverSeeTornValue, 4) {
+  TSeqLockValue<TTestConfig> value;
+  std::atomic<bool> stop{false};
+  std::atomic<std::size_t> torn{0};
+
+  std::vector<userver::engine::TaskWithResult<void>> readers;
+  for (std::size_t i = 0; i + 1 < GetThreadCount(); ++i) {
+    readers.push_back(userver::engine::AsyncNoSpan([&]() {
+      while (!stop.load(std::memory_order_relaxed)) {
+        const auto loaded = value.Load();
+        // Writer keeps all fields equal
+        if (loaded.First != loaded.Second || loaded.Timeout.count() != static_cast<std::int64_t>(loaded.First)) {
+          torn.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    }));
+  }
+
+  for (std::size_t i = 1; i <= 100'000; ++i) {
+    value.Store({.IsEnabled = true, .First = i, .Second = i, .Timeout = std::chrono::seconds(i)});
+  }
+
+  stop.store(true, std::memory_order_relaxed);
+  for (auto& reader : readers) {
+    reader.Get();
+  }
+
+  EXPECT_EQ(torn.load(), 0);
+}
@@ -69,6 +69,27 @@ class TShardedMap {
     }
   }
 
+  // Колбэк зовется вне блокировок шарда: ему можно писать в значения и ждать
+  template <typename Callback>
+  void ForEach(Callback callback) {
+    std::vector<ValuePtr> values;
+
+    for (auto& shard : Shards_) {
+      values.clear();
+      {
+        std::shared_lock lock(shard.Mutex);
+        values.reserve(shard.Map.size());
+        for (const auto& [key, value_ptr] : shard.Map) {
+          values.push_back(value_ptr);
+        }
+      }
+
+      for (const auto& value : values) {
+        callback(value);
+      }
+    }
+  }
+
   template <typename Predicate, typename MetricsCallback>
   std::size_t CleanupAndCount(Predicate should_remove_pred, MetricsCallback metrics_cb,
                               std::chrono::milliseconds shard_delay = std::chrono::milliseconds{0}) {
@@ -0,0 +1,46 @@
+#include "config_cache.hpp"
+
+namespace NChat::NInfra {
+
+TConfigCache::TConfigCache(userver::dynamic_config::Source config_source) {
+  ConfigSubscription_ = config_source.UpdateAndListen(this, "chat-config-cache", &TConfigCache::OnConfigUpdate);
+}
+
+TConfigCache::~TConfigCache() {
+  ConfigSubscription_.Unsubscribe();
+}
+
+void TConfigCache::OnConfigUpdate(const userver::dynamic_config::Snapshot& config) {
+  LimiterConfig_.Store(config[kLimiterConfig]);
+  RegistryConfig_.Store(config[kRegistryConfig]);
+  SessionsConfig_.Store(config[kSessionsConfig]);
+  QueueConfig_.Store(config[kQueueConfig]);
+  PollingConfig_.Store(config[kPollingConfig]);
+  BackpressureConfig_.Store(config[kBackpressureConfig]);
+}
+
+TLimiterConfig TConfigCache::GetLimiterConfig() const {
+  return LimiterConfig_.Load();
+}
+
+TRegistryConfig TConfigCache::GetRegistryConfig() const {
+  return RegistryConfig_.Load();
+}
+
+TSessionsConfig TConfigCache::GetSessionsConfig() const {
+  return SessionsConfig_.Load();
+}
+
+TQueueConfig TConfigCache::GetQueueConfig() const {
+  return QueueConfig_.Load();
+}
+
+TPollingSettings TConfigCache::GetPollingConfig() const {
+  return PollingConfig_.Load();
+}
+
+TBackpressureConfig TConfigCache::GetBackpressureConfig() const {
+  return BackpressureConfig_.Load();
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <infra/concurrency/seqlock/seqlock_value.hpp>
+#include <infra/messaging/backpressure/config/backpressure_config.hpp>
+#include <infra/messaging/limiter/config/limiter_config.hpp>
+#include <infra/messaging/queue/queue_config.hpp>
+#include <infra/messaging/registry/config/registry_config.hpp>
+#include <infra/messaging/sessions/config/sessions_config.hpp>
+
+#include <api/http/v1/messages/polling/config/polling_config.hpp>
+
+#include <userver/concurrent/async_event_source.hpp>
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/source.hpp>
+
+namespace NChat::NInfra {
+
+// Parsed hot path configs. Updated once per config change instead of a snapshot per request
+class TConfigCache final {
+ public:
+  explicit TConfigCache(userver::dynamic_config::Source config_source);
+  ~TConfigCache();
+
+  TConfigCache(const TConfigCache&) = delete;
+  TConfigCache& operator=(const TConfigCache&) = delete;
+
+  TLimiterConfig GetLimiterConfig() const;
+  TRegistryConfig GetRegistryConfig() const;
+  TSessionsConfig GetSessionsConfig() const;
+  TQueueConfig GetQueueConfig() const;
+  TPollingSettings GetPollingConfig() const;
+  TBackpressureConfig GetBackpressureConfig() const;
+
+ private:
+  void OnConfigUpdate(const userver::dynamic_config::Snapshot& config);
+
+ private:
+  NConcurrency::TSeqLockValue<TLimiterConfig> LimiterConfig_;
+  NConcurrency::TSeqLockValue<TRegistryConfig> RegistryConfig_;
+  NConcurrency::TSeqLockValue<TSessionsConfig> SessionsConfig_;
+  NConcurrency::TSeqLockValue<TQueueConfig> QueueConfig_;
+  NConcurrency::TSeqLockValue<TPollingSettings> PollingConfig_;
+  NConcurrency::TSeqLockValue<TBackpressureConfig> BackpressureConfig_;
+
+  // Must be the last: callback writes into the values above
+  userver::concurrent::AsyncEventSubscriberScope ConfigSubscription_;
+};
+
+}  // namespace NChat::NInfra
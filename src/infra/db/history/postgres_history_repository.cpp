@@ -0,0 +1,47 @@
+#include "postgres_history_repository.hpp"
+
+#include <NChat/sql_queries.hpp>
+#include <userver/storages/postgres/io/chrono.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace NChat::NInfra::NRepository {
+
+namespace {
+using NCore::NDomain::THistoryMessage;
+using NCore::NDomain::TMessagePayload;
+using NCore::NDomain::TMessageSeq;
+using NCore::NDomain::TMessageText;
+using NCore::NDomain::TUserId;
+}  // namespace
+
+TPostgresHistoryRepository::TPostgresHistoryRepository(userver::storages::postgres::ClusterPtr pg_cluster)
+    : PgCluster_(std::move(pg_cluster)) {
+}
+
+std::vector<THistoryMessage> TPostgresHistoryRepository::GetPage(const NCore::NDomain::TChatId& chat_id,
+                                                                  std::optional<TMessageSeq> before,
+                                                                  std::size_t limit) const {
+  // Keyset: индекс (channel_id, seq) читается с курсора назад ровно на limit строк, без OFFSET
+  auto result = PgCluster_->Execute(userver::storages::postgres::ClusterHostType::kSlave, sql::kGetMessagesPage,
+                                    chat_id.GetUnderlying(), before.value_or(std::numeric_limits<TMessageSeq>::max()),
+                                    static_cast<std::int64_t>(limit));
+
+  std::vector<THistoryMessage> page;
+  page.reserve(result.Size());
+
+  for (const auto& row : result) {
+    auto payload = std::make_shared<TMessagePayload>(TUserId{row["sender_id"].As<std::string>()},
+                                                     TMessageText{row["text"].As<std::string>()});
+
+    page.push_back({.Seq = row["seq"].As<TMessageSeq>(),
+                    .Payload = std::move(payload),
+                    .SentAt = row["created_at"].As<userver::storages::postgres::TimePointTz>().GetUnderlying()});
+  }
+
+  std::ranges::reverse(page);
+  return page;
+}
+
+}  // namespace NChat::NInfra::NRepository
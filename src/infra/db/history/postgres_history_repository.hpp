@@ -0,0 +1,21 @@
+#pragma once
+
+#include <core/messaging/history/history_repo.hpp>
+
+#include <userver/storages/postgres/cluster.hpp>
+
+namespace NChat::NInfra::NRepository {
+
+class TPostgresHistoryRepository : public NCore::IMessageHistoryRepository {
+ public:
+  explicit TPostgresHistoryRepository(userver::storages::postgres::ClusterPtr pg_cluster);
+
+  std::vector<NCore::NDomain::THistoryMessage> GetPage(const NCore::NDomain::TChatId& chat_id,
+                                                       std::optional<NCore::NDomain::TMessageSeq> before,
+                                                       std::size_t limit) const override;
+
+ private:
+  userver::storages::postgres::ClusterPtr PgCluster_;
+};
+
+}  // namespace NChat::NInfra::NRepository
@@ -0,0 +1,56 @@
+#include "postgres_presence_store.hpp"
+
+#include <NChat/sql_queries.hpp>
+
+namespace NChat::NInfra::NRepository {
+
+namespace {
+using NCore::NDomain::TNodeId;
+using NCore::NDomain::TUserId;
+
+std::vector<std::string> ToStrings(const std::vector<TUserId>& users) {
+  std::vector<std::string> ids;
+  ids.reserve(users.size());
+
+  for (const auto& user : users) {
+    ids.push_back(user.GetUnderlying());
+  }
+
+  return ids;
+}
+}  // namespace
+
+TPostgresPresenceStore::TPostgresPresenceStore(userver::storages::postgres::ClusterPtr pg_cluster)
+    : PgCluster_(std::move(pg_cluster)) {
+}
+
+void TPostgresPresenceStore::Upsert(const TNodeId& node_id, const std::vector<TUserId>& users,
+                                    std::chrono::seconds ttl) {
+  // Срок аренды считается по часам базы: часы узлов могут расходиться
+  PgCluster_->Execute(userver::storages::postgres::ClusterHostType::kMaster, sql::kUpsertPresence,
+                      node_id.GetUnderlying(), ToStrings(users), static_cast<double>(ttl.count()));
+}
+
+void TPostgresPresenceStore::Revoke(const TNodeId& node_id, const std::vector<TUserId>& users) {
+  // Заодно удаляются истекшие аренды этих пользователей на упавших узлах
+  PgCluster_->Execute(userver::storages::postgres::ClusterHostType::kMaster, sql::kRevokePresence,
+                      node_id.GetUnderlying(), ToStrings(users));
+}
+
+std::unordered_map<TUserId, std::vector<TNodeId>> TPostgresPresenceStore::Lookup(
+    const std::vector<TUserId>& users) const {
+  // Отставание реплики безопасно: устаревшая аренда дает лишнюю пересылку, получатель посчитает ее offline
+  auto result = PgCluster_->Execute(userver::storages::postgres::ClusterHostType::kSlave, sql::kGetPresence,
+                                    ToStrings(users));
+
+  std::unordered_map<TUserId, std::vector<TNodeId>> nodes;
+  nodes.reserve(result.Size());
+
+  for (const auto& row : result) {
+    nodes[TUserId{row["user_id"].As<std::string>()}].emplace_back(row["node_id"].As<std::string>());
+  }
+
+  return nodes;
+}
+
+}  // namespace NChat::NInfra::NRepository
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <core/messaging/presence/presence.hpp>
+
+#include <userver/storages/postgres/cluster.hpp>
+
+namespace NChat::NInfra::NRepository {
+
+class TPostgresPresenceStore : public NCore::IPresenceStore {
+ public:
+  explicit TPostgresPresenceStore(userver::storages::postgres::ClusterPtr pg_cluster);
+
+  void Upsert(const NCore::NDomain::TNodeId& node_id, const std::vector<NCore::NDomain::TUserId>& users,
+              std::chrono::seconds ttl) override;
+  void Revoke(const NCore::NDomain::TNodeId& node_id, const std::vector<NCore::NDomain::TUserId>& users) override;
+  std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> Lookup(
+      const std::vector<NCore::NDomain::TUserId>& users) const override;
+
+ private:
+  userver::storages::postgres::ClusterPtr PgCluster_;
+};
+
+}  // namespace NChat::NInfra::NRepository
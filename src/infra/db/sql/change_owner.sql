@@ -0,0 +1,29 @@
+WITH current_owner AS (
+    SELECT user_id
+    FROM chat.channel_members
+    WHERE channel_id = $1 AND role = chat.member_role_to_int('OWNER')
+    FOR UPDATE
+),
+new_owner AS (
+    SELECT user_id
+    FROM chat.channel_members
+    WHERE channel_id = $1 AND user_id = $2
+      AND user_id NOT IN (SELECT user_id FROM current_owner)
+    FOR UPDATE
+),
+demoted AS (
+    UPDATE chat.channel_members
+    SET role = chat.member_role_to_int('ADMIN')
+    WHERE channel_id = $1
+      AND user_id IN (SELECT user_id FROM current_owner)
+      AND EXISTS (SELECT 1 FROM new_owner)
+),
+promoted AS (
+    UPDATE chat.channel_members
+    SET role = chat.member_role_to_int('OWNER')
+    WHERE channel_id = $1
+      AND user_id IN (SELECT user_id FROM new_owner)
+      AND EXISTS (SELECT 1 FROM current_owner)
+)
+
+SELECT EXISTS (SELECT 1 FROM current_owner) AS has_owner;
\ No newline at end of file
@@ -1,2 +1,3 @@
-DELETE FROM chat.users
-WHERE username = $1;
\ No newline at end of file
+UPDATE chat.users
+SET is_deleted = true
+WHERE username = $1 AND NOT is_deleted;
\ No newline at end of file
@@ -1 +1 @@
-SELECT user_id FROM chat.users WHERE username = $1;
\ No newline at end of file
+SELECT user_id FROM chat.users WHERE username = $1 AND NOT is_deleted;
\ No newline at end of file
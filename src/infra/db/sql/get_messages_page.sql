@@ -0,0 +1,5 @@
+SELECT seq, sender_id, text, created_at
+FROM chat.messages
+WHERE channel_id = $1 AND seq < $2
+ORDER BY seq DESC
+LIMIT $3
\ No newline at end of file
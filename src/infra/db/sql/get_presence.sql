@@ -0,0 +1,3 @@
+SELECT user_id, node_id
+FROM chat.presence
+WHERE user_id = ANY($1::TEXT[]) AND expires_at > now()
\ No newline at end of file
@@ -1 +1 @@
-SELECT username, display_name FROM chat.users WHERE user_id = $1;
\ No newline at end of file
+SELECT username, display_name, updated_at FROM chat.users WHERE user_id = $1 AND NOT is_deleted;
\ No newline at end of file
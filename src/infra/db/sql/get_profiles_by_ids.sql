@@ -0,0 +1 @@
+SELECT user_id, username, display_name, updated_at FROM chat.users WHERE user_id = ANY($1::TEXT[]) AND NOT is_deleted;
\ No newline at end of file
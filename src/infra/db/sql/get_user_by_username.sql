@@ -1 +1 @@
-SELECT user_id, username, display_name, password_hash, salt, biography FROM chat.users WHERE username = $1;
\ No newline at end of file
+SELECT user_id, username, display_name, password_hash, salt, biography, updated_at FROM chat.users WHERE username = $1 AND NOT is_deleted;
\ No newline at end of file
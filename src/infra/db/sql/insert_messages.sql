@@ -0,0 +1,3 @@
+INSERT INTO chat.messages (channel_id, seq, sender_id, text, created_at)
+SELECT * FROM UNNEST($1::TEXT[], $2::BIGINT[], $3::TEXT[], $4::TEXT[], $5::TIMESTAMPTZ[])
+ON CONFLICT (channel_id, seq) DO NOTHING
\ No newline at end of file
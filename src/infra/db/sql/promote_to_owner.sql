@@ -1,3 +0,0 @@
-UPDATE chat.channel_members
-SET role = chat.member_role_to_int('OWNER')
-WHERE channel_id = $1 AND user_id = $2;
@@ -0,0 +1,2 @@
+DELETE FROM chat.presence
+WHERE user_id = ANY($2::TEXT[]) AND (node_id = $1 OR expires_at <= now())
\ No newline at end of file
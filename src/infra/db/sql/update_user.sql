@@ -5,5 +5,5 @@ SET
     biography = COALESCE($4, biography),
     password_hash = COALESCE($5, password_hash),
     salt = COALESCE($6, salt)
-WHERE username = $1
+WHERE username = $1 AND NOT is_deleted
 RETURNING username;
\ No newline at end of file
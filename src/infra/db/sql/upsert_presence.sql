@@ -0,0 +1,4 @@
+INSERT INTO chat.presence (user_id, node_id, expires_at)
+SELECT user_id, $1, now() + make_interval(secs => $3)
+FROM UNNEST($2::TEXT[]) AS user_id
+ON CONFLICT (user_id, node_id) DO UPDATE SET expires_at = EXCLUDED.expires_at
\ No newline at end of file
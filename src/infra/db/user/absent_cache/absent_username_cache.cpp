@@ -0,0 +1,36 @@
+#include "absent_username_cache.hpp"
+
+#include <userver/utils/datetime.hpp>
+
+#include <functional>
+
+namespace NChat::NInfra {
+
+TAbsentUsernameCache::TAbsentUsernameCache(std::size_t ways, std::size_t way_size, std::chrono::milliseconds ttl)
+    : Cache_(ways, way_size), Ttl_(ttl) {
+}
+
+bool TAbsentUsernameCache::Contains(std::string_view username) {
+  const auto now = userver::utils::datetime::SteadyNow();
+
+  // Expired entry and entry of a colliding name are evicted by the validator
+  return Cache_
+      .Get(std::hash<std::string_view>{}(username),
+           [now, username](const TEntry& entry) { return entry.Username == username && now < entry.ExpiresAt; })
+      .has_value();
+}
+
+void TAbsentUsernameCache::Put(std::string_view username) {
+  Cache_.Put(std::hash<std::string_view>{}(username),
+             TEntry{.Username = std::string{username}, .ExpiresAt = userver::utils::datetime::SteadyNow() + Ttl_});
+}
+
+void TAbsentUsernameCache::Erase(std::string_view username) {
+  Cache_.InvalidateByKey(std::hash<std::string_view>{}(username));
+}
+
+std::size_t TAbsentUsernameCache::GetSize() const {
+  return Cache_.GetSize();
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <userver/cache/nway_lru_cache.hpp>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+namespace NChat::NInfra {
+
+/*
+Short-lived memory of usernames the database has just reported as absent.
+Repeated lookups of a missing name (typos, spam) are answered without Postgres until the entry expires.
+A name registered on this instance is dropped at once, other instances see it after at most ttl.
+Entries are keyed by the hash of the name and keep the name itself, so a lookup by string_view does not allocate;
+a colliding name only evicts the entry.
+*/
+class TAbsentUsernameCache final {
+ public:
+  using TTimePoint = std::chrono::steady_clock::time_point;
+
+  TAbsentUsernameCache(std::size_t ways, std::size_t way_size, std::chrono::milliseconds ttl);
+
+  bool Contains(std::string_view username);
+  void Put(std::string_view username);
+  void Erase(std::string_view username);
+
+  std::size_t GetSize() const;
+
+ private:
+  struct TEntry {
+    std::string Username;
+    TTimePoint ExpiresAt;
+  };
+
+  userver::cache::NWayLRU<std::size_t, TEntry> Cache_;
+  const std::chrono::milliseconds Ttl_;
+};
+
+}  // namespace NChat::NInfra
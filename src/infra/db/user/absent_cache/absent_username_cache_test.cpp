@@ -0,0 +1,44 @@
+#include "absent_username_cache.hpp"
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+using namespace NChat::NInfra;
+
+namespace {
+const auto kNow = userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000");
+}  // namespace
+
+UTEST(AbsentUsernameCache, RemembersAbsentName) {
+  TAbsentUsernameCache cache(4, 16, std::chrono::seconds(2));
+
+  EXPECT_FALSE(cache.Contains("typo"));
+  cache.Put("typo");
+
+  EXPECT_TRUE(cache.Contains("typo"));
+  EXPECT_FALSE(cache.Contains("other"));
+  EXPECT_EQ(cache.GetSize(), 1);
+}
+
+UTEST(AbsentUsernameCache, EntryExpires) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TAbsentUsernameCache cache(4, 16, std::chrono::seconds(2));
+
+  cache.Put("typo");
+  userver::utils::datetime::MockSleep(std::chrono::seconds(1));
+  EXPECT_TRUE(cache.Contains("typo"));
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(1));
+  EXPECT_FALSE(cache.Contains("typo"));
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+UTEST(AbsentUsernameCache, EraseOnRegistration) {
+  TAbsentUsernameCache cache(4, 16, std::chrono::seconds(2));
+
+  cache.Put("newcomer");
+  cache.Erase("newcomer");
+
+  EXPECT_FALSE(cache.Contains("newcomer"));
+}
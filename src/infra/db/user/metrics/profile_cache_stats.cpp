@@ -0,0 +1,16 @@
+#include "profile_cache_stats.hpp"
+
+#include <userver/utils/statistics/writer.hpp>
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TProfileStore& store) {
+  const auto users = store.size();
+  const auto bytes = store.GetMemoryUsage();
+
+  writer["users"]["current"] = users;
+  writer["memory"]["bytes"]["current"] = bytes;
+  writer["memory"]["per_user"]["bytes"] = users > 0 ? bytes / users : 0;
+}
+
+}  // namespace NChat::NInfra
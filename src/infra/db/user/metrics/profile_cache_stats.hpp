@@ -0,0 +1,12 @@
+#pragma once
+
+#include <infra/db/user/profile_store.hpp>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+namespace NChat::NInfra {
+
+// Gauges are taken from the current cache snapshot on every dump
+void DumpMetric(userver::utils::statistics::Writer& writer, const TProfileStore& store);
+
+}  // namespace NChat::NInfra
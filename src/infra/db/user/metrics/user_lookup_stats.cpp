@@ -0,0 +1,23 @@
+#include "user_lookup_stats.hpp"
+
+#include <userver/utils/statistics/writer.hpp>
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TUserLookupStatistics& stats) {
+  writer["snapshot"]["hits"]["total"] = stats.snapshot_hits_total;
+  writer["snapshot_only"]["misses"]["total"] = stats.snapshot_only_misses_total;
+  writer["absent_cache"]["hits"]["total"] = stats.absent_cache_hits_total;
+  writer["db"]["queries"]["total"] = stats.db_queries_total;
+  writer["db"]["misses"]["total"] = stats.db_misses_total;
+}
+
+void ResetMetric(TUserLookupStatistics& stats) {
+  stats.snapshot_hits_total.Store({0});
+  stats.snapshot_only_misses_total.Store({0});
+  stats.absent_cache_hits_total.Store({0});
+  stats.db_queries_total.Store({0});
+  stats.db_misses_total.Store({0});
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+namespace NChat::NInfra {
+
+// Username lookups split by where the answer came from: cache snapshot, absent cache or Postgres
+struct TUserLookupStatistics {
+  userver::utils::statistics::RateCounter snapshot_hits_total{0};
+  userver::utils::statistics::RateCounter snapshot_only_misses_total{0};
+  userver::utils::statistics::RateCounter absent_cache_hits_total{0};
+  userver::utils::statistics::RateCounter db_queries_total{0};
+  userver::utils::statistics::RateCounter db_misses_total{0};
+};
+
+inline const userver::utils::statistics::MetricTag<TUserLookupStatistics> kUserLookupTag{"chat_user_lookup"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TUserLookupStatistics& stats);
+void ResetMetric(TUserLookupStatistics& stats);
+
+}  // namespace NChat::NInfra
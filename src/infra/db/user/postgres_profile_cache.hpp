@@ -0,0 +1,30 @@
+#pragma once
+
+#include <infra/db/user/profile_store.hpp>
+
+#include <userver/cache/base_postgres_cache.hpp>
+
+namespace NChat::NInfra {
+
+/*
+One cache for both lookups: by user_id and by username share a single snapshot.
+Deletion is a soft delete that bumps updated_at, so incremental updates see it as a tombstone row.
+*/
+struct TProfileCachePolicy {
+  static constexpr std::string_view kName = "profile-pg-cache";
+
+  using ValueType = TProfileRow;
+  using CacheContainer = TProfileStore;
+
+  static constexpr auto kKeyMember = &TProfileRow::UserId;
+
+  // No trailing semicolon: incremental update appends a condition on updated_at
+  static constexpr const char* kQuery = "SELECT user_id, username, display_name, updated_at, is_deleted FROM chat.users";
+
+  static constexpr const char* kUpdatedField = "updated_at";
+  using UpdatedFieldType = userver::storages::postgres::TimePointTz;
+};
+
+using TProfileCache = userver::components::PostgreCache<TProfileCachePolicy>;
+
+}  // namespace NChat::NInfra
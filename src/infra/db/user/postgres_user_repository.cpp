@@ -5,20 +5,24 @@
 #include <NChat/sql_queries.hpp>
 #include <userver/utils/encoding/hex.hpp>
 
+#include <algorithm>
+
 namespace NChat::NInfra::NRepository {
 
 namespace {
+// Partial unique index over usernames of live users, see chat_db.sql
+constexpr std::string_view kUsernameConstraint = "idx_users_username_alive";
+
 using NCore::NDomain::TUser;
 using NCore::NDomain::TUserId;
 using NCore::NDomain::TUserTinyProfile;
 }  // namespace
 
 TPostgresUserRepository::TPostgresUserRepository(userver::storages::postgres::ClusterPtr pg_cluster,
-                                                 const TProfileByUsernameCache& profile_by_username_cache,
-                                                 const TProfileByUserIdCache& profile_by_user_id_cache)
-    : PgCluster_(pg_cluster),
-      ProfileByUsernameCache_(profile_by_username_cache),
-      ProfileByUserIdCache_(profile_by_user_id_cache) {
+                                                 const TProfileCache& profile_cache,
+                                                 TUserLookupStatistics& lookup_stats,
+                                                 TAbsentUsernameCache* absent_cache)
+    : PgCluster_(pg_cluster), ProfileCache_(profile_cache), LookupStats_(lookup_stats), AbsentCache_(absent_cache) {
 }
 
 void TPostgresUserRepository::InsertNewUser(const TUser& user) const {
@@ -33,8 +37,16 @@ void TPostgresUserRepository::InsertNewUser(const TUser& user) const {
 
   } catch (const userver::storages::postgres::UniqueViolation& ex) {
     const auto& msg = ex.GetServerMessage();
+    // Registration checks only the cache snapshot, so a fresh duplicate username is caught here
+    if (msg.GetConstraint() == kUsernameConstraint) {
+      throw NCore::NDomain::TUserAlreadyExistsException(fmt::format("Username {} already exists", user.GetUsername()));
+    }
     throw NApp::TUserIdAlreadyExists(fmt::format("Constraint: {}; Detail: {}", msg.GetConstraint(), msg.GetDetail()));
   }
+
+  if (AbsentCache_) {
+    AbsentCache_->Erase(user.GetUsername());
+  }
 }
 
 void TPostgresUserRepository::DeleteUser(std::string_view username) const {
@@ -68,6 +80,10 @@ std::string TPostgresUserRepository::UpdateUser(const TUsername& username_to_upd
       return "";
     }
 
+    if (AbsentCache_ && username_str.has_value()) {
+      AbsentCache_->Erase(*username_str);
+    }
+
     return result.AsSingleRow<std::string>(userver::storages::postgres::kFieldTag);
   } catch (const userver::storages::postgres::UniqueViolation& ex) {
     throw NCore::NDomain::TUserAlreadyExistsException("Such user already exists");
@@ -75,29 +91,46 @@ std::string TPostgresUserRepository::UpdateUser(const TUsername& username_to_upd
 }
 
 std::optional<TUserId> TPostgresUserRepository::FindByUsername(std::string_view username) const {
-  const auto snapshot = ProfileByUsernameCache_.Get();
+  if (const auto profile = PinByUsername(ProfileCache_.Get(), username)) {
+    ++LookupStats_.snapshot_hits_total;
+    return TUserId{profile->UserId};
+  }
 
-  auto it = snapshot->find(username.data());
-  if (it != snapshot->end()) {
-    return TUserId{it->second.UserId};
+  if (AbsentCache_ && AbsentCache_->Contains(username)) {
+    ++LookupStats_.absent_cache_hits_total;
+    return std::nullopt;
   }
 
+  ++LookupStats_.db_queries_total;
   auto result = PgCluster_->Execute(userver::storages::postgres::ClusterHostType::kSlave, sql::kFindUserByUsername,
                                     username);
   if (result.IsEmpty()) {
+    ++LookupStats_.db_misses_total;
+    if (AbsentCache_) {
+      AbsentCache_->Put(username);
+    }
     return std::nullopt;
   }
 
   return TUserId{result.AsSingleRow<std::string>()};
 }
 
-std::optional<TUserTinyProfile> TPostgresUserRepository::GetProfileById(const TUserId& id) const {
-  const auto snapshot = ProfileByUserIdCache_.Get();
+std::optional<TUserId> TPostgresUserRepository::FindCachedByUsername(std::string_view username) const {
+  if (const auto profile = PinByUsername(ProfileCache_.Get(), username)) {
+    ++LookupStats_.snapshot_hits_total;
+    return TUserId{profile->UserId};
+  }
+
+  ++LookupStats_.snapshot_only_misses_total;
+  return std::nullopt;
+}
 
-  auto it = snapshot->find(id.GetUnderlying());
-  if (it != snapshot->end()) {
-    const auto [_, username, display_name, timepoint] = it->second;
-    return {{.Id = id, .Username = username, .DisplayName = display_name}};
+std::optional<TUserTinyProfile> TPostgresUserRepository::GetProfileById(const TUserId& id) const {
+  if (const auto profile = PinById(ProfileCache_.Get(), id.GetUnderlying())) {
+    return {{.Id = id,
+             .Username = profile->Username,
+             .DisplayName = profile->DisplayName,
+             .UpdatedAt = profile->Timepoint}};
   }
 
   auto result = PgCluster_->Execute(userver::storages::postgres::ClusterHostType::kSlave, sql::kGetProfileById,
@@ -111,7 +144,63 @@ std::optional<TUserTinyProfile> TPostgresUserRepository::GetProfileById(const TU
 
   return {{.Id = id,
            .Username = profile["username"].As<std::string>(),
-           .DisplayName = profile["display_name"].As<std::string>()}};
+           .DisplayName = profile["display_name"].As<std::string>(),
+           .UpdatedAt = profile["updated_at"].As<std::chrono::system_clock::time_point>()}};
+}
+
+std::unordered_map<TUserId, TUserTinyProfile> TPostgresUserRepository::GetProfilesByIds(
+    const std::vector<TUserId>& ids) const {
+  std::unordered_map<TUserId, TUserTinyProfile> profiles;
+  std::vector<std::string> misses;
+
+  const auto snapshot = ProfileCache_.Get();
+  for (const auto& id : ids) {
+    if (profiles.contains(id)) {
+      continue;
+    }
+
+    if (const auto profile = PinById(snapshot, id.GetUnderlying())) {
+      profiles.emplace(id, TUserTinyProfile{.Id = id,
+                                            .Username = profile->Username,
+                                            .DisplayName = profile->DisplayName,
+                                            .UpdatedAt = profile->Timepoint});
+    } else {
+      misses.push_back(id.GetUnderlying());
+    }
+  }
+
+  if (misses.empty()) {
+    return profiles;
+  }
+
+  // Профили, которых еще нет в снимке, добираются одним запросом
+  std::sort(misses.begin(), misses.end());
+  misses.erase(std::unique(misses.begin(), misses.end()), misses.end());
+
+  auto result = PgCluster_->Execute(userver::storages::postgres::ClusterHostType::kSlave, sql::kGetProfilesByIds,
+                                    misses);
+
+  for (const auto& row : result) {
+    TUserId id{row["user_id"].As<std::string>()};
+    profiles.emplace(id, TUserTinyProfile{.Id = id,
+                                          .Username = row["username"].As<std::string>(),
+                                          .DisplayName = row["display_name"].As<std::string>(),
+                                          .UpdatedAt = row["updated_at"].As<std::chrono::system_clock::time_point>()});
+  }
+
+  return profiles;
+}
+
+NCore::IUserRepository::TCachedProfile TPostgresUserRepository::GetCachedProfileById(const TUserId& id) const {
+  auto snapshot = ProfileCache_.Get();
+
+  TCachedProfile result{.Watermark = snapshot->GetWatermark()};
+  if (const auto profile = PinById(std::move(snapshot), id.GetUnderlying())) {
+    result.Profile = {
+        .Id = id, .Username = profile->Username, .DisplayName = profile->DisplayName, .UpdatedAt = profile->Timepoint};
+  }
+
+  return result;
 }
 
 std::unique_ptr<TUser> TPostgresUserRepository::GetUserByUsername(std::string_view username) const {
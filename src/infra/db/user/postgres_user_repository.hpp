@@ -2,8 +2,9 @@
 
 #include <core/users/user_repo.hpp>
 
-#include <infra/db/user/postgres_profile_by_user_id_cache.hpp>
-#include <infra/db/user/postgres_profile_by_username_cache.hpp>
+#include <infra/db/user/absent_cache/absent_username_cache.hpp>
+#include <infra/db/user/metrics/user_lookup_stats.hpp>
+#include <infra/db/user/postgres_profile_cache.hpp>
 
 #include <userver/components/loggable_component_base.hpp>
 #include <userver/storages/postgres/cluster.hpp>
@@ -15,9 +16,8 @@ namespace NChat::NInfra::NRepository {
 
 class TPostgresUserRepository : public NCore::IUserRepository {
  public:
-  TPostgresUserRepository(userver::storages::postgres::ClusterPtr pg_cluster,
-                          const TProfileByUsernameCache& profile_by_username_cache,
-                          const TProfileByUserIdCache& profile_by_user_id_cache);
+  TPostgresUserRepository(userver::storages::postgres::ClusterPtr pg_cluster, const TProfileCache& profile_cache,
+                          TUserLookupStatistics& lookup_stats, TAbsentUsernameCache* absent_cache = nullptr);
 
   void InsertNewUser(const TUser& user) const override;
   void DeleteUser(std::string_view username) const override;
@@ -25,14 +25,18 @@ class TPostgresUserRepository : public NCore::IUserRepository {
                          const NCore::IUserRepository::TUserUpdateParams& params) const override;
 
   std::optional<TUserId> FindByUsername(std::string_view username) const override;
+  std::optional<TUserId> FindCachedByUsername(std::string_view username) const override;
   std::unique_ptr<TUser> GetUserByUsername(std::string_view username) const override;
 
   std::optional<TUserTinyProfile> GetProfileById(const TUserId& id) const override;
+  std::unordered_map<TUserId, TUserTinyProfile> GetProfilesByIds(const std::vector<TUserId>& ids) const override;
+  TCachedProfile GetCachedProfileById(const TUserId& id) const override;
 
  private:
   userver::storages::postgres::ClusterPtr PgCluster_;
-  const TProfileByUsernameCache& ProfileByUsernameCache_;
-  const TProfileByUserIdCache& ProfileByUserIdCache_;
+  const TProfileCache& ProfileCache_;
+  TUserLookupStatistics& LookupStats_;
+  TAbsentUsernameCache* AbsentCache_;
 };
 
 }  // namespace NChat::NInfra::NRepository
@@ -0,0 +1,171 @@
+#include "profile_store.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace NChat::NInfra {
+
+namespace {
+
+// unordered_map node: value, cached hash and next pointer
+constexpr std::size_t kIndexNodeBytes = sizeof(std::pair<const std::string_view, std::uint32_t>) + 2 * sizeof(void*);
+
+std::size_t GetHeapSize(const std::string& str) {
+  static const std::size_t kSsoCapacity = std::string{}.capacity();
+  return str.capacity() > kSsoCapacity ? str.capacity() + 1 : 0;
+}
+
+}  // namespace
+
+TProfileStore::TProfileStore(const TProfileStore& other)
+    : Profiles_(other.Profiles_),
+      FreeSlots_(other.FreeSlots_),
+      Watermark_(other.Watermark_),
+      ProfilesBytes_(other.ProfilesBytes_) {
+  RebuildIndexes();
+}
+
+TProfileStore& TProfileStore::operator=(const TProfileStore& other) {
+  if (this != &other) {
+    Profiles_ = other.Profiles_;
+    FreeSlots_ = other.FreeSlots_;
+    Watermark_ = other.Watermark_;
+    ProfilesBytes_ = other.ProfilesBytes_;
+    RebuildIndexes();
+  }
+  return *this;
+}
+
+void TProfileStore::insert_or_assign(const std::string& user_id, TProfile profile) {
+  Watermark_ = std::max(Watermark_, profile.Timepoint);
+
+  auto it = ById_.find(user_id);
+  if (profile.IsDeleted) {
+    if (it != ById_.end()) {
+      Erase(it->second);
+    }
+    return;
+  }
+
+  if (it != ById_.end()) {
+    // Keys are views into the profile, so drop them before it is overwritten
+    const auto slot = it->second;
+    Unindex(slot);
+    ProfilesBytes_ -= GetFootprint(Profiles_[slot]);
+    // Swap instead of move-assign: assigning a short string would keep the old heap buffer
+    std::swap(Profiles_[slot], profile);
+    ProfilesBytes_ += GetFootprint(Profiles_[slot]);
+    Index(slot);
+    return;
+  }
+
+  std::uint32_t slot = 0;
+  if (!FreeSlots_.empty()) {
+    slot = FreeSlots_.back();
+    FreeSlots_.pop_back();
+    std::swap(Profiles_[slot], profile);
+  } else {
+    if (Profiles_.size() >= std::numeric_limits<std::uint32_t>::max()) {
+      throw std::length_error("Profile store is full");
+    }
+    slot = static_cast<std::uint32_t>(Profiles_.size());
+    Profiles_.push_back(std::move(profile));
+  }
+
+  ProfilesBytes_ += GetFootprint(Profiles_[slot]);
+  Index(slot);
+}
+
+std::size_t TProfileStore::size() const {
+  return ById_.size();
+}
+
+const TProfileStore::TProfile* TProfileStore::FindById(std::string_view user_id) const {
+  auto it = ById_.find(user_id);
+  return it != ById_.end() ? &Profiles_[it->second] : nullptr;
+}
+
+const TProfileStore::TProfile* TProfileStore::FindByUsername(std::string_view username) const {
+  auto it = ByUsername_.find(username);
+  return it != ByUsername_.end() ? &Profiles_[it->second] : nullptr;
+}
+
+TProfileStore::TTimePoint TProfileStore::GetWatermark() const {
+  return Watermark_;
+}
+
+std::size_t TProfileStore::GetMemoryUsage() const {
+  const auto buckets_bytes = (ById_.bucket_count() + ByUsername_.bucket_count()) * sizeof(void*);
+  const auto free_slots_bytes = FreeSlots_.size() * sizeof(TProfile) + FreeSlots_.capacity() * sizeof(std::uint32_t);
+  return ProfilesBytes_ + buckets_bytes + free_slots_bytes;
+}
+
+void TProfileStore::Erase(std::uint32_t slot) {
+  Unindex(slot);
+  ProfilesBytes_ -= GetFootprint(Profiles_[slot]);
+  // Free slot is marked as tombstone, so index rebuild skips it; swap releases the strings
+  TProfile tombstone{.IsDeleted = true};
+  std::swap(Profiles_[slot], tombstone);
+  FreeSlots_.push_back(slot);
+}
+
+void TProfileStore::Index(std::uint32_t slot) {
+  const auto& profile = Profiles_[slot];
+  IndexKey(ById_, profile.UserId, slot);
+  // Usernames are unique in the table, but within one update batch a name may move between users
+  IndexKey(ByUsername_, profile.Username, slot);
+}
+
+void TProfileStore::IndexKey(TIndex& index, std::string_view key, std::uint32_t slot) {
+  auto [it, inserted] = index.try_emplace(key, slot);
+  if (!inserted) {
+    // The old key views into the previous owner's profile, it must be replaced along with the slot
+    auto node = index.extract(it);
+    node.key() = key;
+    node.mapped() = slot;
+    index.insert(std::move(node));
+  }
+}
+
+void TProfileStore::Unindex(std::uint32_t slot) {
+  const auto& profile = Profiles_[slot];
+  ById_.erase(profile.UserId);
+
+  auto it = ByUsername_.find(profile.Username);
+  if (it != ByUsername_.end() && it->second == slot) {
+    ByUsername_.erase(it);
+  }
+}
+
+void TProfileStore::RebuildIndexes() {
+  ById_.clear();
+  ByUsername_.clear();
+  ById_.reserve(Profiles_.size());
+  ByUsername_.reserve(Profiles_.size());
+
+  for (std::uint32_t slot = 0; slot < Profiles_.size(); ++slot) {
+    if (!Profiles_[slot].IsDeleted) {
+      Index(slot);
+    }
+  }
+}
+
+TPinnedProfile PinById(std::shared_ptr<const TProfileStore> snapshot, std::string_view user_id) {
+  const auto* profile = snapshot->FindById(user_id);
+  // Aliasing constructor: the pointer is the profile, the ownership is the snapshot
+  return profile ? TPinnedProfile{std::move(snapshot), profile} : nullptr;
+}
+
+TPinnedProfile PinByUsername(std::shared_ptr<const TProfileStore> snapshot, std::string_view username) {
+  const auto* profile = snapshot->FindByUsername(username);
+  return profile ? TPinnedProfile{std::move(snapshot), profile} : nullptr;
+}
+
+std::size_t TProfileStore::GetFootprint(const TProfile& profile) {
+  return sizeof(TProfile) + GetHeapSize(profile.UserId) + GetHeapSize(profile.Username) +
+         GetHeapSize(profile.DisplayName) + 2 * kIndexNodeBytes;
+}
+
+}  // namespace NChat::NInfra
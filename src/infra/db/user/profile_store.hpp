@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NChat::NInfra {
+
+// Row of chat.users as seen by the cache, soft-deleted rows are tombstones
+struct TProfileRow {
+  std::string UserId;
+  std::string Username;
+  std::string DisplayName;
+  std::chrono::system_clock::time_point Timepoint{};
+  bool IsDeleted = false;
+};
+
+/*
+Single copy of every cached profile plus two indexes over it: by user_id and by username.
+Profiles live in a deque, so index keys may be string_views into them: a deque never relocates elements on growth.
+Copying rebuilds indexes to point into the copy (the cache copies the container on every incremental update).
+A tombstone row removes the profile, its slot is reused by the next insert.
+
+Also remembers the newest updated_at it has seen: any profile updated before the watermark is already here.
+*/
+class TProfileStore final {
+ public:
+  using TProfile = TProfileRow;
+  using TTimePoint = std::chrono::system_clock::time_point;
+
+  // PostgreCache container requirements
+  using key_type = std::string;
+  using mapped_type = TProfile;
+
+  TProfileStore() = default;
+  TProfileStore(const TProfileStore& other);
+  TProfileStore& operator=(const TProfileStore& other);
+  TProfileStore(TProfileStore&& other) noexcept = default;
+  TProfileStore& operator=(TProfileStore&& other) noexcept = default;
+
+  void insert_or_assign(const std::string& user_id, TProfile profile);
+  std::size_t size() const;
+
+  const TProfile* FindById(std::string_view user_id) const;
+  const TProfile* FindByUsername(std::string_view username) const;
+
+  TTimePoint GetWatermark() const;
+
+  // Approximate heap + inline footprint of profiles and both indexes
+  std::size_t GetMemoryUsage() const;
+
+ private:
+  using TIndex = std::unordered_map<std::string_view, std::uint32_t>;
+
+  void Erase(std::uint32_t slot);
+  void Index(std::uint32_t slot);
+  void Unindex(std::uint32_t slot);
+  void RebuildIndexes();
+
+  static void IndexKey(TIndex& index, std::string_view key, std::uint32_t slot);
+  static std::size_t GetFootprint(const TProfile& profile);
+
+ private:
+  std::deque<TProfile> Profiles_;
+  TIndex ById_;
+  TIndex ByUsername_;
+  std::vector<std::uint32_t> FreeSlots_;
+  TTimePoint Watermark_{};
+  std::size_t ProfilesBytes_ = 0;
+};
+
+// Profile sharing ownership of its cache snapshot: stays valid after the cache is updated, nothing is copied
+using TPinnedProfile = std::shared_ptr<const TProfileRow>;
+
+// Lookups by string_view, no allocations: both indexes are keyed by views into the store
+TPinnedProfile PinById(std::shared_ptr<const TProfileStore> snapshot, std::string_view user_id);
+TPinnedProfile PinByUsername(std::shared_ptr<const TProfileStore> snapshot, std::string_view username);
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,103 @@
+#include "profile_store.hpp"
+
+#include <userver/utest/utest.hpp>
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+using namespace NChat::NInfra;
+
+// Replaces global operator new: built into its own executable (see CMakeLists.txt), not the shared unittest binary
+namespace {
+// Heap allocations made by the current thread while counting is on
+thread_local bool IsCountingAllocations = false;
+thread_local std::size_t AllocationsCount = 0;
+
+class TAllocationCounter final {
+ public:
+  TAllocationCounter() {
+    AllocationsCount = 0;
+    IsCountingAllocations = true;
+  }
+  ~TAllocationCounter() {
+    IsCountingAllocations = false;
+  }
+
+  std::size_t Get() const {
+    return AllocationsCount;
+  }
+};
+}  // namespace
+
+void* operator new(std::size_t size) {
+  if (IsCountingAllocations) {
+    ++AllocationsCount;
+  }
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+TProfileRow MakeProfile(std::string id, std::string username, int updated_sec) {
+  return {.UserId = std::move(id),
+          .Username = std::move(username),
+          .DisplayName = "Display Name",
+          .Timepoint = std::chrono::system_clock::time_point{std::chrono::seconds{updated_sec}}};
+}
+
+void Insert(TProfileStore& store, TProfileRow profile) {
+  const auto id = profile.UserId;
+  store.insert_or_assign(id, std::move(profile));
+}
+}  // namespace
+
+TEST(ProfileStore, LookupsDoNotAllocate) {
+  auto store = std::make_shared<TProfileStore>();
+  for (int i = 0; i < 100; ++i) {
+    Insert(*store, MakeProfile("id-" + std::to_string(i), "user_with_a_long_name_" + std::to_string(i), i));
+  }
+  std::shared_ptr<const TProfileStore> snapshot = store;
+
+  // Views into a larger buffer: neither is null-terminated
+  const std::string buffer = "id-42user_with_a_long_name_7tail";
+  const std::string_view user_id{buffer.data(), 5};
+  const std::string_view username{buffer.data() + 5, 23};
+
+  TAllocationCounter counter;
+  const auto* by_id = snapshot->FindById(user_id);
+  const auto* by_username = snapshot->FindByUsername(username);
+  const auto pinned = PinByUsername(snapshot, username);
+  const auto missing = PinById(snapshot, "id-1000");
+  const auto allocations = counter.Get();
+
+  EXPECT_EQ(allocations, 0);
+  ASSERT_NE(by_id, nullptr);
+  EXPECT_EQ(by_id->Username, "user_with_a_long_name_42");
+  ASSERT_NE(by_username, nullptr);
+  EXPECT_EQ(by_username->UserId, "id-7");
+  EXPECT_EQ(pinned.get(), by_username);
+  EXPECT_EQ(missing, nullptr);
+}
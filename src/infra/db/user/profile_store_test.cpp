@@ -0,0 +1,170 @@
+#include "profile_store.hpp"
+
+#include <userver/utest/utest.hpp>
+
+using namespace NChat::NInfra;
+
+namespace {
+TProfileRow MakeProfile(std::string id, std::string username, int updated_sec) {
+  return {.UserId = std::move(id),
+          .Username = std::move(username),
+          .DisplayName = "Display Name",
+          .Timepoint = std::chrono::system_clock::time_point{std::chrono::seconds{updated_sec}}};
+}
+
+TProfileRow MakeTombstone(std::string id, std::string username, int updated_sec) {
+  auto row = MakeProfile(std::move(id), std::move(username), updated_sec);
+  row.IsDeleted = true;
+  return row;
+}
+
+void Insert(TProfileStore& store, TProfileRow profile) {
+  const auto id = profile.UserId;
+  store.insert_or_assign(id, std::move(profile));
+}
+}  // namespace
+
+TEST(ProfileStore, FindByBothIndexes) {
+  TProfileStore store;
+  Insert(store, MakeProfile("id-1", "alice", 1));
+  Insert(store, MakeProfile("id-2", "bob", 2));
+
+  ASSERT_NE(store.FindById("id-1"), nullptr);
+  EXPECT_EQ(store.FindById("id-1")->Username, "alice");
+  ASSERT_NE(store.FindByUsername("bob"), nullptr);
+  EXPECT_EQ(store.FindByUsername("bob")->UserId, "id-2");
+  EXPECT_EQ(store.FindById("id-3"), nullptr);
+  EXPECT_EQ(store.FindByUsername("carol"), nullptr);
+  EXPECT_EQ(store.size(), 2);
+}
+
+TEST(ProfileStore, RenameMovesUsernameIndex) {
+  TProfileStore store;
+  Insert(store, MakeProfile("id-1", "alice", 1));
+  Insert(store, MakeProfile("id-1", "alice_renamed_to_a_long_name_without_sso", 2));
+
+  EXPECT_EQ(store.size(), 1);
+  EXPECT_EQ(store.FindByUsername("alice"), nullptr);
+  ASSERT_NE(store.FindByUsername("alice_renamed_to_a_long_name_without_sso"), nullptr);
+  EXPECT_EQ(store.FindById("id-1")->Username, "alice_renamed_to_a_long_name_without_sso");
+}
+
+TEST(ProfileStore, UsernameMovesBetweenUsersInOneBatch) {
+  TProfileStore store;
+  Insert(store, MakeProfile("id-1", "alice", 1));
+  Insert(store, MakeProfile("id-2", "bob", 1));
+
+  // bob takes "alice" before alice's rename is applied
+  Insert(store, MakeProfile("id-2", "alice", 2));
+  Insert(store, MakeProfile("id-1", "carol", 2));
+
+  ASSERT_NE(store.FindByUsername("alice"), nullptr);
+  EXPECT_EQ(store.FindByUsername("alice")->UserId, "id-2");
+  EXPECT_EQ(store.FindByUsername("carol")->UserId, "id-1");
+  EXPECT_EQ(store.FindByUsername("bob"), nullptr);
+}
+
+TEST(ProfileStore, CopyHasOwnIndexes) {
+  auto original = std::make_unique<TProfileStore>();
+  for (int i = 0; i < 100; ++i) {
+    Insert(*original, MakeProfile("id-" + std::to_string(i), "user_" + std::to_string(i), i));
+  }
+
+  TProfileStore copy{*original};
+  Insert(*original, MakeProfile("id-1", "renamed", 200));
+  original.reset();
+
+  EXPECT_EQ(copy.size(), 100);
+  ASSERT_NE(copy.FindByUsername("user_1"), nullptr);
+  EXPECT_EQ(copy.FindByUsername("user_1")->UserId, "id-1");
+  EXPECT_EQ(copy.FindByUsername("renamed"), nullptr);
+  EXPECT_EQ(copy.FindById("id-99")->Username, "user_99");
+}
+
+TEST(ProfileStore, WatermarkIsNewestUpdate) {
+  TProfileStore store;
+  Insert(store, MakeProfile("id-1", "alice", 10));
+  Insert(store, MakeProfile("id-2", "bob", 5));
+
+  EXPECT_EQ(store.GetWatermark(), std::chrono::system_clock::time_point{std::chrono::seconds{10}});
+}
+
+TEST(ProfileStore, MemoryUsageFollowsContent) {
+  TProfileStore store;
+  Insert(store, MakeProfile("id-1", "alice", 1));
+  const auto one_user = store.GetMemoryUsage();
+
+  EXPECT_GT(one_user, sizeof(TProfileRow));
+
+  Insert(store, MakeProfile("id-1", std::string(100, 'a'), 2));
+  EXPECT_GT(store.GetMemoryUsage(), one_user);
+
+  Insert(store, MakeProfile("id-1", "alice", 3));
+  EXPECT_EQ(store.GetMemoryUsage(), one_user);
+}
+
+TEST(ProfileStore, TombstoneRemovesProfile) {
+  TProfileStore store;
+  Insert(store, MakeProfile("id-1", "alice", 1));
+  Insert(store, MakeProfile("id-2", "bob", 2));
+  Insert(store, MakeTombstone("id-1", "alice", 3));
+
+  EXPECT_EQ(store.size(), 1);
+  EXPECT_EQ(store.FindById("id-1"), nullptr);
+  EXPECT_EQ(store.FindByUsername("alice"), nullptr);
+  EXPECT_EQ(store.FindByUsername("bob")->UserId, "id-2");
+  EXPECT_EQ(store.GetWatermark(), std::chrono::system_clock::time_point{std::chrono::seconds{3}});
+}
+
+TEST(ProfileStore, UnknownTombstoneIsIgnored) {
+  TProfileStore store;
+  Insert(store, MakeTombstone("id-1", "alice", 5));
+
+  EXPECT_EQ(store.size(), 0);
+  EXPECT_EQ(store.FindByUsername("alice"), nullptr);
+  EXPECT_EQ(store.GetWatermark(), std::chrono::system_clock::time_point{std::chrono::seconds{5}});
+}
+
+TEST(ProfileStore, DeletedUsernameIsReused) {
+  TProfileStore store;
+  Insert(store, MakeProfile("id-1", "alice", 1));
+  Insert(store, MakeTombstone("id-1", "alice", 2));
+  Insert(store, MakeProfile("id-2", "alice", 3));
+
+  EXPECT_EQ(store.size(), 1);
+  EXPECT_EQ(store.FindById("id-1"), nullptr);
+  ASSERT_NE(store.FindByUsername("alice"), nullptr);
+  EXPECT_EQ(store.FindByUsername("alice")->UserId, "id-2");
+}
+
+TEST(ProfileStore, CopySkipsFreedSlots) {
+  TProfileStore store;
+  for (int i = 0; i < 10; ++i) {
+    Insert(store, MakeProfile("id-" + std::to_string(i), "user_" + std::to_string(i), i));
+  }
+  for (int i = 0; i < 10; i += 2) {
+    Insert(store, MakeTombstone("id-" + std::to_string(i), "user_" + std::to_string(i), 10 + i));
+  }
+
+  TProfileStore copy{store};
+  EXPECT_EQ(copy.size(), 5);
+  EXPECT_EQ(copy.FindById("id-0"), nullptr);
+  EXPECT_EQ(copy.FindByUsername("user_1")->UserId, "id-1");
+
+  // Freed slots are reused, both by the store and by its copy
+  Insert(copy, MakeProfile("id-10", "user_10", 30));
+  EXPECT_EQ(copy.size(), 6);
+  EXPECT_EQ(copy.FindByUsername("user_10")->UserId, "id-10");
+}
+
+TEST(ProfileStore, PinnedProfileOutlivesSnapshot) {
+  auto store = std::make_shared<TProfileStore>();
+  Insert(*store, MakeProfile("id-1", "alice", 1));
+
+  const auto pinned = PinById(std::move(store), "id-1");
+  EXPECT_EQ(store, nullptr);
+
+  ASSERT_NE(pinned, nullptr);
+  EXPECT_EQ(pinned->Username, "alice");
+  EXPECT_EQ(pinned.use_count(), 1);
+}
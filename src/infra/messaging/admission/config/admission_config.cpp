@@ -0,0 +1,11 @@
+#include "admission_config.hpp"
+
+namespace NChat::NInfra {
+
+TAdmissionConfig Parse(const userver::formats::json::Value& value, userver::formats::parse::To<TAdmissionConfig>) {
+  return TAdmissionConfig{value["is_enabled"].As<bool>(),
+                          std::chrono::milliseconds{value["max_task_lag_ms"].As<int>()},
+                          value["memory_share"].As<double>()};
+}
+
+}  // namespace NChat::NInfra
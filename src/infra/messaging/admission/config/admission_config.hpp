@@ -0,0 +1,30 @@
+#pragma once
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/dynamic_config/value.hpp>
+
+#include <chrono>
+
+namespace NChat::NInfra {
+
+struct TAdmissionConfig {
+  bool IsEnabled{false};
+  // Сглаженная задержка постановки задачи в очередь task processor'а, с которой узел считается перегруженным
+  std::chrono::milliseconds MaxTaskLag{50};
+  // Доля бюджета памяти очередей (QUEUE_CONFIG.max_total_memory_mb), с которой узел считается перегруженным
+  double MemoryShare{0.8};
+};
+
+TAdmissionConfig Parse(const userver::formats::json::Value& value, userver::formats::parse::To<TAdmissionConfig>);
+
+const userver::dynamic_config::Key<TAdmissionConfig> kAdmissionConfig{"ADMISSION_CONFIG",
+                                                                      userver::dynamic_config::DefaultAsJsonString{R"(
+  {
+    "is_enabled": true,
+    "max_task_lag_ms": 50,
+    "memory_share": 0.8
+  }
+)"}};
+
+}  // namespace NChat::NInfra
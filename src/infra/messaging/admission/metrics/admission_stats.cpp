@@ -0,0 +1,14 @@
+#include "admission_stats.hpp"
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TAdmissionStatistics& stats) {
+  writer["task_lag"]["us"] = stats.task_lag_us;
+  writer["overloaded"]["current"] = stats.overloaded;
+  writer["overload_events"]["total"] = stats.overload_events_total;
+}
+
+void ResetMetric(TAdmissionStatistics& stats) {
+  stats.overload_events_total.Store({0});
+}
+}  // namespace NChat::NInfra
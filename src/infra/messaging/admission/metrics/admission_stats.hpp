@@ -0,0 +1,22 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace NChat::NInfra {
+struct TAdmissionStatistics {
+  std::atomic<std::int64_t> task_lag_us{0};
+  std::atomic<int> overloaded{0};
+  userver::utils::statistics::RateCounter overload_events_total{0};
+};
+
+inline const userver::utils::statistics::MetricTag<TAdmissionStatistics> kAdmissionTag{"chat_admission"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TAdmissionStatistics& stats);
+void ResetMetric(TAdmissionStatistics& stats);
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,77 @@
+#include "task_lag_sensor.hpp"
+
+#include <utils/memory/memory_budget.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/async.hpp>
+
+#include <stdexcept>
+
+namespace NChat::NInfra {
+
+namespace {
+// Вес нового измерения: одиночная задержка (GC, всплеск запросов) не закрывает узел
+constexpr double kLagSmoothing = 0.2;
+}  // namespace
+
+TTaskLagSensor::TTaskLagSensor(userver::dynamic_config::Source config_source, std::chrono::milliseconds check_period,
+                               TAdmissionStatistics& stats)
+    : ConfigSource_(config_source), CheckPeriod_(check_period), Stats_(stats) {
+  if (CheckPeriod_ <= std::chrono::milliseconds::zero()) {
+    throw std::invalid_argument("Overload sensor check period must be positive");
+  }
+
+  Task_ = userver::utils::CriticalAsync("overload-sensor", [this] { Run(); });
+}
+
+TTaskLagSensor::~TTaskLagSensor() {
+  Task_.SyncCancel();
+}
+
+bool TTaskLagSensor::IsOverloaded() const {
+  return IsOverloaded_.load(std::memory_order_relaxed);
+}
+
+void TTaskLagSensor::Probe() {
+  const auto start = std::chrono::steady_clock::now();
+  // Задача встает в конец очереди task processor'а: время до возобновления - очередь к CPU
+  userver::engine::Yield();
+  Update(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+}
+
+void TTaskLagSensor::Run() {
+  while (!userver::engine::current_task::ShouldCancel()) {
+    Probe();
+    userver::engine::InterruptibleSleepFor(CheckPeriod_);
+  }
+}
+
+void TTaskLagSensor::Update(std::chrono::microseconds lag) {
+  const auto config = ConfigSource_.GetSnapshot()[kAdmissionConfig];
+
+  SmoothedLagUs_ = SmoothedLagUs_ * (1 - kLagSmoothing) + static_cast<double>(lag.count()) * kLagSmoothing;
+  Stats_.task_lag_us = static_cast<std::int64_t>(SmoothedLagUs_);
+
+  const auto max_lag_us = std::chrono::duration_cast<std::chrono::microseconds>(config.MaxTaskLag).count();
+  const bool lagging = SmoothedLagUs_ > static_cast<double>(max_lag_us);
+  const bool overloaded = config.IsEnabled && (lagging || NUtils::NMemory::IsOverBudget(config.MemoryShare));
+
+  if (overloaded == IsOverloaded_.exchange(overloaded, std::memory_order_relaxed)) {
+    return;
+  }
+
+  Stats_.overloaded = overloaded ? 1 : 0;
+
+  if (overloaded) {
+    Stats_.overload_events_total.Add({1});
+    LOG_WARNING() << fmt::format("Node overloaded: task lag {}us, queue memory {} of {} bytes; new users are refused",
+                                 static_cast<std::int64_t>(SmoothedLagUs_), NUtils::NMemory::GetChargedBytes(),
+                                 NUtils::NMemory::GetBudget());
+  } else {
+    LOG_INFO() << "Node overload is over, new users are admitted again";
+  }
+}
+
+}  // namespace NChat::NInfra
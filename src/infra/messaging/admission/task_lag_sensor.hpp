@@ -0,0 +1,48 @@
+#pragma once
+
+#include <core/messaging/admission/overload_sensor.hpp>
+
+#include <infra/messaging/admission/config/admission_config.hpp>
+#include <infra/messaging/admission/metrics/admission_stats.hpp>
+
+#include <userver/dynamic_config/source.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <atomic>
+#include <chrono>
+
+namespace NChat::NInfra {
+
+/*
+Node overload estimate for admission of new users.
+A background task yields every CheckPeriod and measures how long it waited in the task processor queue:
+the same queueing delay userver congestion control reacts to, and a direct sign of CPU saturation.
+The node is overloaded while the smoothed lag exceeds ADMISSION_CONFIG.max_task_lag_ms or queued payloads
+take more than ADMISSION_CONFIG.memory_share of the memory budget. Hot path reads a single atomic flag.
+*/
+class TTaskLagSensor final : public NCore::IOverloadSensor {
+ public:
+  TTaskLagSensor(userver::dynamic_config::Source config_source, std::chrono::milliseconds check_period,
+                 TAdmissionStatistics& stats);
+  ~TTaskLagSensor();
+
+  bool IsOverloaded() const override;
+
+ private:
+  void Run();
+  void Probe();
+  void Update(std::chrono::microseconds lag);
+
+ private:
+  userver::dynamic_config::Source ConfigSource_;
+  const std::chrono::milliseconds CheckPeriod_;
+  TAdmissionStatistics& Stats_;
+
+  // Пишет только фоновая задача
+  double SmoothedLagUs_{0};
+  std::atomic_bool IsOverloaded_{false};
+
+  userver::engine::TaskWithResult<void> Task_;
+};
+
+}  // namespace NChat::NInfra
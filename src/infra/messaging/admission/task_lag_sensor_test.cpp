@@ -0,0 +1,48 @@
+#include "task_lag_sensor.hpp"
+
+#include <utils/memory/memory_budget.hpp>
+
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+using namespace NChat::NInfra;
+
+namespace {
+constexpr std::chrono::milliseconds kCheckPeriod{1};
+
+bool WaitOverloaded(const TTaskLagSensor& sensor, bool expected) {
+  for (int i = 0; i < 1000 && sensor.IsOverloaded() != expected; ++i) {
+    userver::engine::SleepFor(kCheckPeriod);
+  }
+  return sensor.IsOverloaded() == expected;
+}
+}  // namespace
+
+UTEST(TaskLagSensor, IdleNodeIsNotOverloaded) {
+  TAdmissionStatistics stats;
+  TTaskLagSensor sensor(userver::dynamic_config::GetDefaultSource(), kCheckPeriod, stats);
+
+  userver::engine::SleepFor(kCheckPeriod * 20);
+  EXPECT_FALSE(sensor.IsOverloaded());
+  EXPECT_EQ(stats.overloaded.load(), 0);
+}
+
+UTEST(TaskLagSensor, QueueMemoryOverShareMeansOverload) {
+  TAdmissionStatistics stats;
+  TTaskLagSensor sensor(userver::dynamic_config::GetDefaultSource(), kCheckPeriod, stats);
+
+  userver::utils::ScopeGuard restore_budget([budget = NUtils::NMemory::GetBudget()] {
+    NUtils::NMemory::SetBudget(budget);
+  });
+  NUtils::NMemory::SetBudget(NUtils::NMemory::GetChargedBytes() + 1000);
+  {
+    NUtils::NMemory::Charge(900);
+    userver::utils::ScopeGuard release([] { NUtils::NMemory::Release(900); });
+    EXPECT_TRUE(WaitOverloaded(sensor, true));
+    EXPECT_EQ(stats.overloaded.load(), 1);
+  }
+
+  EXPECT_TRUE(WaitOverloaded(sensor, false));
+}
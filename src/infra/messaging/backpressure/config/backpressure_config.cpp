@@ -0,0 +1,12 @@
+#include "backpressure_config.hpp"
+
+namespace NChat::NInfra {
+
+TBackpressureConfig Parse(const userver::formats::json::Value& value,
+                          userver::formats::parse::To<TBackpressureConfig>) {
+  return TBackpressureConfig{value["is_enabled"].As<bool>(), value["saturated_share"].As<double>(),
+                             std::chrono::milliseconds{value["retry_after_ms"].As<int>()},
+                             std::chrono::milliseconds{value["max_slowdown_ms"].As<int>()}};
+}
+
+}  // namespace NChat::NInfra
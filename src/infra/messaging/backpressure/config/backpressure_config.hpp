@@ -0,0 +1,33 @@
+#pragma once
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/dynamic_config/value.hpp>
+
+#include <chrono>
+
+namespace NChat::NInfra {
+
+struct TBackpressureConfig {
+  bool IsEnabled{false};
+  // Доля насыщенных очередей локальных получателей, с которой чат перестает принимать сообщения
+  double SaturatedShare{0.5};
+  std::chrono::milliseconds RetryAfter{1000};
+  // Задержка отправителя при доле насыщенных очередей ниже SaturatedShare, растет пропорционально доле; 0 - выключено
+  std::chrono::milliseconds MaxSlowdown{0};
+};
+
+TBackpressureConfig Parse(const userver::formats::json::Value& value,
+                          userver::formats::parse::To<TBackpressureConfig>);
+
+const userver::dynamic_config::Key<TBackpressureConfig> kBackpressureConfig{
+    "SEND_BACKPRESSURE_CONFIG", userver::dynamic_config::DefaultAsJsonString{R"(
+  {
+    "is_enabled": true,
+    "saturated_share": 0.5,
+    "retry_after_ms": 1000,
+    "max_slowdown_ms": 0
+  }
+)"}};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,16 @@
+#include "backpressure_stats.hpp"
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TBackpressureStatistics& stats) {
+  writer["saturated_reports"]["total"] = stats.saturated_reports_total;
+  writer["rejected"]["total"] = stats.rejected_total;
+  writer["slowed"]["total"] = stats.slowed_total;
+}
+
+void ResetMetric(TBackpressureStatistics& stats) {
+  stats.saturated_reports_total.Store({0});
+  stats.rejected_total.Store({0});
+  stats.slowed_total.Store({0});
+}
+}  // namespace NChat::NInfra
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+namespace NChat::NInfra {
+struct TBackpressureStatistics {
+  userver::utils::statistics::RateCounter saturated_reports_total{0};
+  userver::utils::statistics::RateCounter rejected_total{0};
+  userver::utils::statistics::RateCounter slowed_total{0};
+};
+
+inline const userver::utils::statistics::MetricTag<TBackpressureStatistics> kBackpressureTag{"chat_backpressure"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TBackpressureStatistics& stats);
+void ResetMetric(TBackpressureStatistics& stats);
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,123 @@
+#include "sharded_backpressure.hpp"
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/datetime.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+
+namespace NChat::NInfra {
+
+TShardedBackpressure::TShardedBackpressure(std::size_t shards_amount, std::size_t max_chats,
+                                           const TConfigCache& config_cache, TBackpressureStatistics& stats)
+    : ConfigCache_(config_cache), Stats_(stats) {
+  if (shards_amount == 0) {
+    throw std::invalid_argument("Backpressure needs at least one shard");
+  }
+
+  Shards_.reserve(shards_amount);
+  for (std::size_t i = 0; i < shards_amount; ++i) {
+    Shards_.push_back(std::make_unique<TShard>(std::max<std::size_t>(max_chats / shards_amount, 1)));
+  }
+}
+
+std::optional<std::chrono::milliseconds> TShardedBackpressure::Admit(const NCore::NDomain::TChatId& chat_id) {
+  if (!ConfigCache_.GetBackpressureConfig().IsEnabled) {
+    return std::nullopt;
+  }
+
+  const auto now = userver::utils::datetime::SteadyNow();
+  if (PressureUntil_.load(std::memory_order_acquire) <= now) {
+    return std::nullopt;
+  }
+
+  std::chrono::milliseconds delay{0};
+  {
+    auto& shard = GetShard(chat_id);
+    std::lock_guard lock(shard.Mutex);
+
+    const auto* pressure = shard.Chats.Get(chat_id.GetUnderlying());
+    if (!pressure) {
+      return std::nullopt;
+    }
+
+    if (pressure->RejectUntil > now) {
+      ++Stats_.rejected_total;
+      return std::chrono::ceil<std::chrono::milliseconds>(pressure->RejectUntil - now);
+    }
+
+    if (pressure->SlowUntil <= now) {
+      shard.Chats.Erase(chat_id.GetUnderlying());
+      return std::nullopt;
+    }
+
+    delay = pressure->Delay;
+  }
+
+  ++Stats_.slowed_total;
+  userver::engine::InterruptibleSleepFor(delay);
+
+  return std::nullopt;
+}
+
+void TShardedBackpressure::Report(const NCore::NDomain::TChatId& chat_id, const NCore::TSendStatus& status) {
+  const auto local = status.Successful + status.Dropped;
+  if (local == 0) {
+    return;  // получатели на других узлах или офлайн: об их очередях здесь ничего не известно
+  }
+
+  const auto config = ConfigCache_.GetBackpressureConfig();
+  if (!config.IsEnabled) {
+    return;
+  }
+
+  const auto now = userver::utils::datetime::SteadyNow();
+  const auto share = static_cast<double>(status.Saturated) / static_cast<double>(local);
+  const bool is_saturated = share >= config.SaturatedShare;
+  const bool is_slowed = !is_saturated && status.Saturated > 0 && config.MaxSlowdown.count() > 0;
+
+  if (!is_saturated && !is_slowed) {
+    if (PressureUntil_.load(std::memory_order_acquire) <= now) {
+      return;
+    }
+
+    auto& shard = GetShard(chat_id);
+    std::lock_guard lock(shard.Mutex);
+    shard.Chats.Erase(chat_id.GetUnderlying());
+    return;
+  }
+
+  const auto until = now + config.RetryAfter;
+  TChatPressure pressure;
+  if (is_saturated) {
+    ++Stats_.saturated_reports_total;
+    pressure.RejectUntil = until;
+  } else {
+    pressure.SlowUntil = until;
+    pressure.Delay = std::chrono::duration_cast<std::chrono::milliseconds>(config.MaxSlowdown * share /
+                                                                           config.SaturatedShare);
+  }
+
+  {
+    auto& shard = GetShard(chat_id);
+    std::lock_guard lock(shard.Mutex);
+    shard.Chats.Put(chat_id.GetUnderlying(), pressure);
+  }
+
+  ExtendPressure(until);
+}
+
+void TShardedBackpressure::ExtendPressure(TTimePoint until) {
+  auto current = PressureUntil_.load(std::memory_order_relaxed);
+  while (current < until &&
+         !PressureUntil_.compare_exchange_weak(current, until, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+}
+
+TShardedBackpressure::TShard& TShardedBackpressure::GetShard(const NCore::NDomain::TChatId& chat_id) {
+  return *Shards_[std::hash<std::string>{}(chat_id.GetUnderlying()) % Shards_.size()];
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <app/services/message/send_backpressure.hpp>
+
+#include <infra/config/config_cache.hpp>
+#include <infra/messaging/backpressure/metrics/backpressure_stats.hpp>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/engine/mutex.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace NChat::NInfra {
+
+/*
+Per-chat pressure built from routing results. A chat whose share of saturated recipient queues reaches
+SaturatedShare rejects new messages for RetryAfter; a smaller share slows senders down proportionally.
+A healthy routing result clears the chat. Only throttled chats are stored, least recently reported are evicted.
+*/
+class TShardedBackpressure final : public NApp::ISendBackpressure {
+ public:
+  TShardedBackpressure(std::size_t shards_amount, std::size_t max_chats, const TConfigCache& config_cache,
+                       TBackpressureStatistics& stats);
+
+  std::optional<std::chrono::milliseconds> Admit(const NCore::NDomain::TChatId& chat_id) override;
+  void Report(const NCore::NDomain::TChatId& chat_id, const NCore::TSendStatus& status) override;
+
+ private:
+  using TTimePoint = std::chrono::steady_clock::time_point;
+
+  struct TChatPressure {
+    TTimePoint RejectUntil{};
+    TTimePoint SlowUntil{};
+    std::chrono::milliseconds Delay{0};
+  };
+
+  struct TShard {
+    explicit TShard(std::size_t max_chats) : Chats(max_chats) {
+    }
+
+    userver::engine::Mutex Mutex;
+    userver::cache::LruMap<std::string, TChatPressure> Chats;
+  };
+
+  TShard& GetShard(const NCore::NDomain::TChatId& chat_id);
+  void ExtendPressure(TTimePoint until);
+
+ private:
+  std::vector<std::unique_ptr<TShard>> Shards_;
+  // Самый поздний срок среди всех чатов: пока он в прошлом, Admit и Report не трогают шарды
+  std::atomic<TTimePoint> PressureUntil_{};
+  const TConfigCache& ConfigCache_;
+  TBackpressureStatistics& Stats_;
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,61 @@
+#include "sharded_backpressure.hpp"
+
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+using namespace NChat::NInfra;
+using NChat::NCore::TSendStatus;
+using NChat::NCore::NDomain::TChatId;
+
+namespace {
+const auto kNow = userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000");
+}  // namespace
+
+class ShardedBackpressureTest : public ::testing::Test {
+ protected:
+  TConfigCache ConfigCache{userver::dynamic_config::GetDefaultSource()};
+  TBackpressureStatistics Stats;
+  TShardedBackpressure Backpressure{4, 128, ConfigCache, Stats};
+};
+
+UTEST_F(ShardedBackpressureTest, SaturatedChatIsRejected) {
+  userver::utils::datetime::MockNowSet(kNow);
+
+  Backpressure.Report(TChatId{"chat-1"}, TSendStatus{.Successful = 2, .Saturated = 1, .MaxFillRatio = 1.0});
+
+  auto retry_after = Backpressure.Admit(TChatId{"chat-1"});
+  ASSERT_TRUE(retry_after.has_value());
+  EXPECT_EQ(*retry_after, std::chrono::milliseconds(1000));
+
+  EXPECT_FALSE(Backpressure.Admit(TChatId{"chat-2"}).has_value());
+}
+
+UTEST_F(ShardedBackpressureTest, HealthyReportReleasesChat) {
+  userver::utils::datetime::MockNowSet(kNow);
+
+  Backpressure.Report(TChatId{"chat-1"}, TSendStatus{.Successful = 1, .Saturated = 1, .MaxFillRatio = 1.0});
+  ASSERT_TRUE(Backpressure.Admit(TChatId{"chat-1"}).has_value());
+
+  Backpressure.Report(TChatId{"chat-1"}, TSendStatus{.Successful = 3, .MaxFillRatio = 0.1});
+  EXPECT_FALSE(Backpressure.Admit(TChatId{"chat-1"}).has_value());
+}
+
+UTEST_F(ShardedBackpressureTest, RejectExpiresAfterRetryAfter) {
+  userver::utils::datetime::MockNowSet(kNow);
+
+  // Только удаленные получатели: локальные очереди неизвестны, давления нет
+  Backpressure.Report(TChatId{"chat-1"}, TSendStatus{.Forwarded = 2});
+  EXPECT_FALSE(Backpressure.Admit(TChatId{"chat-1"}).has_value());
+
+  Backpressure.Report(TChatId{"chat-1"}, TSendStatus{.Dropped = 1, .Saturated = 1, .MaxFillRatio = 1.0});
+
+  userver::utils::datetime::MockSleep(std::chrono::milliseconds(400));
+  auto retry_after = Backpressure.Admit(TChatId{"chat-1"});
+  ASSERT_TRUE(retry_after.has_value());
+  EXPECT_EQ(*retry_after, std::chrono::milliseconds(600));
+
+  userver::utils::datetime::MockSleep(std::chrono::milliseconds(601));
+  EXPECT_FALSE(Backpressure.Admit(TChatId{"chat-1"}).has_value());
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <core/messaging/bus/node_locator.hpp>
+
+namespace NChat::NInfra {
+
+// Без каталога присутствия пользователь может быть на любом узле: пересылаем всем пирам,
+// узел без почтового ящика получателя просто посчитает его офлайн
+class TBroadcastNodeLocator : public NCore::INodeLocator {
+ public:
+  explicit TBroadcastNodeLocator(std::vector<NCore::NDomain::TNodeId> peers) : Peers_(std::move(peers)) {
+  }
+
+  std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> Locate(
+      const std::vector<NCore::NDomain::TUserId>& users) const override {
+    std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> nodes;
+    if (Peers_.empty()) {
+      return nodes;
+    }
+
+    for (const auto& user : users) {
+      nodes.emplace(user, Peers_);
+    }
+    return nodes;
+  }
+
+ private:
+  const std::vector<NCore::NDomain::TNodeId> Peers_;
+};
+
+}  // namespace NChat::NInfra
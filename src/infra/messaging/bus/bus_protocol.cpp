@@ -0,0 +1,71 @@
+#include "bus_protocol.hpp"
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/utils/datetime.hpp>
+
+namespace NChat::NInfra {
+
+std::string SerializeForwardBatch(std::span<const NCore::TRouteTask> batch) {
+  userver::formats::json::ValueBuilder tasks(userver::formats::common::Type::kArray);
+
+  for (const auto& [recipients, message] : batch) {
+    userver::formats::json::ValueBuilder task;
+    task["chat_id"] = message.ChatId.GetUnderlying();
+    task["sender_id"] = message.Payload->Sender.GetUnderlying();
+    task["text"] = message.Payload->Text.Value();
+    task["seq"] = message.Seq;
+    if (message.Class == NCore::NDomain::EMessageClass::Service) {
+      task["service"] = true;
+    }
+
+    userver::formats::json::ValueBuilder task_recipients(userver::formats::common::Type::kArray);
+    for (const auto& recipient : recipients) {
+      task_recipients.PushBack(recipient.GetUnderlying());
+    }
+    task["recipients"] = std::move(task_recipients);
+
+    tasks.PushBack(std::move(task));
+  }
+
+  userver::formats::json::ValueBuilder builder;
+  builder["tasks"] = std::move(tasks);
+
+  return userver::formats::json::ToString(builder.ExtractValue());
+}
+
+std::vector<NCore::TRouteTask> ParseForwardBatch(const userver::formats::json::Value& json) {
+  using namespace NCore::NDomain;
+
+  const auto& tasks = json["tasks"];
+  std::vector<NCore::TRouteTask> batch;
+  batch.reserve(tasks.GetSize());
+
+  // Steady-часы другого узла здесь ничего не значат, отсчет доставки начинается с приема
+  const auto received_at = userver::utils::datetime::SteadyNow();
+
+  for (const auto& task : tasks) {
+    auto payload = std::make_shared<TMessagePayload>(TUserId{task["sender_id"].As<std::string>()},
+                                                     TMessageText{task["text"].As<std::string>()});
+
+    NCore::TRouteTask route_task{.Recipients{},
+                                 .Message = {.Payload = std::move(payload),
+                                             .ChatId = TChatId{task["chat_id"].As<std::string>()},
+                                             .Context = {.Get = received_at},
+                                             .Seq = task["seq"].As<TMessageSeq>(),
+                                             .Class = task["service"].As<bool>(false) ? EMessageClass::Service
+                                                                                      : EMessageClass::Regular}};
+
+    const auto& recipients = task["recipients"];
+    route_task.Recipients.reserve(recipients.GetSize());
+    for (const auto& recipient : recipients) {
+      route_task.Recipients.emplace_back(recipient.As<std::string>());
+    }
+
+    batch.push_back(std::move(route_task));
+  }
+
+  return batch;
+}
+
+}  // namespace NChat::NInfra
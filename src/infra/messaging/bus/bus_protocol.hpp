@@ -0,0 +1,23 @@
+#pragma once
+
+#include <core/messaging/bus/message_bus.hpp>
+
+#include <userver/formats/json/value.hpp>
+
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace NChat::NInfra {
+
+// Узлы пересылают друг другу пачки по HTTP, секрет отсекает запросы не из кластера
+inline constexpr std::string_view kBusDeliverPath = "/internal/v1/bus/deliver";
+inline constexpr std::string_view kBusSecretHeader = "X-Chat-Bus-Secret";
+inline constexpr std::string_view kBusNodeHeader = "X-Chat-Bus-Node";
+
+std::string SerializeForwardBatch(std::span<const NCore::TRouteTask> batch);
+
+// Бросает TMessageTextInvalidException на невалидный текст и formats::json::Exception на битую структуру
+std::vector<NCore::TRouteTask> ParseForwardBatch(const userver::formats::json::Value& json);
+
+}  // namespace NChat::NInfra
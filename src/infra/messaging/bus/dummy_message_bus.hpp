@@ -0,0 +1,19 @@
+#pragma once
+
+#include <core/messaging/bus/message_bus.hpp>
+
+namespace NChat::NInfra {
+
+// Один узел: всех, кого нет в локальном реестре, считаем офлайн
+class TDummyMessageBus : public NCore::IMessageBus {
+ public:
+  std::vector<NCore::TSendStatus> Forward(std::vector<NCore::TRouteTask> batch) override {
+    std::vector<NCore::TSendStatus> statuses(batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      statuses[i].Offline = batch[i].Recipients.size();
+    }
+    return statuses;
+  }
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,192 @@
+#include "http_message_bus.hpp"
+
+#include <infra/messaging/bus/bus_protocol.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/datetime.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+namespace NChat::NInfra {
+
+THttpMessageBus::THttpMessageBus(userver::clients::http::Client& http_client, const NCore::INodeLocator& locator,
+                                 TMessageBusSettings settings, TMessageBusStatistics& stats)
+    : HttpClient_(http_client), Locator_(locator), Settings_(std::move(settings)), Stats_(stats) {
+  for (const auto& [node, url] : Settings_.Peers) {
+    if (node == Settings_.LocalNode) {
+      continue;
+    }
+
+    auto outbox = std::make_unique<TOutbox>();
+    outbox->Url = url + std::string{kBusDeliverPath};
+    Outboxes_.emplace(node, std::move(outbox));
+  }
+
+  Task_ = userver::utils::CriticalAsync("message-bus-flusher", [this] { Run(); });
+}
+
+THttpMessageBus::~THttpMessageBus() {
+  // Дожидаемся отправки накопленного, иначе сообщения пиров теряются при каждом рестарте
+  IsStopping_.store(true);
+  FlushRequested_.Send();
+  Task_.Get();
+}
+
+std::vector<NCore::TSendStatus> THttpMessageBus::Forward(std::vector<NCore::TRouteTask> batch) {
+  std::vector<NCore::TSendStatus> statuses(batch.size());
+  bool flush_now = false;
+
+  std::vector<NCore::NDomain::TUserId> users;
+  for (const auto& task : batch) {
+    users.insert(users.end(), task.Recipients.begin(), task.Recipients.end());
+  }
+  const auto locations = Locator_.Locate(users);
+
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    const auto& [recipients, message] = batch[i];
+
+    // Узел -> индексы получателей задачи, которые на нем могут быть
+    std::unordered_map<NCore::NDomain::TNodeId, std::vector<std::size_t>> by_node;
+    std::vector<bool> located(recipients.size(), false);
+    std::vector<bool> accepted(recipients.size(), false);
+
+    for (std::size_t j = 0; j < recipients.size(); ++j) {
+      const auto location = locations.find(recipients[j]);
+      if (location == locations.end()) {
+        continue;
+      }
+
+      for (const auto& node : location->second) {
+        if (!Outboxes_.contains(node)) {
+          continue;
+        }
+        by_node[node].push_back(j);
+        located[j] = true;
+      }
+    }
+
+    for (const auto& [node, indices] : by_node) {
+      NCore::TRouteTask task{.Recipients{}, .Message = message};
+      task.Recipients.reserve(indices.size());
+      for (const auto index : indices) {
+        task.Recipients.push_back(recipients[index]);
+      }
+
+      auto& outbox = *Outboxes_.at(node);
+      {
+        std::lock_guard lock(outbox.Mutex);
+        if (outbox.Pending.size() >= Settings_.MaxPendingTasks) {
+          continue;
+        }
+        outbox.Pending.push_back(std::move(task));
+        flush_now |= outbox.Pending.size() >= Settings_.MaxBatchSize;
+      }
+
+      ++Stats_.pending_tasks;
+      for (const auto index : indices) {
+        accepted[index] = true;
+      }
+    }
+
+    for (std::size_t j = 0; j < recipients.size(); ++j) {
+      if (!located[j]) {
+        ++statuses[i].Offline;
+      } else if (accepted[j]) {
+        ++statuses[i].Forwarded;
+      } else {
+        ++statuses[i].Dropped;
+      }
+    }
+
+    Stats_.forwarded_total.Add({statuses[i].Forwarded});
+    Stats_.dropped_total.Add({statuses[i].Dropped});
+  }
+
+  if (flush_now) {
+    FlushRequested_.Send();
+  }
+
+  return statuses;
+}
+
+void THttpMessageBus::Run() {
+  while (!IsStopping_.load()) {
+    [[maybe_unused]] const auto requested = FlushRequested_.WaitForEventFor(Settings_.FlushInterval);
+    FlushAll();
+  }
+
+  FlushAll();
+}
+
+void THttpMessageBus::FlushAll() {
+  std::vector<userver::engine::TaskWithResult<void>> senders;
+  const auto started = userver::utils::datetime::SteadyNow();
+
+  for (auto& [node, outbox] : Outboxes_) {
+    std::vector<NCore::TRouteTask> pending;
+    {
+      std::lock_guard lock(outbox->Mutex);
+      pending.swap(outbox->Pending);
+    }
+
+    if (pending.empty()) {
+      continue;
+    }
+    Stats_.pending_tasks -= pending.size();
+
+    // Узлы опрашиваются параллельно, порядок пачек нужен только внутри одного узла
+    senders.push_back(userver::utils::Async(
+        "message-bus-send", [this, &node, &url = outbox->Url, pending = std::move(pending)] {
+          SendChunks(node, url, pending);
+        }));
+  }
+
+  if (senders.empty()) {
+    return;
+  }
+
+  for (auto& sender : senders) {
+    sender.Get();
+  }
+
+  Stats_.forward_latency_ms_hist.Account(
+      std::chrono::duration_cast<std::chrono::milliseconds>(userver::utils::datetime::SteadyNow() - started).count());
+}
+
+void THttpMessageBus::SendChunks(const NCore::NDomain::TNodeId& node, const std::string& url,
+                                 std::span<const NCore::TRouteTask> tasks) {
+  // Большая очередь уходит несколькими запросами; следующий - только после ответа на предыдущий,
+  // иначе узел может доставить сообщения чата не в том порядке, в котором они были отправлены
+  for (std::size_t offset = 0; offset < tasks.size(); offset += Settings_.MaxBatchSize) {
+    const auto chunk = tasks.subspan(offset, std::min(Settings_.MaxBatchSize, tasks.size() - offset));
+
+    std::size_t recipients = 0;
+    for (const auto& task : chunk) {
+      recipients += task.Recipients.size();
+    }
+    Stats_.batch_size_hist.Account(chunk.size());
+
+    try {
+      const auto response = HttpClient_.CreateRequest()
+                                .post(url, SerializeForwardBatch(chunk))
+                                .headers({{kBusSecretHeader, Settings_.Secret},
+                                          {kBusNodeHeader, Settings_.LocalNode.GetUnderlying()},
+                                          {"Content-Type", "application/json"}})
+                                .timeout(Settings_.Timeout)
+                                .retry(1)
+                                .perform();
+      if (!response->IsOk()) {
+        LOG_WARNING() << "Node " << node.GetUnderlying() << " rejected forwarded batch with status "
+                      << static_cast<int>(response->status_code());
+        Stats_.failed_total.Add({recipients});
+      }
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to forward batch to node " << node.GetUnderlying() << ": " << ex.what();
+      Stats_.failed_total.Add({recipients});
+    }
+  }
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <core/messaging/bus/message_bus.hpp>
+#include <core/messaging/bus/node_locator.hpp>
+
+#include <infra/messaging/bus/metrics/bus_stats.hpp>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+namespace NChat::NInfra {
+
+struct TMessageBusSettings {
+  NCore::NDomain::TNodeId LocalNode;
+  std::unordered_map<NCore::NDomain::TNodeId, std::string> Peers;  // узел -> базовый URL
+  std::string Secret;
+  std::size_t MaxBatchSize = 100;
+  std::size_t MaxPendingTasks = 10'000;
+  std::chrono::milliseconds FlushInterval{5};
+  std::chrono::milliseconds Timeout{500};
+};
+
+// Пересылка по HTTP: у каждого узла своя очередь, фоновая корутина отправляет накопленное одной пачкой на узел.
+// Узлы обслуживаются параллельно, пачки одного узла уходят строго друг за другом.
+// В testsuite пиры - экземпляры сервиса на loopback-портах
+class THttpMessageBus final : public NCore::IMessageBus {
+ public:
+  THttpMessageBus(userver::clients::http::Client& http_client, const NCore::INodeLocator& locator,
+                  TMessageBusSettings settings, TMessageBusStatistics& stats);
+  ~THttpMessageBus();
+
+  std::vector<NCore::TSendStatus> Forward(std::vector<NCore::TRouteTask> batch) override;
+
+ private:
+  struct TOutbox {
+    std::string Url;
+    userver::engine::Mutex Mutex;
+    std::vector<NCore::TRouteTask> Pending;
+  };
+
+  void Run();
+  void FlushAll();
+  void SendChunks(const NCore::NDomain::TNodeId& node, const std::string& url,
+                  std::span<const NCore::TRouteTask> tasks);
+
+ private:
+  userver::clients::http::Client& HttpClient_;
+  const NCore::INodeLocator& Locator_;
+  const TMessageBusSettings Settings_;
+  TMessageBusStatistics& Stats_;
+
+  // Набор узлов фиксирован на время жизни шины, меняется только содержимое очередей
+  std::unordered_map<NCore::NDomain::TNodeId, std::unique_ptr<TOutbox>> Outboxes_;
+
+  userver::engine::SingleConsumerEvent FlushRequested_;
+  std::atomic_bool IsStopping_{false};
+  userver::engine::TaskWithResult<void> Task_;
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,287 @@
+#include "http_message_bus.hpp"
+
+#include <core/messaging/mocks.hpp>
+
+#include <infra/messaging/bus/bus_protocol.hpp>
+
+#include <gmock/gmock.h>
+#include <userver/engine/sleep.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/http_server_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+using namespace NChat::NInfra;
+using NChat::NCore::TRouteTask;
+using NChat::NCore::NDomain::TNodeId;
+using NChat::NCore::NDomain::TUserId;
+using ::testing::ElementsAre;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SizeIs;
+using ::testing::UnorderedElementsAre;
+
+namespace {
+
+const TNodeId kSelf{"node-1"};
+const TNodeId kPeer{"node-2"};
+const TNodeId kOtherPeer{"node-3"};
+const TUserId kAlice{"alice"};
+const TUserId kBob{"bob"};
+const TUserId kCarol{"carol"};
+
+using THttpRequest = userver::utest::HttpServerMock::HttpRequest;
+using THttpResponse = userver::utest::HttpServerMock::HttpResponse;
+
+// Пир, который запоминает принятые пачки и отвечает заданным статусом через delay
+class TFakePeer {
+ public:
+  explicit TFakePeer(int status = 200, std::chrono::milliseconds delay = {})
+      : Server_([this, status, delay](const THttpRequest& request) {
+          {
+            std::lock_guard lock(Mutex_);
+            Requests_.push_back(request);
+            MaxInflight_ = std::max(MaxInflight_, ++Inflight_);
+          }
+          userver::engine::SleepFor(delay);
+          {
+            std::lock_guard lock(Mutex_);
+            --Inflight_;
+          }
+          return THttpResponse{.response_status = status};
+        }) {
+  }
+
+  std::string GetBaseUrl() const {
+    return Server_.GetBaseUrl();
+  }
+
+  std::vector<THttpRequest> GetRequests() const {
+    std::lock_guard lock(Mutex_);
+    return Requests_;
+  }
+
+  // Наибольшее число запросов, которые пир обрабатывал одновременно
+  std::size_t GetMaxInflight() const {
+    std::lock_guard lock(Mutex_);
+    return MaxInflight_;
+  }
+
+  // Задачи каждой принятой пачки по порядку
+  std::vector<std::vector<TRouteTask>> GetBatches() const {
+    std::vector<std::vector<TRouteTask>> batches;
+    for (const auto& request : GetRequests()) {
+      batches.push_back(ParseForwardBatch(userver::formats::json::FromString(request.body)));
+    }
+    return batches;
+  }
+
+ private:
+  mutable std::mutex Mutex_;
+  std::vector<THttpRequest> Requests_;
+  std::size_t Inflight_ = 0;
+  std::size_t MaxInflight_ = 0;
+  userver::utest::HttpServerMock Server_;
+};
+
+std::vector<TRouteTask> MakeBatch(std::size_t size, const std::vector<TUserId>& recipients) {
+  std::vector<TRouteTask> batch;
+  for (std::size_t i = 0; i < size; ++i) {
+    batch.push_back({recipients, CreateTestMessage("sender", "pc:chat", "message " + std::to_string(i))});
+  }
+  return batch;
+}
+
+}  // namespace
+
+class THttpMessageBusTest : public ::testing::Test {
+ protected:
+  // Фоновая отправка не срабатывает по таймеру: пачки уходят при разрушении шины или по MaxBatchSize
+  TMessageBusSettings MakeSettings(std::unordered_map<TNodeId, std::string> peers) const {
+    peers.emplace(kSelf, "http://localhost:1");
+    return TMessageBusSettings{.LocalNode = kSelf,
+                               .Peers = std::move(peers),
+                               .Secret = "secret",
+                               .MaxBatchSize = 100,
+                               .MaxPendingTasks = 100,
+                               .FlushInterval = std::chrono::hours(1),
+                               .Timeout = std::chrono::seconds(5)};
+  }
+
+  std::unique_ptr<THttpMessageBus> MakeBus(TMessageBusSettings settings) {
+    return std::make_unique<THttpMessageBus>(*HttpClient, Locator, std::move(settings), Stats);
+  }
+
+  std::shared_ptr<userver::clients::http::Client> HttpClient = userver::utest::CreateHttpClient();
+  NiceMock<MockNodeLocator> Locator;
+  TMessageBusStatistics Stats;
+};
+
+UTEST_F(THttpMessageBusTest, ForwardsToLocatedNodesOnly) {
+  TFakePeer peer;
+  TFakePeer other_peer;
+
+  // Сам узел и неизвестный шине узел не считаются: без пиров получатель офлайн
+  EXPECT_CALL(Locator, Locate(ElementsAre(kAlice, kBob, kCarol)))
+      .WillOnce(Return(std::unordered_map<TUserId, std::vector<TNodeId>>{
+          {kAlice, {kPeer, kOtherPeer}}, {kBob, {kSelf, TNodeId{"node-unknown"}}}}));
+
+  auto bus = MakeBus(MakeSettings({{kPeer, peer.GetBaseUrl()}, {kOtherPeer, other_peer.GetBaseUrl()}}));
+  const auto statuses = bus->Forward(MakeBatch(1, {kAlice, kBob, kCarol}));
+
+  ASSERT_THAT(statuses, SizeIs(1));
+  EXPECT_EQ(statuses[0].Forwarded, 1);
+  EXPECT_EQ(statuses[0].Offline, 2);
+  EXPECT_EQ(statuses[0].Dropped, 0);
+
+  bus.reset();
+
+  for (const auto* target : {&peer, &other_peer}) {
+    const auto requests = target->GetRequests();
+    ASSERT_THAT(requests, SizeIs(1));
+    EXPECT_EQ(requests[0].path, kBusDeliverPath);
+    EXPECT_EQ(requests[0].headers.at(std::string{kBusSecretHeader}), "secret");
+    EXPECT_EQ(requests[0].headers.at(std::string{kBusNodeHeader}), kSelf.GetUnderlying());
+
+    const auto batches = target->GetBatches();
+    ASSERT_THAT(batches[0], SizeIs(1));
+    EXPECT_THAT(batches[0][0].Recipients, ElementsAre(kAlice));
+  }
+}
+
+UTEST_F(THttpMessageBusTest, RecipientsOfOneNodeShareTask) {
+  TFakePeer peer;
+
+  EXPECT_CALL(Locator, Locate(_)).WillOnce(Return(std::unordered_map<TUserId, std::vector<TNodeId>>{
+      {kAlice, {kPeer}}, {kBob, {kPeer}}}));
+
+  auto bus = MakeBus(MakeSettings({{kPeer, peer.GetBaseUrl()}}));
+  const auto statuses = bus->Forward(MakeBatch(1, {kAlice, kBob}));
+  EXPECT_EQ(statuses[0].Forwarded, 2);
+
+  bus.reset();
+
+  const auto batches = peer.GetBatches();
+  ASSERT_THAT(batches, SizeIs(1));
+  ASSERT_THAT(batches[0], SizeIs(1));
+  EXPECT_THAT(batches[0][0].Recipients, UnorderedElementsAre(kAlice, kBob));
+  EXPECT_EQ(Stats.forwarded_total.Load().value, 2);
+}
+
+UTEST_F(THttpMessageBusTest, FullOutboxDropsTasks) {
+  TFakePeer peer;
+
+  ON_CALL(Locator, Locate(_))
+      .WillByDefault(Return(std::unordered_map<TUserId, std::vector<TNodeId>>{{kAlice, {kPeer}}}));
+
+  auto settings = MakeSettings({{kPeer, peer.GetBaseUrl()}});
+  settings.MaxPendingTasks = 2;
+  auto bus = MakeBus(std::move(settings));
+
+  const auto statuses = bus->Forward(MakeBatch(3, {kAlice}));
+
+  ASSERT_THAT(statuses, SizeIs(3));
+  EXPECT_EQ(statuses[0].Forwarded, 1);
+  EXPECT_EQ(statuses[1].Forwarded, 1);
+  EXPECT_EQ(statuses[2].Dropped, 1);
+  EXPECT_EQ(Stats.dropped_total.Load().value, 1);
+  EXPECT_EQ(Stats.pending_tasks.load(), 2);
+
+  bus.reset();
+
+  // Отброшенная задача не уходит пиру, очередь узла разобрана
+  const auto batches = peer.GetBatches();
+  ASSERT_THAT(batches, SizeIs(1));
+  EXPECT_THAT(batches[0], SizeIs(2));
+  EXPECT_EQ(Stats.pending_tasks.load(), 0);
+}
+
+UTEST_F(THttpMessageBusTest, LargeOutboxIsSentInChunks) {
+  TFakePeer peer;
+
+  ON_CALL(Locator, Locate(_))
+      .WillByDefault(Return(std::unordered_map<TUserId, std::vector<TNodeId>>{{kAlice, {kPeer}}}));
+
+  auto settings = MakeSettings({{kPeer, peer.GetBaseUrl()}});
+  settings.MaxBatchSize = 2;
+  auto bus = MakeBus(std::move(settings));
+
+  // Forward не уступает корутину: все пять задач успевают лечь в очередь до отправки
+  bus->Forward(MakeBatch(5, {kAlice}));
+  bus.reset();
+
+  const auto batches = peer.GetBatches();
+  ASSERT_THAT(batches, SizeIs(3));
+  EXPECT_THAT(batches[0], SizeIs(2));
+  EXPECT_THAT(batches[1], SizeIs(2));
+  EXPECT_THAT(batches[2], SizeIs(1));
+
+  // Порядок задач узла сохраняется между пачками
+  EXPECT_EQ(batches[0][0].Message.Payload->Text.Value(), "message 0");
+  EXPECT_EQ(batches[2][0].Message.Payload->Text.Value(), "message 4");
+}
+
+UTEST_F_MT(THttpMessageBusTest, ChunksOfOneNodeAreSentInOrder, 4) {
+  TFakePeer peer(200, std::chrono::milliseconds(50));
+  TFakePeer other_peer(200, std::chrono::milliseconds(50));
+
+  ON_CALL(Locator, Locate(_)).WillByDefault(Return(std::unordered_map<TUserId, std::vector<TNodeId>>{
+      {kAlice, {kPeer}}, {kBob, {kOtherPeer}}}));
+
+  auto settings = MakeSettings({{kPeer, peer.GetBaseUrl()}, {kOtherPeer, other_peer.GetBaseUrl()}});
+  settings.MaxBatchSize = 2;
+  auto bus = MakeBus(std::move(settings));
+
+  bus->Forward(MakeBatch(6, {kAlice, kBob}));
+  bus.reset();
+
+  // Медленный пир не получает следующую пачку, пока не ответил на предыдущую
+  for (const auto* target : {&peer, &other_peer}) {
+    EXPECT_EQ(target->GetMaxInflight(), 1);
+
+    const auto batches = target->GetBatches();
+    ASSERT_THAT(batches, SizeIs(3));
+    for (std::size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_THAT(batches[i], SizeIs(2));
+      EXPECT_EQ(batches[i][0].Message.Payload->Text.Value(), "message " + std::to_string(2 * i));
+      EXPECT_EQ(batches[i][1].Message.Payload->Text.Value(), "message " + std::to_string(2 * i + 1));
+    }
+  }
+}
+
+UTEST_F(THttpMessageBusTest, RejectedBatchCountsFailedRecipients) {
+  TFakePeer peer(500);
+
+  ON_CALL(Locator, Locate(_)).WillByDefault(Return(std::unordered_map<TUserId, std::vector<TNodeId>>{
+      {kAlice, {kPeer}}, {kBob, {kPeer}}}));
+
+  auto bus = MakeBus(MakeSettings({{kPeer, peer.GetBaseUrl()}}));
+
+  // Для отправителя задачи приняты: о сбое узнает только метрика
+  const auto statuses = bus->Forward(MakeBatch(2, {kAlice, kBob}));
+  EXPECT_EQ(statuses[0].Forwarded, 2);
+  EXPECT_EQ(statuses[1].Forwarded, 2);
+
+  bus.reset();
+
+  EXPECT_THAT(peer.GetRequests(), SizeIs(1));
+  EXPECT_EQ(Stats.failed_total.Load().value, 4);
+}
+
+UTEST_F(THttpMessageBusTest, UnreachableNodeCountsFailedRecipients) {
+  ON_CALL(Locator, Locate(_))
+      .WillByDefault(Return(std::unordered_map<TUserId, std::vector<TNodeId>>{{kAlice, {kPeer}}}));
+
+  // Порт 1 закрыт: запрос падает с ошибкой соединения, а не ответом
+  auto settings = MakeSettings({{kPeer, "http://localhost:1"}});
+  settings.Timeout = std::chrono::milliseconds(200);
+  auto bus = MakeBus(std::move(settings));
+
+  bus->Forward(MakeBatch(3, {kAlice}));
+  bus.reset();
+
+  EXPECT_EQ(Stats.failed_total.Load().value, 3);
+}
@@ -0,0 +1,25 @@
+#include "bus_stats.hpp"
+
+#include <userver/utils/statistics/writer.hpp>
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TMessageBusStatistics& stats) {
+  writer["pending"]["tasks"] = stats.pending_tasks.load();
+  writer["forwarded"]["total"] = stats.forwarded_total;
+  writer["dropped"]["total"] = stats.dropped_total;
+  writer["failed"]["total"] = stats.failed_total;
+  writer["received"]["total"] = stats.received_total;
+  writer["batch"]["size"]["hist"] = stats.batch_size_hist;
+  writer["forward"]["latency"]["ms"]["hist"] = stats.forward_latency_ms_hist;
+}
+
+void ResetMetric(TMessageBusStatistics& stats) {
+  stats.pending_tasks = 0;
+  stats.forwarded_total.Store({0});
+  stats.dropped_total.Store({0});
+  stats.failed_total.Store({0});
+  stats.received_total.Store({0});
+}
+
+}  // namespace NChat::NInfra
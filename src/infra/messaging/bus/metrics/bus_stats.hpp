@@ -0,0 +1,28 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <atomic>
+
+namespace NChat::NInfra {
+
+struct TMessageBusStatistics {
+  std::atomic<std::size_t> pending_tasks{0};
+  userver::utils::statistics::RateCounter forwarded_total{0};
+  userver::utils::statistics::RateCounter dropped_total{0};
+  userver::utils::statistics::RateCounter failed_total{0};
+  userver::utils::statistics::RateCounter received_total{0};
+
+  userver::utils::statistics::Histogram batch_size_hist{{1, 10, 50, 100, 250, 500, 1000}};
+  userver::utils::statistics::Histogram forward_latency_ms_hist{{1, 2, 5, 10, 25, 50, 100, 250}};
+};
+
+inline const userver::utils::statistics::MetricTag<TMessageBusStatistics> kMessageBusTag{"chat_message_bus"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TMessageBusStatistics& stats);
+void ResetMetric(TMessageBusStatistics& stats);
+
+}  // namespace NChat::NInfra
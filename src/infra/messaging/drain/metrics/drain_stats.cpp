@@ -0,0 +1,14 @@
+#include "drain_stats.hpp"
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TDrainStatistics& stats) {
+  writer["draining"]["current"] = stats.draining;
+  writer["woken_mailboxes"]["current"] = stats.woken_mailboxes;
+  writer["reconnect_hints"]["total"] = stats.reconnect_hints_total;
+}
+
+void ResetMetric(TDrainStatistics& stats) {
+  stats.reconnect_hints_total.Store({0});
+}
+}  // namespace NChat::NInfra
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <atomic>
+
+namespace NChat::NInfra {
+struct TDrainStatistics {
+  std::atomic<int> draining{0};
+  std::atomic<int> woken_mailboxes{0};
+  userver::utils::statistics::RateCounter reconnect_hints_total{0};
+};
+
+inline const userver::utils::statistics::MetricTag<TDrainStatistics> kDrainTag{"chat_drain"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TDrainStatistics& stats);
+void ResetMetric(TDrainStatistics& stats);
+
+}  // namespace NChat::NInfra
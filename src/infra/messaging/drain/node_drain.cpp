@@ -0,0 +1,41 @@
+#include "node_drain.hpp"
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/rand.hpp>
+
+namespace NChat::NInfra {
+
+TNodeDrain::TNodeDrain(NCore::IMailboxRegistry& registry, TDrainSettings settings, TDrainStatistics& stats)
+    : Registry_(registry), Settings_(settings), Stats_(stats) {
+}
+
+bool TNodeDrain::IsDraining() const {
+  return IsDraining_.load(std::memory_order_relaxed);
+}
+
+std::chrono::milliseconds TNodeDrain::GetReconnectAfter() {
+  Stats_.reconnect_hints_total.Add({1});
+
+  if (Settings_.ReconnectJitter <= std::chrono::milliseconds::zero()) {
+    return Settings_.ReconnectAfter;
+  }
+
+  const auto jitter = userver::utils::RandRange(Settings_.ReconnectJitter.count() + 1);
+  return Settings_.ReconnectAfter + std::chrono::milliseconds{jitter};
+}
+
+void TNodeDrain::Start() {
+  if (IsDraining_.exchange(true)) {
+    return;
+  }
+
+  Stats_.draining = 1;
+
+  // Флаг выставлен до побудки: поллер, проснувшийся от Wakeup, уже видит режим вывода
+  const auto woken = Registry_.WakeConsumers();
+  Stats_.woken_mailboxes = static_cast<int>(woken);
+
+  LOG_WARNING() << fmt::format("Node drain: new sessions refused, pollers of {} mailboxes released", woken);
+}
+
+}  // namespace NChat::NInfra
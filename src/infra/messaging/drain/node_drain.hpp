@@ -0,0 +1,44 @@
+#pragma once
+
+#include <core/messaging/mailbox/mailbox_registry.hpp>
+
+#include <app/services/message/drain_mode.hpp>
+
+#include <infra/messaging/drain/metrics/drain_stats.hpp>
+
+#include <atomic>
+#include <chrono>
+
+namespace NChat::NInfra {
+
+struct TDrainSettings {
+  std::chrono::milliseconds ReconnectAfter{1000};
+  // Клиенты возвращаются равномерно в [ReconnectAfter, ReconnectAfter + ReconnectJitter]
+  std::chrono::milliseconds ReconnectJitter{10000};
+};
+
+/*
+Drain of the node before it stops.
+Start() refuses new sessions and wakes every poller with a Wakeup message, so in-flight long polls return
+at once instead of holding the shutdown for up to polling_time_sec. Each released client gets its own
+jittered reconnect delay: the reconnect storm to StartSession, JWT checks and profile caches becomes a ramp.
+*/
+class TNodeDrain final : public NApp::IDrainMode {
+ public:
+  TNodeDrain(NCore::IMailboxRegistry& registry, TDrainSettings settings, TDrainStatistics& stats);
+
+  bool IsDraining() const override;
+  std::chrono::milliseconds GetReconnectAfter() override;
+
+  // Повторный вызов ничего не делает
+  void Start();
+
+ private:
+  NCore::IMailboxRegistry& Registry_;
+  const TDrainSettings Settings_;
+  TDrainStatistics& Stats_;
+
+  std::atomic_bool IsDraining_{false};
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,43 @@
+#include "node_drain.hpp"
+
+#include <core/messaging/mocks.hpp>
+
+#include <userver/utest/utest.hpp>
+
+#include <set>
+
+using namespace NChat::NInfra;
+
+UTEST(NodeDrain, StartWakesConsumersOnce) {
+  ::testing::StrictMock<MockMailboxRegistry> registry;
+  TDrainStatistics stats;
+  TNodeDrain drain(registry, TDrainSettings{}, stats);
+
+  EXPECT_FALSE(drain.IsDraining());
+
+  EXPECT_CALL(registry, WakeConsumers()).WillOnce(::testing::Return(3));
+  drain.Start();
+  drain.Start();
+
+  EXPECT_TRUE(drain.IsDraining());
+  EXPECT_EQ(stats.woken_mailboxes.load(), 3);
+}
+
+UTEST(NodeDrain, ReconnectAfterIsJittered) {
+  ::testing::NiceMock<MockMailboxRegistry> registry;
+  TDrainStatistics stats;
+  const TDrainSettings settings{.ReconnectAfter = std::chrono::milliseconds{1000},
+                                .ReconnectJitter = std::chrono::milliseconds{5000}};
+  TNodeDrain drain(registry, settings, stats);
+
+  std::set<std::int64_t> delays;
+  for (int i = 0; i < 100; ++i) {
+    const auto delay = drain.GetReconnectAfter();
+    EXPECT_GE(delay, settings.ReconnectAfter);
+    EXPECT_LE(delay, settings.ReconnectAfter + settings.ReconnectJitter);
+    delays.insert(delay.count());
+  }
+
+  // Клиенты возвращаются вразнобой, а не одной волной
+  EXPECT_GT(delays.size(), 50);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <core/messaging/history/history_repo.hpp>
+
+namespace NChat::NInfra {
+
+class TDummyRecentMessages : public NCore::IRecentMessages {
+ public:
+  void Remember(const NCore::NDomain::TMessage&) override {
+    return;
+  }
+
+  std::optional<std::vector<NCore::NDomain::THistoryMessage>> GetPage(const NCore::NDomain::TChatId&,
+                                                                      std::optional<NCore::NDomain::TMessageSeq>,
+                                                                      std::size_t) override {
+    return std::nullopt;
+  }
+};
+
+class TDummyHistoryRepository : public NCore::IMessageHistoryRepository {
+ public:
+  std::vector<NCore::NDomain::THistoryMessage> GetPage(const NCore::NDomain::TChatId&,
+                                                       std::optional<NCore::NDomain::TMessageSeq>,
+                                                       std::size_t) const override {
+    return {};
+  }
+};
+
+}  // namespace NChat::NInfra
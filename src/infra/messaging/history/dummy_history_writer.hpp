@@ -0,0 +1,14 @@
+#pragma once
+
+#include <app/services/message/history_writer.hpp>
+
+namespace NChat::NInfra {
+
+class TDummyHistoryWriter : public NApp::IHistoryWriter {
+ public:
+  bool Append(const NCore::NDomain::TMessage&) override {
+    return true;
+  }
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,83 @@
+#include "hot_tail_cache.hpp"
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime_light.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace NChat::NInfra {
+
+namespace {
+using NCore::NDomain::THistoryMessage;
+using NCore::NDomain::TMessageSeq;
+
+bool SeqLess(const THistoryMessage& message, TMessageSeq seq) {
+  return message.Seq < seq;
+}
+}  // namespace
+
+THotTailCache::THotTailCache(std::size_t shards_amount, std::size_t max_chats, std::size_t messages_per_chat,
+                             THotTailStatistics& stats)
+    : MessagesPerChat_(messages_per_chat), Stats_(stats) {
+  if (shards_amount == 0 || messages_per_chat == 0) {
+    throw std::invalid_argument("Hot tail needs at least one shard and one message per chat");
+  }
+
+  Shards_.reserve(shards_amount);
+  for (std::size_t i = 0; i < shards_amount; ++i) {
+    Shards_.push_back(std::make_unique<TShard>(std::max<std::size_t>(max_chats / shards_amount, 1)));
+  }
+}
+
+void THotTailCache::Remember(const NCore::NDomain::TMessage& message) {
+  const auto sent_at = userver::utils::datetime::Now() -
+                       std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                           userver::utils::datetime::SteadyNow() - message.Context.Get);
+
+  auto& shard = GetShard(message.ChatId);
+  std::lock_guard lock(shard.Mutex);
+
+  auto& tail = shard.Tails.GetOrEmplace(message.ChatId.GetUnderlying());
+
+  // Seq выдается при создании сообщения, а сюда оно доходит позже: конкурентные отправители
+  // и воркеры fan-out обгоняют друг друга, поэтому вставка по месту, а не в конец
+  const auto position = std::lower_bound(tail.begin(), tail.end(), message.Seq, SeqLess);
+  if (position == tail.begin() && tail.size() == MessagesPerChat_) {
+    return;  // старше всего кольца: в полном кольце ему места нет
+  }
+
+  tail.insert(position, THistoryMessage{.Seq = message.Seq, .Payload = message.Payload, .SentAt = sent_at});
+  if (tail.size() > MessagesPerChat_) {
+    tail.pop_front();
+  }
+}
+
+std::optional<std::vector<THistoryMessage>> THotTailCache::GetPage(const NCore::NDomain::TChatId& chat_id,
+                                                                   std::optional<TMessageSeq> before,
+                                                                   std::size_t limit) {
+  auto& shard = GetShard(chat_id);
+  std::lock_guard lock(shard.Mutex);
+
+  const auto* tail = shard.Tails.Get(chat_id.GetUnderlying());
+  if (!tail) {
+    ++Stats_.misses_total;
+    return std::nullopt;
+  }
+
+  const auto end = before ? std::lower_bound(tail->begin(), tail->end(), *before, SeqLess) : tail->end();
+  if (static_cast<std::size_t>(end - tail->begin()) < limit) {
+    ++Stats_.misses_total;
+    return std::nullopt;
+  }
+
+  ++Stats_.hits_total;
+  return std::vector<THistoryMessage>(end - limit, end);
+}
+
+THotTailCache::TShard& THotTailCache::GetShard(const NCore::NDomain::TChatId& chat_id) {
+  return *Shards_[std::hash<std::string>{}(chat_id.GetUnderlying()) % Shards_.size()];
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <core/messaging/history/history_repo.hpp>
+
+#include <infra/messaging/history/metrics/history_stats.hpp>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/engine/mutex.hpp>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace NChat::NInfra {
+
+/*
+Per-chat ring of the last messages routed through this instance, ordered by Seq.
+The ring is a contiguous suffix of the chat history, so a page of limit messages before a cursor
+is served from memory whenever the ring holds that many; otherwise the page is read from Postgres.
+Least recently written chats are evicted once a shard is full.
+*/
+class THotTailCache final : public NCore::IRecentMessages {
+ public:
+  THotTailCache(std::size_t shards_amount, std::size_t max_chats, std::size_t messages_per_chat,
+                THotTailStatistics& stats);
+
+  void Remember(const NCore::NDomain::TMessage& message) override;
+
+  std::optional<std::vector<NCore::NDomain::THistoryMessage>> GetPage(const NCore::NDomain::TChatId& chat_id,
+                                                                      std::optional<NCore::NDomain::TMessageSeq> before,
+                                                                      std::size_t limit) override;
+
+ private:
+  using TTail = std::deque<NCore::NDomain::THistoryMessage>;
+
+  struct TShard {
+    explicit TShard(std::size_t max_chats) : Tails(max_chats) {
+    }
+
+    userver::engine::Mutex Mutex;
+    userver::cache::LruMap<std::string, TTail> Tails;
+  };
+
+  TShard& GetShard(const NCore::NDomain::TChatId& chat_id);
+
+ private:
+  std::vector<std::unique_ptr<TShard>> Shards_;
+  const std::size_t MessagesPerChat_;
+  THotTailStatistics& Stats_;
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,95 @@
+#include "hot_tail_cache.hpp"
+
+#include <core/messaging/mocks.hpp>
+
+#include <userver/utest/utest.hpp>
+
+using namespace NChat::NInfra;
+using NChat::NCore::NDomain::TChatId;
+using NChat::NCore::NDomain::TMessage;
+
+namespace {
+TMessage MakeMessage(const std::string& chat_id, NChat::NCore::NDomain::TMessageSeq seq) {
+  auto message = CreateTestMessage("sender", chat_id, "text");
+  message.Seq = seq;
+  return message;
+}
+
+std::vector<NChat::NCore::NDomain::TMessageSeq> Seqs(const std::vector<NChat::NCore::NDomain::THistoryMessage>& page) {
+  std::vector<NChat::NCore::NDomain::TMessageSeq> seqs;
+  for (const auto& message : page) {
+    seqs.push_back(message.Seq);
+  }
+  return seqs;
+}
+}  // namespace
+
+UTEST(HotTailCache, ServesLatestPage) {
+  THotTailStatistics stats;
+  THotTailCache cache(4, 16, 5, stats);
+
+  for (int seq = 1; seq <= 4; ++seq) {
+    cache.Remember(MakeMessage("chat", seq));
+  }
+
+  auto page = cache.GetPage(TChatId{"chat"}, std::nullopt, 3);
+  ASSERT_TRUE(page.has_value());
+  EXPECT_EQ(Seqs(*page), (std::vector<NChat::NCore::NDomain::TMessageSeq>{2, 3, 4}));
+  EXPECT_EQ(stats.hits_total.Load().value, 1);
+}
+
+UTEST(HotTailCache, ServesPageBeforeCursor) {
+  THotTailStatistics stats;
+  THotTailCache cache(4, 16, 5, stats);
+
+  for (int seq = 1; seq <= 5; ++seq) {
+    cache.Remember(MakeMessage("chat", seq));
+  }
+
+  auto page = cache.GetPage(TChatId{"chat"}, 4, 2);
+  ASSERT_TRUE(page.has_value());
+  EXPECT_EQ(Seqs(*page), (std::vector<NChat::NCore::NDomain::TMessageSeq>{2, 3}));
+}
+
+// Кольцо не знает, что было до него, неполная страница читается из БД
+UTEST(HotTailCache, MissWhenRingTooShort) {
+  THotTailStatistics stats;
+  THotTailCache cache(4, 16, 5, stats);
+
+  cache.Remember(MakeMessage("chat", 1));
+  cache.Remember(MakeMessage("chat", 2));
+
+  EXPECT_FALSE(cache.GetPage(TChatId{"chat"}, std::nullopt, 3).has_value());
+  EXPECT_FALSE(cache.GetPage(TChatId{"chat"}, 2, 2).has_value());
+  EXPECT_FALSE(cache.GetPage(TChatId{"unknown"}, std::nullopt, 1).has_value());
+  EXPECT_EQ(stats.misses_total.Load().value, 3);
+}
+
+UTEST(HotTailCache, KeepsNewestMessagesInOrder) {
+  THotTailStatistics stats;
+  THotTailCache cache(4, 16, 3, stats);
+
+  for (auto seq : {1, 2, 4, 3, 5}) {
+    cache.Remember(MakeMessage("chat", seq));
+  }
+  // Опоздавшее сообщение старше всего полного кольца не вытесняет новые
+  cache.Remember(MakeMessage("chat", 0));
+
+  auto page = cache.GetPage(TChatId{"chat"}, std::nullopt, 3);
+  ASSERT_TRUE(page.has_value());
+  EXPECT_EQ(Seqs(*page), (std::vector<NChat::NCore::NDomain::TMessageSeq>{3, 4, 5}));
+  EXPECT_FALSE(cache.GetPage(TChatId{"chat"}, std::nullopt, 4).has_value());
+}
+
+UTEST(HotTailCache, EvictsLeastRecentlyWrittenChat) {
+  THotTailStatistics stats;
+  THotTailCache cache(1, 2, 3, stats);
+
+  cache.Remember(MakeMessage("first", 1));
+  cache.Remember(MakeMessage("second", 2));
+  cache.Remember(MakeMessage("third", 3));
+
+  EXPECT_FALSE(cache.GetPage(TChatId{"first"}, std::nullopt, 1).has_value());
+  EXPECT_TRUE(cache.GetPage(TChatId{"second"}, std::nullopt, 1).has_value());
+  EXPECT_TRUE(cache.GetPage(TChatId{"third"}, std::nullopt, 1).has_value());
+}
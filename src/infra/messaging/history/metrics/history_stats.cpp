@@ -0,0 +1,35 @@
+#include "history_stats.hpp"
+
+#include <userver/utils/statistics/writer.hpp>
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const THistoryWriterStatistics& stats) {
+  writer["queue"]["size"] = stats.queue_size.load();
+  writer["appended"]["total"] = stats.appended_total;
+  writer["dropped"]["total"] = stats.dropped_total;
+  writer["written"]["total"] = stats.written_total;
+  writer["failed"]["total"] = stats.failed_total;
+  writer["batch"]["size"]["hist"] = stats.batch_size_hist;
+  writer["flush"]["latency"]["ms"]["hist"] = stats.flush_latency_ms_hist;
+}
+
+void ResetMetric(THistoryWriterStatistics& stats) {
+  stats.queue_size = 0;
+  stats.appended_total.Store({0});
+  stats.dropped_total.Store({0});
+  stats.written_total.Store({0});
+  stats.failed_total.Store({0});
+}
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const THotTailStatistics& stats) {
+  writer["hits"]["total"] = stats.hits_total;
+  writer["misses"]["total"] = stats.misses_total;
+}
+
+void ResetMetric(THotTailStatistics& stats) {
+  stats.hits_total.Store({0});
+  stats.misses_total.Store({0});
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <atomic>
+
+namespace NChat::NInfra {
+
+struct THistoryWriterStatistics {
+  std::atomic<std::size_t> queue_size{0};
+  userver::utils::statistics::RateCounter appended_total{0};
+  userver::utils::statistics::RateCounter dropped_total{0};
+  userver::utils::statistics::RateCounter written_total{0};
+  userver::utils::statistics::RateCounter failed_total{0};
+
+  userver::utils::statistics::Histogram batch_size_hist{{1, 10, 50, 100, 250, 500, 1000}};
+  userver::utils::statistics::Histogram flush_latency_ms_hist{{1, 5, 10, 25, 50, 100, 250, 1000}};
+};
+
+inline const userver::utils::statistics::MetricTag<THistoryWriterStatistics> kHistoryWriterTag{
+    "chat_history_writer"};
+
+struct THotTailStatistics {
+  userver::utils::statistics::RateCounter hits_total{0};
+  userver::utils::statistics::RateCounter misses_total{0};
+};
+
+inline const userver::utils::statistics::MetricTag<THotTailStatistics> kHotTailTag{"chat_hot_tail"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const THistoryWriterStatistics& stats);
+void ResetMetric(THistoryWriterStatistics& stats);
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const THotTailStatistics& stats);
+void ResetMetric(THotTailStatistics& stats);
+
+}  // namespace NChat::NInfra
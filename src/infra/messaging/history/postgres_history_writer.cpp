@@ -0,0 +1,158 @@
+#include "postgres_history_writer.hpp"
+
+#include <NChat/sql_queries.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/chrono.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime_light.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <stdexcept>
+
+namespace NChat::NInfra {
+
+namespace {
+using namespace std::chrono_literals;
+}  // namespace
+
+EHistoryOverflowPolicy ParseOverflowPolicy(std::string_view policy) {
+  if (policy == "drop") {
+    return EHistoryOverflowPolicy::Drop;
+  }
+  if (policy == "wait") {
+    return EHistoryOverflowPolicy::Wait;
+  }
+  throw std::invalid_argument(fmt::format("Unknown history overflow policy: {}", policy));
+}
+
+TPostgresHistoryWriter::TPostgresHistoryWriter(userver::storages::postgres::ClusterPtr pg_cluster,
+                                               THistoryWriterSettings settings, THistoryWriterStatistics& stats)
+    : PgCluster_(std::move(pg_cluster)),
+      Settings_(settings),
+      Stats_(stats),
+      Queue_(Settings_.MaxQueueSize),
+      Task_(userver::utils::CriticalAsync("history-writer", [this] { Run(); })) {
+}
+
+TPostgresHistoryWriter::~TPostgresHistoryWriter() {
+  // Не отменяем задачу: она сама дописывает очередь, иначе при остановке теряется хвост истории
+  IsStopping_.store(true);
+  Task_.Get();
+}
+
+bool TPostgresHistoryWriter::Append(const NCore::NDomain::TMessage& message) {
+  auto copy = message;  // payload разделяется с доставкой, копируются только указатель и id чата
+
+  const bool pushed = Settings_.OverflowPolicy == EHistoryOverflowPolicy::Wait
+                          ? Queue_.PushWithDeadline(std::move(copy),
+                                                    userver::engine::Deadline::FromDuration(Settings_.OverflowWait))
+                          : Queue_.Push(std::move(copy));
+
+  if (!pushed) {
+    ++Stats_.dropped_total;
+    return false;
+  }
+
+  ++Stats_.appended_total;
+  return true;
+}
+
+void TPostgresHistoryWriter::Run() {
+  std::vector<TMessage> pending;
+  pending.reserve(Settings_.MaxBatchSize);
+  auto flush_deadline = userver::engine::Deadline::FromDuration(Settings_.FlushInterval);
+
+  while (!IsStopping_.load()) {
+    // Пока копить нечего, ждем первое сообщение; дальше добираем пачку до дедлайна сброса
+    const auto time_left = std::chrono::duration_cast<std::chrono::milliseconds>(flush_deadline.TimeLeft());
+    const auto timeout = pending.empty() ? Settings_.FlushInterval : std::max(time_left, 0ms);
+
+    auto chunk = Queue_.PopBatch(Settings_.MaxBatchSize - pending.size(), timeout);
+    if (pending.empty() && !chunk.empty()) {
+      flush_deadline = userver::engine::Deadline::FromDuration(Settings_.FlushInterval);
+    }
+    std::move(chunk.begin(), chunk.end(), std::back_inserter(pending));
+    Stats_.queue_size = Queue_.GetSizeApproximate();
+
+    if (!pending.empty() && (pending.size() >= Settings_.MaxBatchSize || flush_deadline.IsReached())) {
+      Flush(pending);
+    }
+  }
+
+  if (!pending.empty()) {
+    Flush(pending);
+  }
+
+  for (auto rest = Queue_.PopBatch(Settings_.MaxBatchSize, 0ms); !rest.empty();
+       rest = Queue_.PopBatch(Settings_.MaxBatchSize, 0ms)) {
+    Flush(rest);
+  }
+  Stats_.queue_size = 0;
+}
+
+void TPostgresHistoryWriter::Flush(std::vector<TMessage>& batch) {
+  // Строки одного чата идут подряд по seq и ложатся в соседние страницы индекса (channel_id, seq)
+  std::sort(batch.begin(), batch.end(), [](const TMessage& lhs, const TMessage& rhs) {
+    return std::tie(lhs.ChatId.GetUnderlying(), lhs.Seq) < std::tie(rhs.ChatId.GetUnderlying(), rhs.Seq);
+  });
+
+  std::vector<std::string> chat_ids;
+  std::vector<NCore::NDomain::TMessageSeq> seqs;
+  std::vector<std::string> sender_ids;
+  std::vector<std::string> texts;
+  std::vector<userver::storages::postgres::TimePointTz> created_at;
+  chat_ids.reserve(batch.size());
+  seqs.reserve(batch.size());
+  sender_ids.reserve(batch.size());
+  texts.reserve(batch.size());
+  created_at.reserve(batch.size());
+
+  // Время отправки хранится по steady-часам, в базу уходит пересчитанное в системные
+  const auto system_now = userver::utils::datetime::Now();
+  const auto steady_now = userver::utils::datetime::SteadyNow();
+
+  for (const auto& message : batch) {
+    chat_ids.push_back(message.ChatId.GetUnderlying());
+    seqs.push_back(message.Seq);
+    sender_ids.push_back(message.Payload->Sender.GetUnderlying());
+    texts.push_back(message.Payload->Text.Value());
+    created_at.emplace_back(system_now - std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                                             steady_now - message.Context.Get));
+  }
+
+  const auto started = userver::utils::datetime::SteadyNow();
+
+  // Повтор безопасен: если упал только ответ, а пачка записана, ON CONFLICT (channel_id, seq) пропустит ее строки
+  for (std::size_t attempt = 1;; ++attempt) {
+    try {
+      PgCluster_->Execute(userver::storages::postgres::ClusterHostType::kMaster, sql::kInsertMessages, chat_ids, seqs,
+                          sender_ids, texts, created_at);
+      Stats_.written_total.Add({batch.size()});
+      break;
+    } catch (const userver::storages::postgres::Error& ex) {
+      if (attempt >= Settings_.FlushAttempts) {
+        LOG_ERROR() << "History batch of " << batch.size() << " messages lost after " << attempt
+                    << " attempts: " << ex.what();
+        Stats_.failed_total.Add({batch.size()});
+        break;
+      }
+
+      LOG_WARNING() << "History batch flush failed, attempt " << attempt << ": " << ex.what();
+      userver::engine::InterruptibleSleepFor(Settings_.FlushInterval * attempt);
+    }
+  }
+
+  Stats_.batch_size_hist.Account(batch.size());
+  Stats_.flush_latency_ms_hist.Account(
+      std::chrono::duration_cast<std::chrono::milliseconds>(userver::utils::datetime::SteadyNow() - started).count());
+  batch.clear();
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <app/services/message/history_writer.hpp>
+
+#include <infra/concurrency/queue/vyukov_queue.hpp>
+#include <infra/messaging/history/metrics/history_stats.hpp>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/postgres/cluster.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <string_view>
+
+namespace NChat::NInfra {
+
+enum class EHistoryOverflowPolicy {
+  Drop,  // сообщение не попадает в историю, отправка не тормозит
+  Wait,  // отправитель ждет освобождения места не дольше OverflowWait
+};
+
+EHistoryOverflowPolicy ParseOverflowPolicy(std::string_view policy);
+
+struct THistoryWriterSettings {
+  std::size_t MaxQueueSize = 100'000;
+  std::size_t MaxBatchSize = 500;
+  std::chrono::milliseconds FlushInterval{50};
+  EHistoryOverflowPolicy OverflowPolicy = EHistoryOverflowPolicy::Drop;
+  std::chrono::milliseconds OverflowWait{10};
+  std::size_t FlushAttempts = 3;
+};
+
+// Write-behind: Append кладет сообщение в MPSC-очередь, фоновая корутина пачками пишет в Postgres
+class TPostgresHistoryWriter final : public NApp::IHistoryWriter {
+ public:
+  TPostgresHistoryWriter(userver::storages::postgres::ClusterPtr pg_cluster, THistoryWriterSettings settings,
+                         THistoryWriterStatistics& stats);
+  ~TPostgresHistoryWriter();
+
+  bool Append(const NCore::NDomain::TMessage& message) override;
+
+ private:
+  void Run();
+  void Flush(std::vector<TMessage>& batch);
+
+ private:
+  userver::storages::postgres::ClusterPtr PgCluster_;
+  const THistoryWriterSettings Settings_;
+  THistoryWriterStatistics& Stats_;
+
+  TVyukovMessageQueue Queue_;
+  std::atomic_bool IsStopping_{false};
+  userver::engine::TaskWithResult<void> Task_;
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,11 @@
+#include "idempotency_config.hpp"
+
+namespace NChat::NInfra {
+
+TIdempotencyConfig Parse(const userver::formats::json::Value& value,
+                         userver::formats::parse::To<TIdempotencyConfig>) {
+  return TIdempotencyConfig{value["is_enabled"].As<bool>(), std::chrono::seconds{value["window_sec"].As<int>()},
+                            value["max_keys_per_user"].As<std::size_t>()};
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/dynamic_config/value.hpp>
+
+#include <chrono>
+
+namespace NChat::NInfra {
+
+struct TIdempotencyConfig {
+  bool IsEnabled{false};
+  std::chrono::seconds Window{60};
+  std::size_t MaxKeysPerUser{256};
+};
+
+TIdempotencyConfig Parse(const userver::formats::json::Value& value, userver::formats::parse::To<TIdempotencyConfig>);
+
+const userver::dynamic_config::Key<TIdempotencyConfig> kIdempotencyConfig{
+    "IDEMPOTENCY_CONFIG", userver::dynamic_config::DefaultAsJsonString{R"(
+  {
+    "is_enabled": true,
+    "window_sec": 60,
+    "max_keys_per_user": 256
+  }
+)"}};
+
+}  // namespace NChat::NInfra
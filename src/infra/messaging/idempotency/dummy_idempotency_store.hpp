@@ -0,0 +1,28 @@
+#pragma once
+
+#include <app/services/message/idempotency_store.hpp>
+
+namespace NChat::NInfra {
+
+class TDummyIdempotencyStore : public NApp::IIdempotencyStore {
+ public:
+  using TUserId = NCore::NDomain::TUserId;
+
+  NApp::EIdempotencyKeyState TryRemember(const TUserId&, std::string_view) override {
+    return NApp::EIdempotencyKeyState::New;
+  }
+
+  void Complete(const TUserId&, std::string_view) override {
+    return;
+  }
+
+  void Forget(const TUserId&, std::string_view) override {
+    return;
+  }
+
+  void TraverseKeys() override {
+    return;
+  }
+};
+
+}  // namespace NChat::NInfra
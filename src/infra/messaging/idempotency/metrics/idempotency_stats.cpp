@@ -0,0 +1,18 @@
+#include "idempotency_stats.hpp"
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TIdempotencyStatistics& stats) {
+  writer["opened"]["current"] = stats.active_amount;
+  writer["removed"]["total"] = stats.removed_total;
+  writer["evicted"]["keys"]["total"] = stats.evicted_keys_total;
+  writer["shards"]["size"]["hist"] = stats.shard_size;
+}
+
+void ResetMetric(TIdempotencyStatistics& stats) {
+  stats.active_amount = 0;
+  stats.removed_total.Store({0});
+  stats.evicted_keys_total.Store({0});
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,156 @@
+#include "sharded_idempotency_store.hpp"
+
+#include <infra/messaging/idempotency/config/idempotency_config.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/datetime.hpp>
+
+namespace NChat::NInfra {
+
+TDedupWindow::TDedupWindow() : LastAccess_(userver::utils::datetime::SteadyNow()) {
+}
+
+NApp::EIdempotencyKeyState TDedupWindow::TryRemember(std::string_view key, TTimePoint now, TDuration window,
+                                                     std::size_t max_keys) {
+  LastAccess_.store(now, std::memory_order_relaxed);
+
+  std::lock_guard lock(Mutex_);
+  EvictExpired(now - window);
+
+  if (auto it = Keys_.find(key); it != Keys_.end()) {
+    return it->second.IsPending ? NApp::EIdempotencyKeyState::Pending : NApp::EIdempotencyKeyState::Completed;
+  }
+
+  while (Keys_.size() >= max_keys && EvictOldest()) {
+  }
+
+  Keys_.emplace(std::string{key}, TKeyEntry{.FirstSeen = now});
+  Order_.emplace_back(now, std::string{key});
+
+  return NApp::EIdempotencyKeyState::New;
+}
+
+void TDedupWindow::Complete(std::string_view key) {
+  std::lock_guard lock(Mutex_);
+
+  // Ключ мог уйти из окна, пока шла отправка: тогда повтор пройдет как новый
+  if (auto it = Keys_.find(key); it != Keys_.end()) {
+    it->second.IsPending = false;
+  }
+}
+
+void TDedupWindow::Forget(std::string_view key) {
+  std::lock_guard lock(Mutex_);
+
+  if (auto it = Keys_.find(key); it != Keys_.end()) {
+    Keys_.erase(it);
+  }
+}
+
+std::size_t TDedupWindow::CleanExpired(TTimePoint now, TDuration window) {
+  std::lock_guard lock(Mutex_);
+  return EvictExpired(now - window);
+}
+
+std::size_t TDedupWindow::GetSize() const {
+  std::lock_guard lock(Mutex_);
+  return Keys_.size();
+}
+
+TDedupWindow::TTimePoint TDedupWindow::GetLastAccess() const {
+  return LastAccess_.load(std::memory_order_relaxed);
+}
+
+std::size_t TDedupWindow::EvictExpired(TTimePoint deadline) {
+  std::size_t removed_amount = 0;
+
+  while (!Order_.empty() && Order_.front().first < deadline) {
+    auto& [timepoint, key] = Order_.front();
+
+    if (auto it = Keys_.find(key); it != Keys_.end() && it->second.FirstSeen == timepoint) {
+      Keys_.erase(it);
+      ++removed_amount;
+    }
+
+    Order_.pop_front();
+  }
+
+  return removed_amount;
+}
+
+bool TDedupWindow::EvictOldest() {
+  while (!Order_.empty()) {
+    auto [timepoint, key] = std::move(Order_.front());
+    Order_.pop_front();
+
+    if (auto it = Keys_.find(key); it != Keys_.end() && it->second.FirstSeen == timepoint) {
+      Keys_.erase(it);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+TShardedIdempotencyStore::TShardedIdempotencyStore(std::size_t shard_amount,
+                                                   userver::dynamic_config::Source config_source,
+                                                   TIdempotencyStatistics& stats)
+    : Windows_(shard_amount), ConfigSource_(std::move(config_source)), Stats_(stats) {
+  LOG_INFO() << "Start IdempotencyStore";
+}
+
+NApp::EIdempotencyKeyState TShardedIdempotencyStore::TryRemember(const TUserId& sender_id, std::string_view key) {
+  const auto snapshot = ConfigSource_.GetSnapshot();
+  const auto config = snapshot[kIdempotencyConfig];
+
+  if (!config.IsEnabled) {
+    return NApp::EIdempotencyKeyState::New;
+  }
+
+  auto [window, inserted] = Windows_.GetOrCreate(sender_id, [] { return std::make_shared<TDedupWindow>(); });
+  if (inserted) {
+    WindowsCounter_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  return window->TryRemember(key, userver::utils::datetime::SteadyNow(), config.Window, config.MaxKeysPerUser);
+}
+
+void TShardedIdempotencyStore::Complete(const TUserId& sender_id, std::string_view key) {
+  if (auto window = Windows_.Get(sender_id)) {
+    window->Complete(key);
+  }
+}
+
+void TShardedIdempotencyStore::Forget(const TUserId& sender_id, std::string_view key) {
+  if (auto window = Windows_.Get(sender_id)) {
+    window->Forget(key);
+  }
+}
+
+void TShardedIdempotencyStore::TraverseKeys() {
+  const auto snapshot = ConfigSource_.GetSnapshot();
+  const auto window_duration = snapshot[kIdempotencyConfig].Window;
+
+  const auto now = userver::utils::datetime::SteadyNow();
+  std::size_t evicted_keys = 0;
+
+  auto is_expired = [now, window_duration, &evicted_keys](const std::shared_ptr<TDedupWindow>& window) {
+    evicted_keys += window->CleanExpired(now, window_duration);
+    return window->GetSize() == 0 && (now - window->GetLastAccess()) > window_duration;
+  };
+
+  auto metrics_cb = [&](const std::unordered_map<TUserId, std::shared_ptr<TDedupWindow>>& shard) {
+    Stats_.shard_size.Account(shard.size());
+  };
+
+  auto removed_amount = Windows_.CleanupAndCount(is_expired, metrics_cb);
+
+  const auto old_value = WindowsCounter_.fetch_sub(removed_amount, std::memory_order_relaxed);
+  Stats_.active_amount = old_value - removed_amount;
+  Stats_.removed_total.Add({removed_amount});
+  Stats_.evicted_keys_total.Add({evicted_keys});
+
+  LOG_INFO() << fmt::format("Idempotency GC: removed {} windows, {} keys", removed_amount, evicted_keys);
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "infra/messaging/idempotency/metrics/idempotency_stats.hpp"
+
+#include <app/services/message/idempotency_store.hpp>
+
+#include <infra/concurrency/sharded_map/sharded_map.hpp>
+
+#include <userver/dynamic_config/source.hpp>
+#include <userver/engine/mutex.hpp>
+
+#include <chrono>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace NChat::NInfra {
+
+struct TStringViewHash {
+  using is_transparent = void;
+
+  std::size_t operator()(std::string_view value) const noexcept {
+    return std::hash<std::string_view>{}(value);
+  }
+};
+
+// Окно дедупликации одного отправителя: ключ -> момент первого появления и исход отправки
+class TDedupWindow {
+ public:
+  using TTimePoint = std::chrono::steady_clock::time_point;
+  using TDuration = std::chrono::steady_clock::duration;
+
+  TDedupWindow();
+
+  // Новый ключ запоминается ожидающим
+  NApp::EIdempotencyKeyState TryRemember(std::string_view key, TTimePoint now, TDuration window,
+                                         std::size_t max_keys);
+  void Complete(std::string_view key);
+  void Forget(std::string_view key);
+
+  // Возвращает количество удаленных ключей
+  std::size_t CleanExpired(TTimePoint now, TDuration window);
+
+  std::size_t GetSize() const;
+  TTimePoint GetLastAccess() const;
+
+ private:
+  std::size_t EvictExpired(TTimePoint deadline);
+  bool EvictOldest();
+
+ private:
+  struct TKeyEntry {
+    TTimePoint FirstSeen;
+    bool IsPending = true;
+  };
+
+  mutable userver::engine::Mutex Mutex_;
+  std::unordered_map<std::string, TKeyEntry, TStringViewHash, std::equal_to<>> Keys_;
+  // Порядок вставки; записи удаленных через Forget пропускаются при вытеснении
+  std::deque<std::pair<TTimePoint, std::string>> Order_;
+  std::atomic<TTimePoint> LastAccess_;
+};
+
+class TShardedIdempotencyStore : public NApp::IIdempotencyStore {
+ public:
+  using TUserId = NCore::NDomain::TUserId;
+  using TShardedMap = NConcurrency::TShardedMap<TUserId, TDedupWindow>;
+
+  TShardedIdempotencyStore(std::size_t shard_amount, userver::dynamic_config::Source config_source,
+                           TIdempotencyStatistics& stats);
+
+  NApp::EIdempotencyKeyState TryRemember(const TUserId& sender_id, std::string_view key) override;
+  void Complete(const TUserId& sender_id, std::string_view key) override;
+  void Forget(const TUserId& sender_id, std::string_view key) override;
+  void TraverseKeys() override;
+
+ private:
+  TShardedMap Windows_;
+  std::atomic<int64_t> WindowsCounter_{0};
+  userver::dynamic_config::Source ConfigSource_;
+  TIdempotencyStatistics& Stats_;
+};
+
+}  // namespace NChat::NInfra
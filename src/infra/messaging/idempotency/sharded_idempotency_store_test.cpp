@@ -0,0 +1,200 @@
+#include "sharded_idempotency_store.hpp"
+
+#include <core/common/ids.hpp>
+
+#include <gtest/gtest.h>
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/mock_now.hpp>
+
+using namespace NChat::NInfra;
+using namespace NChat::NCore::NDomain;
+using NChat::NApp::EIdempotencyKeyState;
+
+namespace {
+
+// Окно с завершенной отправкой по ключу: повторы считаются дубликатами
+bool RememberCompleted(TDedupWindow& window, std::string_view key, std::chrono::steady_clock::time_point now,
+                       std::chrono::steady_clock::duration duration, std::size_t max_keys) {
+  if (window.TryRemember(key, now, duration, max_keys) != EIdempotencyKeyState::New) {
+    return false;
+  }
+  window.Complete(key);
+  return true;
+}
+
+}  // namespace
+
+// ============================================================================
+// TDedupWindow Tests
+// ============================================================================
+
+UTEST(DedupWindowTest, DuplicateRejected) {
+  TDedupWindow window;
+  const auto now = std::chrono::steady_clock::now();
+
+  EXPECT_TRUE(RememberCompleted(window, "key-1", now, std::chrono::seconds(10), 16));
+  EXPECT_FALSE(RememberCompleted(window, "key-1", now, std::chrono::seconds(10), 16));
+  EXPECT_TRUE(RememberCompleted(window, "key-2", now, std::chrono::seconds(10), 16));
+  EXPECT_EQ(window.GetSize(), 2);
+}
+
+UTEST(DedupWindowTest, PendingUntilCompleted) {
+  TDedupWindow window;
+  const auto now = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(window.TryRemember("key", now, std::chrono::seconds(10), 16), EIdempotencyKeyState::New);
+  EXPECT_EQ(window.TryRemember("key", now, std::chrono::seconds(10), 16), EIdempotencyKeyState::Pending);
+
+  window.Complete("key");
+  EXPECT_EQ(window.TryRemember("key", now, std::chrono::seconds(10), 16), EIdempotencyKeyState::Completed);
+}
+
+UTEST(DedupWindowTest, ForgetPendingAllowsRetry) {
+  TDedupWindow window;
+  const auto now = std::chrono::steady_clock::now();
+
+  // Исходный запрос упал: конкурентный повтор получил Pending, следующий повтор отправляет заново
+  EXPECT_EQ(window.TryRemember("key", now, std::chrono::seconds(10), 16), EIdempotencyKeyState::New);
+  EXPECT_EQ(window.TryRemember("key", now, std::chrono::seconds(10), 16), EIdempotencyKeyState::Pending);
+  window.Forget("key");
+  EXPECT_EQ(window.TryRemember("key", now, std::chrono::seconds(10), 16), EIdempotencyKeyState::New);
+}
+
+UTEST(DedupWindowTest, KeyExpires) {
+  TDedupWindow window;
+  const auto now = std::chrono::steady_clock::now();
+
+  EXPECT_TRUE(RememberCompleted(window, "key", now, std::chrono::seconds(10), 16));
+  EXPECT_FALSE(RememberCompleted(window, "key", now + std::chrono::seconds(5), std::chrono::seconds(10), 16));
+  EXPECT_TRUE(RememberCompleted(window, "key", now + std::chrono::seconds(11), std::chrono::seconds(10), 16));
+}
+
+UTEST(DedupWindowTest, ForgetAllowsRetry) {
+  TDedupWindow window;
+  const auto now = std::chrono::steady_clock::now();
+
+  EXPECT_TRUE(RememberCompleted(window, "key", now, std::chrono::seconds(10), 16));
+  window.Forget("key");
+  EXPECT_TRUE(RememberCompleted(window, "key", now + std::chrono::seconds(1), std::chrono::seconds(10), 16));
+
+  // Stale order entry of the forgotten key must not evict the new one
+  EXPECT_EQ(window.CleanExpired(now + std::chrono::seconds(10) + std::chrono::milliseconds(500),
+                                std::chrono::seconds(10)),
+            0);
+  EXPECT_FALSE(RememberCompleted(window, "key", now + std::chrono::milliseconds(10600), std::chrono::seconds(10), 16));
+}
+
+UTEST(DedupWindowTest, CapacityEvictsOldest) {
+  TDedupWindow window;
+  const auto now = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(
+        RememberCompleted(window, std::to_string(i), now + std::chrono::milliseconds(i), std::chrono::hours(1), 3));
+  }
+
+  EXPECT_TRUE(RememberCompleted(window, "3", now + std::chrono::milliseconds(3), std::chrono::hours(1), 3));
+  EXPECT_EQ(window.GetSize(), 3);
+
+  // "0" was evicted, the rest are still deduplicated
+  EXPECT_FALSE(RememberCompleted(window, "2", now + std::chrono::milliseconds(4), std::chrono::hours(1), 3));
+  EXPECT_TRUE(RememberCompleted(window, "0", now + std::chrono::milliseconds(5), std::chrono::hours(1), 3));
+}
+
+UTEST(DedupWindowTest, CleanExpired) {
+  TDedupWindow window;
+  const auto now = std::chrono::steady_clock::now();
+
+  EXPECT_TRUE(RememberCompleted(window, "old", now, std::chrono::seconds(10), 16));
+  EXPECT_TRUE(RememberCompleted(window, "new", now + std::chrono::seconds(8), std::chrono::seconds(10), 16));
+
+  EXPECT_EQ(window.CleanExpired(now + std::chrono::seconds(12), std::chrono::seconds(10)), 1);
+  EXPECT_EQ(window.GetSize(), 1);
+}
+
+// ============================================================================
+// TShardedIdempotencyStore Tests
+// ============================================================================
+
+class TShardedIdempotencyStoreTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Store = std::make_unique<TShardedIdempotencyStore>(16, userver::dynamic_config::GetDefaultSource(), Stats);
+  }
+
+  bool RememberCompleted(const TUserId& sender_id, std::string_view key) {
+    if (Store->TryRemember(sender_id, key) != EIdempotencyKeyState::New) {
+      return false;
+    }
+    Store->Complete(sender_id, key);
+    return true;
+  }
+
+  TIdempotencyStatistics Stats{};
+  std::unique_ptr<NChat::NApp::IIdempotencyStore> Store;
+};
+
+UTEST_F(TShardedIdempotencyStoreTest, PerSenderKeys) {
+  TUserId user1("1");
+  TUserId user2("2");
+
+  EXPECT_TRUE(RememberCompleted(user1, "key"));
+  EXPECT_FALSE(RememberCompleted(user1, "key"));
+
+  // Same key from another sender is independent
+  EXPECT_TRUE(RememberCompleted(user2, "key"));
+}
+
+UTEST_F(TShardedIdempotencyStoreTest, ForgetUnknownSender) {
+  Store->Forget(TUserId("unknown"), "key");
+  EXPECT_TRUE(RememberCompleted(TUserId("unknown"), "key"));
+}
+
+UTEST_F(TShardedIdempotencyStoreTest, TraverseRemovesExpiredWindows) {
+  userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000"));
+  TUserId user1("1");
+  TUserId user2("2");
+
+  EXPECT_TRUE(RememberCompleted(user1, "key"));
+  EXPECT_TRUE(RememberCompleted(user2, "key"));
+
+  // Default window is 60 seconds
+  userver::utils::datetime::MockSleep(std::chrono::seconds(40));
+  EXPECT_TRUE(RememberCompleted(user1, "another"));
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(30));
+  Store->TraverseKeys();
+
+  EXPECT_EQ(Stats.active_amount.load(), 1);
+  EXPECT_EQ(Stats.removed_total.Load().value, 1);
+
+  EXPECT_TRUE(RememberCompleted(user1, "key"));
+  EXPECT_FALSE(RememberCompleted(user1, "another"));
+}
+
+UTEST_F_MT(TShardedIdempotencyStoreTest, ConcurrentSameKey, 4) {
+  const auto concurrent_jobs = GetThreadCount();
+  TUserId user("1");
+  std::atomic<int> accepted{0};
+
+  std::vector<userver::engine::TaskWithResult<void>> tasks;
+  tasks.reserve(concurrent_jobs);
+
+  for (std::size_t i = 0; i < concurrent_jobs; ++i) {
+    tasks.push_back(userver::engine::AsyncNoSpan([&]() {
+      for (int j = 0; j < 100; ++j) {
+        if (Store->TryRemember(user, std::to_string(j)) == EIdempotencyKeyState::New) {
+          ++accepted;
+        }
+      }
+    }));
+  }
+
+  for (auto& task : tasks) {
+    task.Get();
+  }
+
+  EXPECT_EQ(accepted.load(), 100);
+}
@@ -0,0 +1,136 @@
+#include "atomic_limiter.hpp"
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/datetime.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace NChat::NInfra {
+
+namespace {
+constexpr std::uint64_t kMillisInSecond = 1000;
+constexpr std::size_t kMaxCapacity = std::numeric_limits<std::uint16_t>::max();
+// Tells a used slot from an empty one even with 0 tokens refilled at the start instant
+constexpr std::uint64_t kUsedBit = std::uint64_t{1} << 63;
+}  // namespace
+
+TAtomicLimiter::TAtomicLimiter(std::size_t slots_amount, const TConfigCache& config_cache, TLimiterStatistics& stats)
+    : Slots_(std::make_unique<std::atomic<std::uint64_t>[]>(slots_amount)),
+      SlotsMask_(slots_amount - 1),
+      Start_(userver::utils::datetime::SteadyNow()),
+      ConfigCache_(config_cache),
+      Stats_(stats) {
+  if (slots_amount == 0 || (slots_amount & (slots_amount - 1)) != 0) {
+    throw std::invalid_argument("Slots amount must be a degree of 2");
+  }
+
+  LOG_INFO() << "Start AtomicLimiter with " << slots_amount << " slots";
+}
+
+bool TAtomicLimiter::TryAcquire(const TUserId& user_id) {
+  return TryAcquireN(user_id, 1) == 1;
+}
+
+std::size_t TAtomicLimiter::TryAcquireN(const TUserId& user_id, std::size_t count) {
+  const auto config = ConfigCache_.GetLimiterConfig();
+
+  if (!config.IsEnabled || count == 0) {
+    return count;
+  }
+
+  const auto hash = std::hash<TUserId>{}(user_id);
+  auto& slot = Slots_[hash & SlotsMask_];
+  const auto capacity = static_cast<std::uint16_t>(std::min(config.MaxRps, kMaxCapacity));
+  const auto now = GetNowMs();
+
+  auto current = slot.load(std::memory_order_relaxed);
+
+  while (true) {
+    // The bucket is shared by every user hashed to this slot
+    auto state = Refill(current, now, capacity, config.TokenRefillAmount);
+    const auto acquired = std::min<std::size_t>(state.Tokens, count);
+    state.Tokens -= static_cast<std::uint16_t>(acquired);
+
+    if (slot.compare_exchange_weak(current, Pack(state), std::memory_order_acq_rel, std::memory_order_relaxed)) {
+      if (acquired < count) {
+        Stats_.rejected_total.Add({count - acquired});
+      }
+      return acquired;
+    }
+  }
+}
+
+void TAtomicLimiter::TraverseLimiters() {
+  const auto config = ConfigCache_.GetLimiterConfig();
+
+  const auto capacity = static_cast<std::uint16_t>(std::min(config.MaxRps, kMaxCapacity));
+  const auto now = GetNowMs();
+
+  std::int64_t active = 0;
+  for (std::size_t i = 0; i <= SlotsMask_; ++i) {
+    const auto word = Slots_[i].load(std::memory_order_relaxed);
+    if (word != 0 && Refill(word, now, capacity, config.TokenRefillAmount).Tokens < capacity) {
+      ++active;
+    }
+  }
+
+  ActiveCounter_.store(active, std::memory_order_relaxed);
+  Stats_.active_amount = active;
+
+  LOG_INFO() << fmt::format("Atomic limiter: {} active buckets", active);
+}
+
+std::int64_t TAtomicLimiter::GetTotalLimiters() const {
+  return ActiveCounter_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t TAtomicLimiter::Pack(TBucketState state) {
+  return kUsedBit | (static_cast<std::uint64_t>(state.Tokens) << 32) | state.LastRefill;
+}
+
+TAtomicLimiter::TBucketState TAtomicLimiter::Unpack(std::uint64_t word) {
+  return {.Tokens = static_cast<std::uint16_t>(word >> 32),
+          .LastRefill = static_cast<std::uint32_t>(word)};
+}
+
+TAtomicLimiter::TBucketState TAtomicLimiter::Refill(std::uint64_t word, std::uint32_t now, std::uint16_t capacity,
+                                                    std::size_t refill_per_second) {
+  if (word == 0) {
+    return {.Tokens = capacity, .LastRefill = now};
+  }
+
+  auto state = Unpack(word);
+  state.Tokens = std::min(state.Tokens, capacity);  // Config might have been lowered
+
+  if (refill_per_second == 0) {
+    return state;
+  }
+
+  // Modular arithmetic survives the 32-bit wrap (~49 days)
+  const std::uint64_t elapsed = static_cast<std::uint32_t>(now - state.LastRefill);
+  const auto refill = elapsed * refill_per_second / kMillisInSecond;
+
+  if (refill == 0) {
+    return state;
+  }
+
+  if (state.Tokens + refill >= capacity) {
+    state.Tokens = capacity;
+    state.LastRefill = now;
+  } else {
+    state.Tokens += static_cast<std::uint16_t>(refill);
+    // Keep the remainder of partially accumulated token
+    state.LastRefill += static_cast<std::uint32_t>(refill * kMillisInSecond / refill_per_second);
+  }
+
+  return state;
+}
+
+std::uint32_t TAtomicLimiter::GetNowMs() const {
+  const auto elapsed = userver::utils::datetime::SteadyNow() - Start_;
+  return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "infra/messaging/limiter/metrics/limiter_stats.hpp"
+
+#include <app/services/message/send_limiter.hpp>
+
+#include <infra/config/config_cache.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace NChat::NInfra {
+
+/*
+Token bucket limiter without per-user heap objects.
+Fixed-size hashed array of packed words: | used:1 | unused:15 | tokens:16 | last_refill_ms:32 |, updated with CAS.
+A slot has no owner: users whose ids hash to one slot share its bucket and its budget. A slot of an idle user
+refills to full, so the next user in it starts with a full bucket and no GC is needed.
+The array must be sized well above the online amount, or colliding active users throttle each other.
+*/
+class TAtomicLimiter : public NApp::ISendLimiter {
+ public:
+  using TUserId = NCore::NDomain::TUserId;
+  using TTimePoint = std::chrono::steady_clock::time_point;
+
+  TAtomicLimiter(std::size_t slots_amount, const TConfigCache& config_cache, TLimiterStatistics& stats);
+
+  bool TryAcquire(const TUserId& user_id) override;
+  std::size_t TryAcquireN(const TUserId& user_id, std::size_t count) override;
+
+  // Only collects metrics: idle slots are reused in place
+  void TraverseLimiters() override;
+  std::int64_t GetTotalLimiters() const override;
+
+ private:
+  struct TBucketState {
+    std::uint16_t Tokens = 0;
+    std::uint32_t LastRefill = 0;
+  };
+
+  static std::uint64_t Pack(TBucketState state);
+  static TBucketState Unpack(std::uint64_t word);
+  static TBucketState Refill(std::uint64_t word, std::uint32_t now, std::uint16_t capacity,
+                             std::size_t refill_per_second);
+
+  std::uint32_t GetNowMs() const;
+
+ private:
+  std::unique_ptr<std::atomic<std::uint64_t>[]> Slots_;
+  const std::size_t SlotsMask_;
+  const TTimePoint Start_;
+
+  std::atomic<int64_t> ActiveCounter_{0};
+  const TConfigCache& ConfigCache_;
+  TLimiterStatistics& Stats_;
+};
+
+}  // namespace NChat::NInfra
@@ -12,6 +12,10 @@ class TDummyLimiter : public NApp::ISendLimiter {
     return true;
   }
 
+  std::size_t TryAcquireN(const TUserId&, std::size_t count) override {
+    return count;
+  }
+
   void TraverseLimiters() override {
     return;
   }
@@ -0,0 +1,192 @@
+#include <infra/messaging/limiter/atomic_limiter.hpp>
+#include <infra/messaging/limiter/sharded_limiter.hpp>
+
+#include <benchmark/benchmark.h>
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace NChat::NCore::NDomain;
+using namespace NChat::NInfra;
+
+namespace {
+
+constexpr std::size_t kUsersAmount = 10'000;
+
+enum class ELimiterType { ShardedMap, AtomicArray };
+
+std::unique_ptr<NChat::NApp::ISendLimiter> MakeLimiter(ELimiterType type, const TConfigCache& config_cache,
+                                                       TLimiterStatistics& stats) {
+  if (type == ELimiterType::ShardedMap) {
+    return std::make_unique<TSendLimiter>(256, config_cache, stats);
+  }
+  return std::make_unique<TAtomicLimiter>(1 << 16, config_cache, stats);
+}
+
+std::vector<TUserId> MakeUsers() {
+  std::vector<TUserId> users;
+  users.reserve(kUsersAmount);
+  for (std::size_t i = 0; i < kUsersAmount; ++i) {
+    users.emplace_back("user_" + std::to_string(i));
+  }
+  return users;
+}
+
+// Все потоки бьют в лимитеры разных пользователей, range(0) — число потоков
+void RunDistinctUsers(benchmark::State& state, ELimiterType type) {
+  const std::size_t num_threads = state.range(0);
+
+  userver::engine::RunStandalone(num_threads, [&]() {
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
+    TLimiterStatistics stats{};
+    auto limiter = MakeLimiter(type, config_cache, stats);
+    const auto users = MakeUsers();
+
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> total_ops{0};
+
+    std::vector<userver::engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i + 1 < num_threads; ++i) {
+      tasks.push_back(userver::engine::AsyncNoSpan([&, i]() {
+        std::size_t local_ops = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+          benchmark::DoNotOptimize(limiter->TryAcquire(users[(local_ops * 31 + i) % kUsersAmount]));
+          ++local_ops;
+        }
+        total_ops.fetch_add(local_ops, std::memory_order_relaxed);
+      }));
+    }
+
+    std::size_t idx = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(limiter->TryAcquire(users[idx++ % kUsersAmount]));
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& task : tasks) {
+      task.Get();
+    }
+
+    state.SetItemsProcessed(state.iterations() + total_ops.load());
+  });
+}
+
+// Один горячий пользователь: конкуренция за один бакет
+void RunHotUser(benchmark::State& state, ELimiterType type) {
+  const std::size_t num_threads = state.range(0);
+
+  userver::engine::RunStandalone(num_threads, [&]() {
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
+    TLimiterStatistics stats{};
+    auto limiter = MakeLimiter(type, config_cache, stats);
+    const TUserId hot_user{"hot_user"};
+
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> total_ops{0};
+
+    std::vector<userver::engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i + 1 < num_threads; ++i) {
+      tasks.push_back(userver::engine::AsyncNoSpan([&]() {
+        std::size_t local_ops = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+          benchmark::DoNotOptimize(limiter->TryAcquire(hot_user));
+          ++local_ops;
+        }
+        total_ops.fetch_add(local_ops, std::memory_order_relaxed);
+      }));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(limiter->TryAcquire(hot_user));
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& task : tasks) {
+      task.Get();
+    }
+
+    state.SetItemsProcessed(state.iterations() + total_ops.load());
+  });
+}
+
+// Чтение конфига лимитера на горячем пути всеми потоками
+template <typename TMakeReader>
+void RunConfigReads(benchmark::State& state, TMakeReader make_reader) {
+  const std::size_t num_threads = state.range(0);
+
+  userver::engine::RunStandalone(num_threads, [&]() {
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
+    auto read_config = make_reader(config_cache);
+
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> total_ops{0};
+
+    std::vector<userver::engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i + 1 < num_threads; ++i) {
+      tasks.push_back(userver::engine::AsyncNoSpan([&]() {
+        std::size_t local_ops = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+          benchmark::DoNotOptimize(read_config());
+          ++local_ops;
+        }
+        total_ops.fetch_add(local_ops, std::memory_order_relaxed);
+      }));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(read_config());
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& task : tasks) {
+      task.Get();
+    }
+
+    state.SetItemsProcessed(state.iterations() + total_ops.load());
+  });
+}
+
+}  // namespace
+
+// Как было: снапшот на каждый запрос
+void BM_LimiterConfig_Snapshot(benchmark::State& state) {
+  RunConfigReads(state, [](const TConfigCache& /*config_cache*/) {
+    return []() {
+      const auto snapshot = userver::dynamic_config::GetDefaultSource().GetSnapshot();
+      return snapshot[kLimiterConfig].MaxRps;
+    };
+  });
+}
+BENCHMARK(BM_LimiterConfig_Snapshot)->Arg(1)->Arg(8)->Arg(32);
+
+// Как стало: значения из TConfigCache
+void BM_LimiterConfig_Cache(benchmark::State& state) {
+  RunConfigReads(state, [](const TConfigCache& config_cache) {
+    return [&config_cache]() { return config_cache.GetLimiterConfig().MaxRps; };
+  });
+}
+BENCHMARK(BM_LimiterConfig_Cache)->Arg(1)->Arg(8)->Arg(32);
+
+void BM_Limiter_ShardedMap_DistinctUsers(benchmark::State& state) {
+  RunDistinctUsers(state, ELimiterType::ShardedMap);
+}
+BENCHMARK(BM_Limiter_ShardedMap_DistinctUsers)->Arg(1)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+
+void BM_Limiter_AtomicArray_DistinctUsers(benchmark::State& state) {
+  RunDistinctUsers(state, ELimiterType::AtomicArray);
+}
+BENCHMARK(BM_Limiter_AtomicArray_DistinctUsers)->Arg(1)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+
+void BM_Limiter_ShardedMap_HotUser(benchmark::State& state) {
+  RunHotUser(state, ELimiterType::ShardedMap);
+}
+BENCHMARK(BM_Limiter_ShardedMap_HotUser)->Arg(1)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+
+void BM_Limiter_AtomicArray_HotUser(benchmark::State& state) {
+  RunHotUser(state, ELimiterType::AtomicArray);
+}
+BENCHMARK(BM_Limiter_AtomicArray_HotUser)->Arg(1)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
@@ -1,7 +1,5 @@
 #include "sharded_limiter.hpp"
 
-#include <infra/messaging/limiter/config/limiter_config.hpp>
-
 #include <userver/logging/log.hpp>
 
 namespace NChat::NInfra {
@@ -20,6 +18,21 @@ bool TLimiterWrapper::TryAcquire() {
   return Bucket_.Obtain();
 }
 
+std::size_t TLimiterWrapper::TryAcquireN(std::size_t count) {
+  LastAccess_.store(userver::utils::datetime::SteadyNow(), std::memory_order_relaxed);
+
+  if (Bucket_.ObtainAll(count)) {
+    return count;
+  }
+
+  std::size_t acquired = 0;
+  while (acquired < count && Bucket_.Obtain()) {
+    ++acquired;
+  }
+
+  return acquired;
+}
+
 TLimiterWrapper::TTimePoint TLimiterWrapper::GetLastAccess() const {
   return LastAccess_.load(std::memory_order_relaxed);
 }
@@ -28,29 +41,33 @@ TLimiterWrapper::TTokenBucket& TLimiterWrapper::GetBucket() {
   return Bucket_;
 }
 
-TSendLimiter::TSendLimiter(std::size_t shard_amount, userver::dynamic_config::Source config_source,
-                           TLimiterStatistics& stats)
-    : Limiters_(shard_amount), ConfigSource_(std::move(config_source)), Stats_(stats) {
+TSendLimiter::TSendLimiter(std::size_t shard_amount, const TConfigCache& config_cache, TLimiterStatistics& stats)
+    : Limiters_(shard_amount), ConfigCache_(config_cache), Stats_(stats) {
   LOG_INFO() << "Start SendLimiterRegistry";
 }
 
+TLimiterPtr TSendLimiter::GetOrCreateLimiter(const TUserId& user_id, const TLimiterConfig& config) {
+  const auto token_refill_amount = config.TokenRefillAmount;
+  const auto max_rps = config.MaxRps;
+
+  auto limiter_factory = [token_refill_amount, max_rps]() {
+    return std::make_shared<TLimiterWrapper>(max_rps, token_refill_amount);
+  };
+
+  auto [limiter, inserted] = Limiters_.GetOrCreate(user_id, limiter_factory);
+  if (inserted) {
+    LimiterCounter_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  return limiter;
+}
+
 bool TSendLimiter::TryAcquire(const TUserId& user_id) {
-  const auto snapshot = ConfigSource_.GetSnapshot();
-  auto config = snapshot[kLimiterConfig];
+  const auto config = ConfigCache_.GetLimiterConfig();
   const auto is_enabled = config.IsEnabled;
 
   if (is_enabled) {
-    const auto token_refill_amount = config.TokenRefillAmount;
-    const auto max_rps = config.MaxRps;
-
-    auto limiter_factory = [token_refill_amount, max_rps]() {
-      return std::make_shared<TLimiterWrapper>(max_rps, token_refill_amount);
-    };
-
-    auto [limiter, inserted] = Limiters_.GetOrCreate(user_id, limiter_factory);
-    if (inserted) {
-      LimiterCounter_.fetch_add(1, std::memory_order_relaxed);
-    }
+    auto limiter = GetOrCreateLimiter(user_id, config);
 
     if (!limiter->TryAcquire()) {
       ++Stats_.rejected_total;
@@ -61,9 +78,25 @@ bool TSendLimiter::TryAcquire(const TUserId& user_id) {
   return true;
 }
 
+std::size_t TSendLimiter::TryAcquireN(const TUserId& user_id, std::size_t count) {
+  const auto config = ConfigCache_.GetLimiterConfig();
+
+  if (!config.IsEnabled || count == 0) {
+    return count;
+  }
+
+  auto limiter = GetOrCreateLimiter(user_id, config);
+  const auto acquired = limiter->TryAcquireN(count);
+
+  if (acquired < count) {
+    Stats_.rejected_total.Add({count - acquired});
+  }
+
+  return acquired;
+}
+
 void TSendLimiter::TraverseLimiters() {
-  const auto snapshot = ConfigSource_.GetSnapshot();
-  auto config = snapshot[kLimiterConfig];
+  const auto config = ConfigCache_.GetLimiterConfig();
   const auto idle_timeout = config.IdleTimeout;
 
   const auto now = userver::utils::datetime::SteadyNow();
@@ -5,8 +5,8 @@
 #include <app/services/message/send_limiter.hpp>
 
 #include <infra/concurrency/sharded_map/sharded_map.hpp>
+#include <infra/config/config_cache.hpp>
 
-#include <userver/dynamic_config/source.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/token_bucket.hpp>
 
@@ -25,6 +25,7 @@ class TLimiterWrapper {
                   TDuration token_refill_interval = std::chrono::seconds(1));
 
   bool TryAcquire();
+  std::size_t TryAcquireN(std::size_t count);
 
   TTokenBucket& GetBucket();
   TTimePoint GetLastAccess() const;
@@ -41,16 +42,19 @@ class TSendLimiter : public NApp::ISendLimiter {
   using TUserId = NCore::NDomain::TUserId;
   using TShardedMap = NConcurrency::TShardedMap<TUserId, TLimiterWrapper>;
 
-  explicit TSendLimiter(std::size_t shard_amount, userver::dynamic_config::Source config_source,
-                        TLimiterStatistics& stats);
+  TSendLimiter(std::size_t shard_amount, const TConfigCache& config_cache, TLimiterStatistics& stats);
   bool TryAcquire(const TUserId& user_id) override;
+  std::size_t TryAcquireN(const TUserId& user_id, std::size_t count) override;
   void TraverseLimiters() override;
   std::int64_t GetTotalLimiters() const override;
 
+ private:
+  TLimiterPtr GetOrCreateLimiter(const TUserId& user_id, const TLimiterConfig& config);
+
  private:
   TShardedMap Limiters_;
   std::atomic<int64_t> LimiterCounter_{0};
-  userver::dynamic_config::Source ConfigSource_;
+  const TConfigCache& ConfigCache_;
   TLimiterStatistics& Stats_;
 };
 
@@ -1,3 +1,4 @@
+#include "atomic_limiter.hpp"
 #include "sharded_limiter.hpp"
 
 #include <core/common/ids.hpp>
@@ -82,6 +83,15 @@ UTEST(LimiterWrapperTest, MultipleRefills) {
   EXPECT_FALSE(limiter.TryAcquire());
 }
 
+UTEST(LimiterWrapperTest, TryAcquireNPartial) {
+  TLimiterWrapper limiter(3, 1, std::chrono::seconds(1));
+
+  EXPECT_EQ(limiter.TryAcquireN(2), 2);
+  // Only one token left
+  EXPECT_EQ(limiter.TryAcquireN(5), 1);
+  EXPECT_EQ(limiter.TryAcquireN(1), 0);
+}
+
 // ============================================================================
 // TSendLimiter Tests
 // ============================================================================
@@ -89,9 +99,10 @@ UTEST(LimiterWrapperTest, MultipleRefills) {
 class TSendLimiterTest : public ::testing::Test {
  protected:
   void SetUp() override {
-    Limiter = std::make_unique<TSendLimiter>(256, userver::dynamic_config::GetDefaultSource(), Stats);
+    Limiter = std::make_unique<TSendLimiter>(256, ConfigCache, Stats);
   }
 
+  TConfigCache ConfigCache{userver::dynamic_config::GetDefaultSource()};
   TLimiterStatistics Stats{};
   std::unique_ptr<NChat::NApp::ISendLimiter> Limiter;
 };
@@ -133,6 +144,23 @@ UTEST_F(TSendLimiterTest, MultipleUsersIndependentLimits) {
   EXPECT_EQ(Limiter->GetTotalLimiters(), 2);
 }
 
+UTEST_F(TSendLimiterTest, TryAcquireNBulk) {
+  TUserId user_id("1");
+
+  // Default is 5 RPS: 3 tokens, then 2 of 4 requested, nothing left after
+  EXPECT_EQ(Limiter->TryAcquireN(user_id, 3), 3);
+  EXPECT_EQ(Limiter->TryAcquireN(user_id, 4), 2);
+  EXPECT_EQ(Limiter->TryAcquireN(user_id, 1), 0);
+  EXPECT_FALSE(Limiter->TryAcquire(user_id));
+
+  EXPECT_EQ(Limiter->GetTotalLimiters(), 1);
+  EXPECT_EQ(Stats.rejected_total.Load().value, 4);
+}
+
+UTEST_F(TSendLimiterTest, TryAcquireNZero) {
+  EXPECT_EQ(Limiter->TryAcquireN(TUserId("1"), 0), 0);
+}
+
 UTEST_F(TSendLimiterTest, LimiterCounterIncrement) {
   EXPECT_EQ(Limiter->GetTotalLimiters(), 0);
 
@@ -342,11 +370,11 @@ UTEST_F_MT(TSendLimiterTest, StressTest, 8) {
 
 UTEST_F(TSendLimiterTest, ZeroShards) {
   // Should handle edge case gracefully (though likely not recommended in practice)
-  EXPECT_THROW(TSendLimiter limiter(0, userver::dynamic_config::GetDefaultSource(), Stats), std::invalid_argument);
+  EXPECT_THROW(TSendLimiter limiter(0, ConfigCache, Stats), std::invalid_argument);
 }
 
 UTEST_F(TSendLimiterTest, SingleShard) {
-  TSendLimiter limiter(1, userver::dynamic_config::GetDefaultSource(), Stats);
+  TSendLimiter limiter(1, ConfigCache, Stats);
 
   limiter.TryAcquire(TUserId("1"));
   limiter.TryAcquire(TUserId("2"));
@@ -355,7 +383,7 @@ UTEST_F(TSendLimiterTest, SingleShard) {
 }
 
 UTEST_F(TSendLimiterTest, ManyShards) {
-  TSendLimiter limiter(1024, userver::dynamic_config::GetDefaultSource(), Stats);
+  TSendLimiter limiter(1024, ConfigCache, Stats);
 
   for (int i = 0; i < 100; ++i) {
     limiter.TryAcquire(TUserId(std::to_string(i)));
@@ -382,3 +410,185 @@ UTEST_F(TSendLimiterTest, RepeatedTraversal) {
   Limiter->TraverseLimiters();
   EXPECT_EQ(Limiter->GetTotalLimiters(), 1);
 }
+
+// ============================================================================
+// TAtomicLimiter Tests
+// ============================================================================
+
+class TAtomicLimiterTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000"));
+    Limiter = std::make_unique<TAtomicLimiter>(1 << 10, ConfigCache, Stats);
+  }
+
+  TConfigCache ConfigCache{userver::dynamic_config::GetDefaultSource()};
+  TLimiterStatistics Stats{};
+  std::unique_ptr<NChat::NApp::ISendLimiter> Limiter;
+};
+
+UTEST(AtomicLimiterConstruction, SlotsMustBePowerOfTwo) {
+  TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
+  TLimiterStatistics stats;
+  EXPECT_THROW(TAtomicLimiter(0, config_cache, stats), std::invalid_argument);
+  EXPECT_THROW(TAtomicLimiter(1000, config_cache, stats), std::invalid_argument);
+  EXPECT_NO_THROW(TAtomicLimiter(1024, config_cache, stats));
+}
+
+UTEST_F(TAtomicLimiterTest, SingleUserLimiting) {
+  TUserId user_id("1");
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(Limiter->TryAcquire(user_id));
+  }
+
+  EXPECT_FALSE(Limiter->TryAcquire(user_id));
+  EXPECT_EQ(Stats.rejected_total.Load().value, 1);
+}
+
+UTEST_F(TAtomicLimiterTest, MultipleUsersIndependentLimits) {
+  TUserId user1("1");
+  TUserId user2("2");
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(Limiter->TryAcquire(user1));
+  }
+  EXPECT_FALSE(Limiter->TryAcquire(user1));
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(Limiter->TryAcquire(user2));
+  }
+  EXPECT_FALSE(Limiter->TryAcquire(user2));
+}
+
+UTEST_F(TAtomicLimiterTest, TokenRefill) {
+  TUserId user_id("1");
+
+  for (int i = 0; i < 5; ++i) {
+    Limiter->TryAcquire(user_id);
+  }
+  EXPECT_FALSE(Limiter->TryAcquire(user_id));
+
+  userver::utils::datetime::MockSleep(std::chrono::milliseconds(500));
+  EXPECT_FALSE(Limiter->TryAcquire(user_id));
+
+  userver::utils::datetime::MockSleep(std::chrono::milliseconds(600));
+  EXPECT_TRUE(Limiter->TryAcquire(user_id));
+  EXPECT_FALSE(Limiter->TryAcquire(user_id));
+}
+
+UTEST_F(TAtomicLimiterTest, RefillIsCappedByMaxRps) {
+  TUserId user_id("1");
+
+  Limiter->TryAcquire(user_id);
+  userver::utils::datetime::MockSleep(std::chrono::hours(1));
+
+  EXPECT_EQ(Limiter->TryAcquireN(user_id, 10), 5);
+}
+
+UTEST_F(TAtomicLimiterTest, TryAcquireNBulk) {
+  TUserId user_id("1");
+
+  EXPECT_EQ(Limiter->TryAcquireN(user_id, 3), 3);
+  EXPECT_EQ(Limiter->TryAcquireN(user_id, 3), 2);
+  EXPECT_EQ(Limiter->TryAcquireN(user_id, 3), 0);
+  EXPECT_EQ(Limiter->TryAcquireN(user_id, 0), 0);
+  EXPECT_EQ(Stats.rejected_total.Load().value, 4);
+}
+
+UTEST_F(TAtomicLimiterTest, TraverseCountsOnlyNonFullBuckets) {
+  TUserId user1("1");
+  TUserId user2("2");
+
+  Limiter->TraverseLimiters();
+  EXPECT_EQ(Limiter->GetTotalLimiters(), 0);
+
+  Limiter->TryAcquireN(user1, 5);
+  Limiter->TryAcquire(user2);
+  Limiter->TraverseLimiters();
+  EXPECT_EQ(Limiter->GetTotalLimiters(), 2);
+
+  // user2 refilled its single token, user1 still lacks some
+  userver::utils::datetime::MockSleep(std::chrono::seconds(2));
+  Limiter->TraverseLimiters();
+  EXPECT_EQ(Limiter->GetTotalLimiters(), 1);
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(5));
+  Limiter->TraverseLimiters();
+  EXPECT_EQ(Limiter->GetTotalLimiters(), 0);
+}
+
+UTEST(AtomicLimiterCollision, CollidingUsersShareBudget) {
+  userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000"));
+  TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
+  TLimiterStatistics stats;
+  // Single slot: every user collides
+  TAtomicLimiter limiter(1, config_cache, stats);
+
+  TUserId user1("1");
+  TUserId user2("2");
+
+  // The bucket is not reset for another user: the second one gets only the rest
+  EXPECT_EQ(limiter.TryAcquireN(user1, 3), 3);
+  EXPECT_EQ(limiter.TryAcquireN(user2, 5), 2);
+  EXPECT_FALSE(limiter.TryAcquire(user1));
+
+  // An idle slot refills, so the next user starts with a full bucket
+  userver::utils::datetime::MockSleep(std::chrono::seconds(6));
+  EXPECT_EQ(limiter.TryAcquireN(user2, 5), 5);
+}
+
+UTEST_F_MT(TAtomicLimiterTest, ConcurrentSameUser, 4) {
+  const auto concurrent_jobs = GetThreadCount();
+  TUserId shared_user("42");
+
+  std::atomic<int> success_count{0};
+  std::vector<userver::engine::Task> tasks;
+  tasks.reserve(concurrent_jobs);
+
+  for (std::size_t thread_no = 0; thread_no < concurrent_jobs; ++thread_no) {
+    tasks.push_back(userver::engine::AsyncNoSpan([&]() {
+      constexpr std::size_t kIterations = 100;
+
+      for (std::size_t i = 0; i < kIterations; ++i) {
+        if (Limiter->TryAcquire(shared_user)) {
+          success_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        userver::engine::Yield();
+      }
+    }));
+  }
+
+  for (auto& task : tasks) {
+    task.Wait();
+  }
+
+  // Time is mocked, so CAS must not give out more than the bucket capacity
+  EXPECT_EQ(success_count.load(), 5);
+}
+
+UTEST_F_MT(TAtomicLimiterTest, ConcurrentDistinctUsers, 4) {
+  const auto concurrent_jobs = GetThreadCount();
+  constexpr std::size_t kUsersPerThread = 50;
+
+  std::atomic<std::size_t> success_count{0};
+  std::vector<userver::engine::Task> tasks;
+  tasks.reserve(concurrent_jobs);
+
+  for (std::size_t thread_no = 0; thread_no < concurrent_jobs; ++thread_no) {
+    tasks.push_back(userver::engine::AsyncNoSpan([&, thread_no]() {
+      for (std::size_t user_idx = 0; user_idx < kUsersPerThread; ++user_idx) {
+        TUserId user_id(std::to_string(thread_no * kUsersPerThread + user_idx));
+        success_count.fetch_add(Limiter->TryAcquireN(user_id, 10), std::memory_order_relaxed);
+      }
+    }));
+  }
+
+  for (auto& task : tasks) {
+    task.Wait();
+  }
+
+  // Collisions share a bucket, so the amount is bounded by the capacity of every user
+  EXPECT_LE(success_count.load(), concurrent_jobs * kUsersPerThread * 5);
+  EXPECT_GT(success_count.load(), 0);
+}
@@ -0,0 +1,14 @@
+#include "pipeline_config.hpp"
+
+#include <algorithm>
+
+namespace NChat::NInfra {
+
+TFanOutPipelineConfig Parse(const userver::formats::json::Value& value,
+                            userver::formats::parse::To<TFanOutPipelineConfig>) {
+  // Без очередей принимать сообщения некуда
+  return TFanOutPipelineConfig{std::max<std::size_t>(value["queues_amount"].As<std::size_t>(), 1),
+                               value["max_queue_size"].As<std::size_t>()};
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/dynamic_config/value.hpp>
+
+namespace NChat::NInfra {
+
+struct TFanOutPipelineConfig {
+  std::size_t QueuesAmount{8};
+  std::size_t MaxQueueSize{10000};
+};
+
+TFanOutPipelineConfig Parse(const userver::formats::json::Value& value,
+                            userver::formats::parse::To<TFanOutPipelineConfig>);
+
+const userver::dynamic_config::Key<TFanOutPipelineConfig> kFanOutPipelineConfig{
+    "FANOUT_PIPELINE_CONFIG", userver::dynamic_config::DefaultAsJsonString{R"(
+  {
+    "queues_amount": 8,
+    "max_queue_size": 10000
+  }
+)"}};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,29 @@
+#include "pipeline_stats.hpp"
+
+#include <userver/utils/statistics/writer.hpp>
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TFanOutStatistics& stats) {
+  writer["queues"]["amount"] = stats.queues_amount.load();
+  writer["pending"]["tasks"] = stats.pending_tasks.load();
+  writer["accepted"]["total"] = stats.accepted_total;
+  writer["rejected"]["total"] = stats.rejected_total;
+  writer["successful"]["total"] = stats.successful_total;
+  writer["dropped"]["overflow"]["total"] = stats.dropped_overflow_total;
+  writer["dropped"]["offline"]["total"] = stats.dropped_offline_total;
+  writer["forwarded"]["total"] = stats.forwarded_total;
+  writer["queue"]["lag"]["ms"]["hist"] = stats.queue_lag_ms_hist;
+  writer["batch"]["size"]["hist"] = stats.batch_size_hist;
+}
+
+void ResetMetric(TFanOutStatistics& stats) {
+  stats.accepted_total.Store({0});
+  stats.rejected_total.Store({0});
+  stats.successful_total.Store({0});
+  stats.dropped_overflow_total.Store({0});
+  stats.dropped_offline_total.Store({0});
+  stats.forwarded_total.Store({0});
+}
+
+}  // namespace NChat::NInfra
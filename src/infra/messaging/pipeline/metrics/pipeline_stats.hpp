@@ -0,0 +1,32 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace NChat::NInfra {
+
+struct TFanOutStatistics {
+  std::atomic<std::size_t> queues_amount{0};
+  std::atomic<std::int64_t> pending_tasks{0};
+  userver::utils::statistics::RateCounter accepted_total{0};
+  userver::utils::statistics::RateCounter rejected_total{0};
+  userver::utils::statistics::RateCounter successful_total{0};
+  userver::utils::statistics::RateCounter dropped_overflow_total{0};
+  userver::utils::statistics::RateCounter dropped_offline_total{0};
+  userver::utils::statistics::RateCounter forwarded_total{0};
+
+  userver::utils::statistics::Histogram queue_lag_ms_hist{{1, 2, 5, 10, 25, 50, 100, 250, 1000}};
+  userver::utils::statistics::Histogram batch_size_hist{{1, 5, 10, 25, 50, 100}};
+};
+
+inline const userver::utils::statistics::MetricTag<TFanOutStatistics> kFanOutTag{"chat_fanout"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TFanOutStatistics& stats);
+void ResetMetric(TFanOutStatistics& stats);
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,193 @@
+#include "worker_pipeline.hpp"
+
+#include <utils/hash/jump_hash.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/datetime.hpp>
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+
+namespace NChat::NInfra {
+
+TWorkerFanOutPipeline::TWorkerFanOutPipeline(NCore::IMailboxRegistry& registry, NCore::IRecentMessages* recent,
+                                             NCore::IMessageBus* bus, userver::dynamic_config::Source config_source,
+                                             TFanOutPipelineSettings settings, TFanOutStatistics& stats,
+                                             NApp::ISendBackpressure* backpressure)
+    : Router_(registry, recent, bus), Settings_(settings), Stats_(stats), Backpressure_(backpressure) {
+  ConfigSubscription_ =
+      config_source.UpdateAndListen(this, "chat-fanout-pipeline", &TWorkerFanOutPipeline::OnConfigUpdate);
+}
+
+TWorkerFanOutPipeline::~TWorkerFanOutPipeline() {
+  ConfigSubscription_.Unsubscribe();
+
+  // Воркеры текущих очередей запускает передача
+  if (Handoff_.IsValid()) {
+    Handoff_.Get();
+  }
+
+  // Принятые сообщения доставляются до конца: отправителю уже ответили 202
+  std::vector<std::unique_ptr<TWorker>> workers;
+  {
+    std::unique_lock lock(Mutex_);
+    Workers_.swap(workers);
+  }
+  StopWorkers(workers);
+}
+
+bool TWorkerFanOutPipeline::Submit(NCore::TRouteTask task) {
+  task.Message.Context.Enqueued = userver::utils::datetime::SteadyNow();
+  const auto key = std::hash<NCore::NDomain::TChatId>{}(task.Message.ChatId);
+
+  Stats_.pending_tasks.fetch_add(1, std::memory_order_relaxed);
+
+  bool accepted = false;
+  {
+    std::shared_lock lock(Mutex_);
+    auto& worker = *Workers_[NUtils::NHash::JumpConsistentHash(key, Workers_.size())];
+    accepted = worker.Producer->PushNoblock(std::move(task));
+  }
+
+  if (!accepted) {
+    Stats_.pending_tasks.fetch_sub(1, std::memory_order_relaxed);
+    ++Stats_.rejected_total;
+    return false;
+  }
+
+  ++Stats_.accepted_total;
+  return true;
+}
+
+void TWorkerFanOutPipeline::OnConfigUpdate(const userver::dynamic_config::Snapshot& config) {
+  const auto pipeline_config = config[kFanOutPipelineConfig];
+
+  // Набор очередей меняет только этот колбэк, читать Workers_ здесь можно без блокировки
+  if (pipeline_config.QueuesAmount != Workers_.size()) {
+    Rebuild(pipeline_config);
+    return;
+  }
+
+  for (auto& worker : Workers_) {
+    worker->Queue->SetSoftMaxSize(pipeline_config.MaxQueueSize);
+  }
+}
+
+void TWorkerFanOutPipeline::Rebuild(const TFanOutPipelineConfig& config) {
+  std::vector<std::unique_ptr<TWorker>> workers;
+  std::vector<TWorker*> new_workers;
+  workers.reserve(config.QueuesAmount);
+  new_workers.reserve(config.QueuesAmount);
+  for (std::size_t i = 0; i < config.QueuesAmount; ++i) {
+    workers.push_back(std::make_unique<TWorker>(config.MaxQueueSize));
+    new_workers.push_back(workers.back().get());
+  }
+
+  {
+    std::unique_lock lock(Mutex_);
+    Workers_.swap(workers);
+  }
+  Stats_.queues_amount = new_workers.size();
+
+  // Ожидание старых очередей не держит колбэк конфига: новые очереди уже принимают, их воркеры запустит передача
+  Handoff_ = userver::utils::CriticalAsync(
+      "fanout-handoff", [this, previous = std::move(Handoff_), old_workers = std::move(workers),
+                         new_workers = std::move(new_workers)]() mutable {
+        // Новые воркеры прошлой передачи - это старые воркеры этой
+        if (previous.IsValid()) {
+          previous.Get();
+        }
+        Handoff(std::move(old_workers), std::move(new_workers));
+      });
+}
+
+void TWorkerFanOutPipeline::Handoff(std::vector<std::unique_ptr<TWorker>> old_workers,
+                                    std::vector<TWorker*> new_workers) {
+  // Новые очереди уже копят сообщения, но читать их можно только после старых, иначе переехавший чат
+  // обгонит собственную очередь
+  StopWorkers(old_workers);
+
+  for (auto* worker : new_workers) {
+    worker->Task = userver::utils::CriticalAsync("fanout-worker", &TWorkerFanOutPipeline::Run, this,
+                                                 worker->Queue->GetConsumer());
+  }
+
+  LOG_INFO() << fmt::format("Fan-out pipeline queues: {} -> {}", old_workers.size(), new_workers.size());
+}
+
+void TWorkerFanOutPipeline::StopWorkers(std::vector<std::unique_ptr<TWorker>>& workers) {
+  for (auto& worker : workers) {
+    worker->Producer.reset();
+  }
+
+  for (auto& worker : workers) {
+    if (worker->Task.IsValid()) {
+      worker->Task.Get();
+    }
+  }
+}
+
+void TWorkerFanOutPipeline::Run(TQueue::Consumer consumer) {
+  std::vector<NCore::TRouteTask> batch;
+  batch.reserve(Settings_.MaxBatchSize);
+  NCore::TRouteTask task;
+
+  // Pop возвращает false, только когда очередь закрыта и пуста
+  while (consumer.Pop(task)) {
+    batch.push_back(std::move(task));
+
+    while (batch.size() < Settings_.MaxBatchSize && consumer.PopNoblock(task)) {
+      batch.push_back(std::move(task));
+    }
+
+    Route(batch);
+    batch.clear();
+  }
+}
+
+void TWorkerFanOutPipeline::Route(std::vector<NCore::TRouteTask>& batch) {
+  const auto now = userver::utils::datetime::SteadyNow();
+  for (const auto& task : batch) {
+    Stats_.queue_lag_ms_hist.Account(
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - task.Message.Context.Enqueued).count());
+  }
+  Stats_.batch_size_hist.Account(batch.size());
+  Stats_.pending_tasks.fetch_sub(batch.size(), std::memory_order_relaxed);
+
+  // Пачка уходит в маршрутизатор целиком, id чатов нужны для обратной связи отправителям
+  std::vector<NCore::NDomain::TChatId> chat_ids;
+  if (Backpressure_) {
+    chat_ids.reserve(batch.size());
+    for (const auto& task : batch) {
+      chat_ids.push_back(task.Message.ChatId);
+    }
+  }
+
+  const auto batch_size = batch.size();
+
+  try {
+    const auto statuses = Router_.RouteBatch(std::move(batch));
+
+    for (std::size_t i = 0; i < statuses.size(); ++i) {
+      const auto& status = statuses[i];
+      Stats_.successful_total.Add({status.Successful});
+      Stats_.dropped_overflow_total.Add({status.Dropped});
+      Stats_.dropped_offline_total.Add({status.Offline});
+      Stats_.forwarded_total.Add({status.Forwarded});
+
+      if (Backpressure_) {
+        Backpressure_->Report(chat_ids[i], status);
+      }
+    }
+  } catch (const std::exception& ex) {
+    // Воркер должен жить дальше: за ним очередь всех чатов этого шарда
+    LOG_ERROR() << "Fan-out of " << batch_size << " messages failed: " << ex.what();
+  }
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <core/messaging/pipeline/fanout_pipeline.hpp>
+#include <core/messaging/router/message_router.hpp>
+
+#include <app/services/message/send_backpressure.hpp>
+
+#include <infra/messaging/pipeline/config/pipeline_config.hpp>
+#include <infra/messaging/pipeline/metrics/pipeline_stats.hpp>
+
+#include <userver/concurrent/async_event_source.hpp>
+#include <userver/concurrent/mpsc_queue.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace NChat::NInfra {
+
+struct TFanOutPipelineSettings {
+  std::size_t MaxBatchSize = 100;
+};
+
+/*
+N MPSC queues, one worker coroutine per queue. A chat is pinned to a queue by jump consistent hash of its id,
+so all messages of the chat are routed by one worker in the order they were accepted.
+The amount of queues comes from FANOUT_PIPELINE_CONFIG. On change the new queues start accepting at once,
+but their workers start only after the old queues are drained, so a chat that moved keeps its FIFO order.
+The drain-then-start handoff runs in a background task: the config callback only swaps the queues.
+Handoffs are chained, each one waits for the previous before draining the queues it replaced.
+*/
+class TWorkerFanOutPipeline final : public NCore::IFanOutPipeline {
+ public:
+  // backpressure может быть nullptr: итоги доставки не возвращаются отправителям
+  TWorkerFanOutPipeline(NCore::IMailboxRegistry& registry, NCore::IRecentMessages* recent, NCore::IMessageBus* bus,
+                        userver::dynamic_config::Source config_source, TFanOutPipelineSettings settings,
+                        TFanOutStatistics& stats, NApp::ISendBackpressure* backpressure = nullptr);
+  ~TWorkerFanOutPipeline();
+
+  bool Submit(NCore::TRouteTask task) override;
+
+ private:
+  using TQueue = userver::concurrent::MpscQueue<NCore::TRouteTask>;
+
+  struct TWorker {
+    explicit TWorker(std::size_t max_size) : Queue(TQueue::Create(max_size)), Producer(Queue->GetMultiProducer()) {
+    }
+
+    std::shared_ptr<TQueue> Queue;
+    // Сброс последнего продюсера закрывает очередь: воркер дочитывает ее и завершается
+    std::optional<TQueue::MultiProducer> Producer;
+    userver::engine::TaskWithResult<void> Task;
+  };
+
+  void OnConfigUpdate(const userver::dynamic_config::Snapshot& config);
+  void Rebuild(const TFanOutPipelineConfig& config);
+  void Handoff(std::vector<std::unique_ptr<TWorker>> old_workers, std::vector<TWorker*> new_workers);
+  void StopWorkers(std::vector<std::unique_ptr<TWorker>>& workers);
+
+  void Run(TQueue::Consumer consumer);
+  void Route(std::vector<NCore::TRouteTask>& batch);
+
+ private:
+  NCore::TMessageRouter Router_;
+  const TFanOutPipelineSettings Settings_;
+  TFanOutStatistics& Stats_;
+  NApp::ISendBackpressure* Backpressure_;
+
+  // Submit берет shared-блокировку, смена набора очередей - эксклюзивную
+  userver::engine::SharedMutex Mutex_;
+  std::vector<std::unique_ptr<TWorker>> Workers_;
+
+  // Последняя передача очередей; меняется только колбэком конфига
+  userver::engine::TaskWithResult<void> Handoff_;
+
+  // Must be the last: callback rebuilds the workers above
+  userver::concurrent::AsyncEventSubscriberScope ConfigSubscription_;
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,154 @@
+#include "worker_pipeline.hpp"
+
+#include <core/messaging/mocks.hpp>
+
+#include <gmock/gmock.h>
+#include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <map>
+
+using namespace NChat::NInfra;
+using NChat::NCore::TRouteTask;
+using NChat::NCore::TSendStatus;
+using NChat::NCore::NDomain::TChatId;
+using NChat::NCore::NDomain::TUserId;
+using ::testing::ElementsAreArray;
+using ::testing::NiceMock;
+
+namespace {
+
+const TUserId kRecipient{"recipient"};
+
+TRouteTask MakeTask(const std::string& chat_id, std::size_t index) {
+  return {{kRecipient}, CreateTestMessage("sender", chat_id, std::to_string(index))};
+}
+
+std::vector<std::string> MakeRange(std::size_t size) {
+  std::vector<std::string> range;
+  for (std::size_t i = 0; i < size; ++i) {
+    range.push_back(std::to_string(i));
+  }
+  return range;
+}
+
+}  // namespace
+
+class TWorkerFanOutPipelineTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Получатель на другом узле: порядок доставки виден по вызовам шины. Yield перемешивает воркеров
+    ON_CALL(Bus, Forward(_)).WillByDefault([this](std::vector<TRouteTask> batch) {
+      std::vector<TSendStatus> statuses;
+      for (const auto& task : batch) {
+        Delivered[task.Message.ChatId.GetUnderlying()].push_back(task.Message.Payload->Text.Value());
+        statuses.push_back({.Forwarded = task.Recipients.size()});
+      }
+      userver::engine::Yield();
+      return statuses;
+    });
+  }
+
+  std::unique_ptr<TWorkerFanOutPipeline> MakePipeline() {
+    return std::make_unique<TWorkerFanOutPipeline>(Registry, nullptr, &Bus, Storage.GetSource(),
+                                                   TFanOutPipelineSettings{.MaxBatchSize = 3}, Stats);
+  }
+
+  void SetConfig(std::size_t queues_amount, std::size_t max_queue_size) {
+    Storage.Extend({{kFanOutPipelineConfig,
+                     TFanOutPipelineConfig{.QueuesAmount = queues_amount, .MaxQueueSize = max_queue_size}}});
+  }
+
+  userver::dynamic_config::StorageMock Storage{
+      userver::dynamic_config::GetDefaultDocsMap(),
+      {{kFanOutPipelineConfig, TFanOutPipelineConfig{.QueuesAmount = 4, .MaxQueueSize = 1000}}}};
+  NiceMock<MockMailboxRegistry> Registry;
+  NiceMock<MockMessageBus> Bus;
+  TFanOutStatistics Stats;
+
+  // Воркеры пишут в одном потоке utest, блокировка не нужна
+  std::map<std::string, std::vector<std::string>> Delivered;
+};
+
+UTEST_F(TWorkerFanOutPipelineTest, ChatKeepsFifoOrder) {
+  constexpr std::size_t kMessagesAmount = 50;
+  const std::vector<std::string> chats{"pc:a", "pc:b", "pc:c", "pc:d", "pc:e", "pc:f"};
+
+  auto pipeline = MakePipeline();
+  for (std::size_t i = 0; i < kMessagesAmount; ++i) {
+    for (const auto& chat : chats) {
+      ASSERT_TRUE(pipeline->Submit(MakeTask(chat, i)));
+    }
+    // Воркеры разбирают очереди вперемешку с отправкой
+    userver::engine::Yield();
+  }
+  pipeline.reset();
+
+  ASSERT_EQ(Delivered.size(), chats.size());
+  for (const auto& chat : chats) {
+    EXPECT_THAT(Delivered[chat], ElementsAreArray(MakeRange(kMessagesAmount))) << chat;
+  }
+  EXPECT_EQ(Stats.accepted_total.Load().value, kMessagesAmount * chats.size());
+  EXPECT_EQ(Stats.pending_tasks.load(), 0);
+}
+
+UTEST_F(TWorkerFanOutPipelineTest, ResizeKeepsChatOrder) {
+  constexpr std::size_t kMessagesAmount = 30;
+  // Из одной очереди в пять: хотя бы часть чатов переезжает в другую очередь
+  const std::vector<std::string> chats{"pc:a", "pc:b", "pc:c", "pc:d", "pc:e", "pc:f", "pc:g", "pc:h"};
+  SetConfig(1, 1000);
+
+  auto pipeline = MakePipeline();
+  for (std::size_t i = 0; i < kMessagesAmount; ++i) {
+    for (const auto& chat : chats) {
+      ASSERT_TRUE(pipeline->Submit(MakeTask(chat, i)));
+    }
+  }
+
+  // Колбэк только меняет очереди: старая очередь еще не разобрана, а новые уже принимают
+  SetConfig(5, 1000);
+  EXPECT_EQ(Stats.queues_amount.load(), 5);
+  EXPECT_TRUE(Delivered.empty());
+
+  for (std::size_t i = kMessagesAmount; i < 2 * kMessagesAmount; ++i) {
+    for (const auto& chat : chats) {
+      ASSERT_TRUE(pipeline->Submit(MakeTask(chat, i)));
+    }
+    userver::engine::Yield();
+  }
+
+  // Следующая смена, пока предыдущая передача может быть не закончена
+  SetConfig(2, 1000);
+  for (std::size_t i = 2 * kMessagesAmount; i < 3 * kMessagesAmount; ++i) {
+    for (const auto& chat : chats) {
+      ASSERT_TRUE(pipeline->Submit(MakeTask(chat, i)));
+    }
+  }
+  pipeline.reset();
+
+  for (const auto& chat : chats) {
+    EXPECT_THAT(Delivered[chat], ElementsAreArray(MakeRange(3 * kMessagesAmount))) << chat;
+  }
+}
+
+UTEST_F(TWorkerFanOutPipelineTest, FullQueueRejectsSubmit) {
+  constexpr std::size_t kMaxQueueSize = 3;
+  SetConfig(1, kMaxQueueSize);
+
+  // Воркер запускается в фоне и до первого yield очередь не разбирает
+  auto pipeline = MakePipeline();
+  for (std::size_t i = 0; i < kMaxQueueSize; ++i) {
+    EXPECT_TRUE(pipeline->Submit(MakeTask("pc:a", i)));
+  }
+
+  // Отказ превращается в 429 у отправителя, сообщение не доставляется
+  EXPECT_FALSE(pipeline->Submit(MakeTask("pc:a", kMaxQueueSize)));
+  EXPECT_EQ(Stats.rejected_total.Load().value, 1);
+  EXPECT_EQ(Stats.pending_tasks.load(), static_cast<std::int64_t>(kMaxQueueSize));
+
+  pipeline.reset();
+
+  EXPECT_THAT(Delivered["pc:a"], ElementsAreArray(MakeRange(kMaxQueueSize)));
+}
@@ -0,0 +1,60 @@
+#include "in_memory_presence_store.hpp"
+
+#include <userver/utils/datetime.hpp>
+
+#include <mutex>
+
+namespace NChat::NInfra {
+
+void TInMemoryPresenceStore::Upsert(const NCore::NDomain::TNodeId& node_id,
+                                    const std::vector<NCore::NDomain::TUserId>& users, std::chrono::seconds ttl) {
+  const auto now = userver::utils::datetime::Now();
+  const auto expires_at = now + ttl;
+
+  std::lock_guard lock(Mutex_);
+  for (const auto& user : users) {
+    auto& leases = Leases_[user];
+    std::erase_if(leases, [&](const TLease& lease) { return lease.NodeId == node_id || lease.ExpiresAt <= now; });
+    leases.push_back(TLease{.NodeId = node_id, .ExpiresAt = expires_at});
+  }
+}
+
+void TInMemoryPresenceStore::Revoke(const NCore::NDomain::TNodeId& node_id,
+                                    const std::vector<NCore::NDomain::TUserId>& users) {
+  std::lock_guard lock(Mutex_);
+  for (const auto& user : users) {
+    auto it = Leases_.find(user);
+    if (it == Leases_.end()) {
+      continue;
+    }
+
+    std::erase_if(it->second, [&](const TLease& lease) { return lease.NodeId == node_id; });
+    if (it->second.empty()) {
+      Leases_.erase(it);
+    }
+  }
+}
+
+std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> TInMemoryPresenceStore::Lookup(
+    const std::vector<NCore::NDomain::TUserId>& users) const {
+  const auto now = userver::utils::datetime::Now();
+  std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> nodes;
+
+  std::lock_guard lock(Mutex_);
+  for (const auto& user : users) {
+    auto it = Leases_.find(user);
+    if (it == Leases_.end()) {
+      continue;
+    }
+
+    for (const auto& lease : it->second) {
+      if (lease.ExpiresAt > now) {
+        nodes[user].push_back(lease.NodeId);
+      }
+    }
+  }
+
+  return nodes;
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <core/messaging/presence/presence.hpp>
+
+#include <userver/engine/mutex.hpp>
+
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+namespace NChat::NInfra {
+
+// Аренды в памяти процесса: для тестов и одного узла, другим экземплярам сервиса не видны
+class TInMemoryPresenceStore final : public NCore::IPresenceStore {
+ public:
+  void Upsert(const NCore::NDomain::TNodeId& node_id, const std::vector<NCore::NDomain::TUserId>& users,
+              std::chrono::seconds ttl) override;
+  void Revoke(const NCore::NDomain::TNodeId& node_id, const std::vector<NCore::NDomain::TUserId>& users) override;
+  std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> Lookup(
+      const std::vector<NCore::NDomain::TUserId>& users) const override;
+
+ private:
+  struct TLease {
+    NCore::NDomain::TNodeId NodeId;
+    std::chrono::system_clock::time_point ExpiresAt;
+  };
+
+  mutable userver::engine::Mutex Mutex_;
+  // Аренды пользователя по одной на узел, узлов обычно один-два
+  std::unordered_map<NCore::NDomain::TUserId, std::vector<TLease>> Leases_;
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,83 @@
+#include "in_memory_presence_store.hpp"
+
+#include <gmock/gmock.h>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+using namespace NChat::NInfra;
+using NChat::NCore::NDomain::TNodeId;
+using NChat::NCore::NDomain::TUserId;
+
+namespace {
+const auto kNow = userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000");
+}  // namespace
+
+UTEST(InMemoryPresenceStore, LookupReturnsOnlyKnownUsers) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TInMemoryPresenceStore store;
+
+  store.Upsert(TNodeId{"node-1"}, {TUserId{"alice"}}, std::chrono::seconds(60));
+  store.Upsert(TNodeId{"node-2"}, {TUserId{"bob"}}, std::chrono::seconds(60));
+
+  auto nodes = store.Lookup({TUserId{"alice"}, TUserId{"bob"}, TUserId{"carol"}});
+
+  ASSERT_EQ(nodes.size(), 2);
+  EXPECT_EQ(nodes.at(TUserId{"alice"}), std::vector{TNodeId{"node-1"}});
+  EXPECT_EQ(nodes.at(TUserId{"bob"}), std::vector{TNodeId{"node-2"}});
+}
+
+UTEST(InMemoryPresenceStore, UserHoldsLeasePerNode) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TInMemoryPresenceStore store;
+
+  // Два устройства на разных узлах: аренда второго не отбирает аренду первого
+  store.Upsert(TNodeId{"node-1"}, {TUserId{"alice"}}, std::chrono::seconds(60));
+  store.Upsert(TNodeId{"node-2"}, {TUserId{"alice"}}, std::chrono::seconds(60));
+
+  auto nodes = store.Lookup({TUserId{"alice"}});
+  ASSERT_EQ(nodes.size(), 1);
+  EXPECT_THAT(nodes.at(TUserId{"alice"}), testing::UnorderedElementsAre(TNodeId{"node-1"}, TNodeId{"node-2"}));
+
+  store.Revoke(TNodeId{"node-1"}, {TUserId{"alice"}});
+
+  nodes = store.Lookup({TUserId{"alice"}});
+  ASSERT_EQ(nodes.size(), 1);
+  EXPECT_EQ(nodes.at(TUserId{"alice"}), std::vector{TNodeId{"node-2"}});
+
+  store.Revoke(TNodeId{"node-2"}, {TUserId{"alice"}});
+  EXPECT_TRUE(store.Lookup({TUserId{"alice"}}).empty());
+}
+
+UTEST(InMemoryPresenceStore, RenewExtendsOnlyOwnLease) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TInMemoryPresenceStore store;
+
+  store.Upsert(TNodeId{"node-1"}, {TUserId{"alice"}}, std::chrono::seconds(60));
+  store.Upsert(TNodeId{"node-2"}, {TUserId{"alice"}}, std::chrono::seconds(60));
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(30));
+  store.Upsert(TNodeId{"node-2"}, {TUserId{"alice"}}, std::chrono::seconds(60));
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(31));
+  auto nodes = store.Lookup({TUserId{"alice"}});
+
+  ASSERT_EQ(nodes.size(), 1);
+  EXPECT_EQ(nodes.at(TUserId{"alice"}), std::vector{TNodeId{"node-2"}});
+}
+
+UTEST(InMemoryPresenceStore, LeaseExpiresWithoutRenew) {
+  userver::utils::datetime::MockNowSet(kNow);
+  TInMemoryPresenceStore store;
+
+  store.Upsert(TNodeId{"node-1"}, {TUserId{"alice"}, TUserId{"bob"}}, std::chrono::seconds(60));
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(30));
+  store.Upsert(TNodeId{"node-1"}, {TUserId{"bob"}}, std::chrono::seconds(60));
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(31));
+  auto nodes = store.Lookup({TUserId{"alice"}, TUserId{"bob"}});
+
+  ASSERT_EQ(nodes.size(), 1);
+  EXPECT_TRUE(nodes.contains(TUserId{"bob"}));
+}
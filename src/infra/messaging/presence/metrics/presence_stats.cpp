@@ -0,0 +1,25 @@
+#include "presence_stats.hpp"
+
+#include <userver/utils/statistics/writer.hpp>
+
+namespace NChat::NInfra {
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TPresenceStatistics& stats) {
+  writer["published"]["total"] = stats.published_total;
+  writer["revoked"]["total"] = stats.revoked_total;
+  writer["renewed"]["total"] = stats.renewed_total;
+  writer["cache"]["hits"]["total"] = stats.cache_hits_total;
+  writer["cache"]["misses"]["total"] = stats.cache_misses_total;
+  writer["store"]["errors"]["total"] = stats.store_errors_total;
+}
+
+void ResetMetric(TPresenceStatistics& stats) {
+  stats.published_total.Store({0});
+  stats.revoked_total.Store({0});
+  stats.renewed_total.Store({0});
+  stats.cache_hits_total.Store({0});
+  stats.cache_misses_total.Store({0});
+  stats.store_errors_total.Store({0});
+}
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/metric_tag.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+namespace NChat::NInfra {
+
+struct TPresenceStatistics {
+  userver::utils::statistics::RateCounter published_total{0};
+  userver::utils::statistics::RateCounter revoked_total{0};
+  userver::utils::statistics::RateCounter renewed_total{0};
+  userver::utils::statistics::RateCounter cache_hits_total{0};
+  userver::utils::statistics::RateCounter cache_misses_total{0};
+  userver::utils::statistics::RateCounter store_errors_total{0};
+};
+
+inline const userver::utils::statistics::MetricTag<TPresenceStatistics> kPresenceTag{"chat_presence"};
+
+void DumpMetric(userver::utils::statistics::Writer& writer, const TPresenceStatistics& stats);
+void ResetMetric(TPresenceStatistics& stats);
+
+}  // namespace NChat::NInfra
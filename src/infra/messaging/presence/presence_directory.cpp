@@ -0,0 +1,211 @@
+#include "presence_directory.hpp"
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/datetime.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+
+namespace NChat::NInfra {
+
+TPresenceDirectory::TPresenceDirectory(NCore::IPresenceStore& store, TPresenceSettings settings,
+                                       TPresenceStatistics& stats)
+    : Store_(store), Settings_(std::move(settings)), Stats_(stats) {
+  if (Settings_.CacheShardsAmount == 0 || Settings_.BatchSize == 0) {
+    throw std::invalid_argument("Presence directory needs at least one cache shard and a non-empty batch");
+  }
+
+  Shards_.reserve(Settings_.CacheShardsAmount);
+  for (std::size_t i = 0; i < Settings_.CacheShardsAmount; ++i) {
+    Shards_.push_back(
+        std::make_unique<TCacheShard>(std::max<std::size_t>(Settings_.CacheSize / Settings_.CacheShardsAmount, 1)));
+  }
+
+  Task_ = userver::utils::CriticalAsync("presence-publisher", [this] { Run(); });
+}
+
+TPresenceDirectory::~TPresenceDirectory() {
+  IsStopping_.store(true);
+  FlushRequested_.Send();
+  Task_.Get();
+}
+
+void TPresenceDirectory::Publish(const NCore::NDomain::TUserId& user_id) {
+  std::lock_guard lock(PendingMutex_);
+  PendingRevoke_.erase(user_id);
+  PendingPublish_.insert(user_id);
+}
+
+void TPresenceDirectory::Revoke(std::vector<NCore::NDomain::TUserId> users) {
+  std::lock_guard lock(PendingMutex_);
+  for (auto& user : users) {
+    PendingPublish_.erase(user);
+    PendingRevoke_.insert(std::move(user));
+  }
+}
+
+void TPresenceDirectory::Renew(std::vector<NCore::NDomain::TUserId> users) {
+  // Продлеваются только аренды, у которых осталось меньше трети срока, и те, что не удалось записать
+  const auto renew_before = userver::utils::datetime::SteadyNow() + Settings_.LeaseTtl / 3;
+  {
+    std::lock_guard lock(LeasesMutex_);
+    std::erase_if(users, [&](const NCore::NDomain::TUserId& user) {
+      auto it = LeaseDeadlines_.find(user);
+      return it != LeaseDeadlines_.end() && it->second > renew_before;
+    });
+  }
+
+  if (users.empty()) {
+    return;
+  }
+
+  Upsert(users);
+  Stats_.renewed_total.Add({users.size()});
+}
+
+std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> TPresenceDirectory::Locate(
+    const std::vector<NCore::NDomain::TUserId>& users) const {
+  std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> nodes;
+  std::unordered_set<NCore::NDomain::TUserId> misses;
+
+  const auto now = userver::utils::datetime::SteadyNow();
+
+  auto add_remote = [this, &nodes](const NCore::NDomain::TUserId& user,
+                                   const std::vector<NCore::NDomain::TNodeId>& user_nodes) {
+    for (const auto& node : user_nodes) {
+      // Аренда на себя: локальные сессии получают сообщение напрямую, а не через шину
+      if (node != Settings_.NodeId) {
+        nodes[user].push_back(node);
+      }
+    }
+  };
+
+  for (const auto& user : users) {
+    if (nodes.contains(user) || misses.contains(user)) {
+      continue;
+    }
+
+    auto& shard = GetShard(user);
+    std::lock_guard lock(shard.Mutex);
+
+    const auto* cached = shard.Locations.Get(user);
+    if (!cached || cached->ExpiresAt <= now) {
+      misses.insert(user);
+      continue;
+    }
+
+    ++Stats_.cache_hits_total;
+    add_remote(user, cached->Nodes);
+  }
+
+  if (misses.empty()) {
+    return nodes;
+  }
+
+  Stats_.cache_misses_total.Add({misses.size()});
+
+  std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> found;
+  try {
+    found = Store_.Lookup({misses.begin(), misses.end()});
+  } catch (const std::exception& ex) {
+    // Без ответа хранилища получатели считаются офлайн, в кэш ничего не попадает
+    LOG_WARNING() << "Presence lookup of " << misses.size() << " users failed: " << ex.what();
+    ++Stats_.store_errors_total;
+    return nodes;
+  }
+
+  const auto expires_at = now + Settings_.CacheTtl;
+
+  for (const auto& user : misses) {
+    std::vector<NCore::NDomain::TNodeId> user_nodes;
+    if (auto it = found.find(user); it != found.end()) {
+      user_nodes = std::move(it->second);
+      add_remote(user, user_nodes);
+    }
+
+    auto& shard = GetShard(user);
+    std::lock_guard lock(shard.Mutex);
+    shard.Locations.Put(user, TCachedLocation{.Nodes = std::move(user_nodes), .ExpiresAt = expires_at});
+  }
+
+  return nodes;
+}
+
+void TPresenceDirectory::Flush() {
+  std::unordered_set<NCore::NDomain::TUserId> publish;
+  std::unordered_set<NCore::NDomain::TUserId> revoke;
+  {
+    std::lock_guard lock(PendingMutex_);
+    publish.swap(PendingPublish_);
+    revoke.swap(PendingRevoke_);
+  }
+
+  if (!publish.empty()) {
+    Upsert({publish.begin(), publish.end()});
+    Stats_.published_total.Add({publish.size()});
+  }
+
+  if (revoke.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard lock(LeasesMutex_);
+    for (const auto& user : revoke) {
+      LeaseDeadlines_.erase(user);
+    }
+  }
+
+  const std::vector<NCore::NDomain::TUserId> users(revoke.begin(), revoke.end());
+  for (std::size_t offset = 0; offset < users.size(); offset += Settings_.BatchSize) {
+    const auto end = users.begin() + std::min(offset + Settings_.BatchSize, users.size());
+
+    try {
+      Store_.Revoke(Settings_.NodeId, {users.begin() + offset, end});
+    } catch (const std::exception& ex) {
+      // Не отозванная аренда истечет сама через LeaseTtl
+      LOG_WARNING() << "Presence revoke failed: " << ex.what();
+      ++Stats_.store_errors_total;
+    }
+  }
+  Stats_.revoked_total.Add({users.size()});
+}
+
+void TPresenceDirectory::Run() {
+  while (!IsStopping_.load()) {
+    [[maybe_unused]] const auto requested = FlushRequested_.WaitForEventFor(Settings_.PublishInterval);
+    Flush();
+  }
+}
+
+void TPresenceDirectory::Upsert(const std::vector<NCore::NDomain::TUserId>& users) {
+  for (std::size_t offset = 0; offset < users.size(); offset += Settings_.BatchSize) {
+    const auto end = users.begin() + std::min(offset + Settings_.BatchSize, users.size());
+
+    // Срок считается от момента до записи: в хранилище аренда истечет не раньше
+    const auto deadline = userver::utils::datetime::SteadyNow() + Settings_.LeaseTtl;
+
+    try {
+      Store_.Upsert(Settings_.NodeId, {users.begin() + offset, end}, Settings_.LeaseTtl);
+    } catch (const std::exception& ex) {
+      // Без записанного срока следующая чистка реестра повторит публикацию
+      LOG_WARNING() << "Presence publish failed: " << ex.what();
+      ++Stats_.store_errors_total;
+      continue;
+    }
+
+    std::lock_guard lock(LeasesMutex_);
+    for (auto it = users.begin() + offset; it != end; ++it) {
+      LeaseDeadlines_.insert_or_assign(*it, deadline);
+    }
+  }
+}
+
+TPresenceDirectory::TCacheShard& TPresenceDirectory::GetShard(const NCore::NDomain::TUserId& user_id) const {
+  return *Shards_[std::hash<NCore::NDomain::TUserId>{}(user_id) % Shards_.size()];
+}
+
+}  // namespace NChat::NInfra
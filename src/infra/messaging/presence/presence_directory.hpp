@@ -0,0 +1,97 @@
+#pragma once
+
+#include <core/messaging/bus/node_locator.hpp>
+#include <core/messaging/presence/presence.hpp>
+
+#include <infra/messaging/presence/metrics/presence_stats.hpp>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace NChat::NInfra {
+
+struct TPresenceSettings {
+  NCore::NDomain::TNodeId NodeId;
+  std::chrono::seconds LeaseTtl{60};
+  std::chrono::milliseconds CacheTtl{2000};
+  std::size_t CacheSize = 100'000;
+  std::size_t CacheShardsAmount = 64;
+  std::chrono::milliseconds PublishInterval{100};
+  std::size_t BatchSize = 1000;
+};
+
+/*
+Presence directory of the cluster on top of a shared lease store.
+Mailbox creation and removal only mark the user as pending; a background task publishes and revokes
+leases in batches every PublishInterval. The registry traversal reports live mailboxes, but a lease is
+written again only when less than a third of LeaseTtl is left, so a lease of a crashed node expires after
+LeaseTtl without a store write per user on every pass. A user may hold leases on several nodes.
+Lookups of remote users are cached per user for CacheTtl, negative answers included, so routing
+a message costs a hash lookup, not a store round trip.
+*/
+class TPresenceDirectory final : public NCore::IPresencePublisher, public NCore::INodeLocator {
+ public:
+  TPresenceDirectory(NCore::IPresenceStore& store, TPresenceSettings settings, TPresenceStatistics& stats);
+  ~TPresenceDirectory();
+
+  void Publish(const NCore::NDomain::TUserId& user_id) override;
+  void Revoke(std::vector<NCore::NDomain::TUserId> users) override;
+  void Renew(std::vector<NCore::NDomain::TUserId> users) override;
+
+  std::unordered_map<NCore::NDomain::TUserId, std::vector<NCore::NDomain::TNodeId>> Locate(
+      const std::vector<NCore::NDomain::TUserId>& users) const override;
+
+  // Публикует накопленное немедленно, для остановки и тестов
+  void Flush();
+
+ private:
+  using TTimePoint = std::chrono::steady_clock::time_point;
+
+  struct TCachedLocation {
+    // Пусто - пользователь нигде не онлайн
+    std::vector<NCore::NDomain::TNodeId> Nodes;
+    TTimePoint ExpiresAt;
+  };
+
+  struct TCacheShard {
+    explicit TCacheShard(std::size_t max_users) : Locations(max_users) {
+    }
+
+    userver::engine::Mutex Mutex;
+    userver::cache::LruMap<NCore::NDomain::TUserId, TCachedLocation> Locations;
+  };
+
+  void Run();
+  void Upsert(const std::vector<NCore::NDomain::TUserId>& users);
+  TCacheShard& GetShard(const NCore::NDomain::TUserId& user_id) const;
+
+ private:
+  NCore::IPresenceStore& Store_;
+  const TPresenceSettings Settings_;
+  TPresenceStatistics& Stats_;
+
+  std::vector<std::unique_ptr<TCacheShard>> Shards_;
+
+  userver::engine::Mutex PendingMutex_;
+  std::unordered_set<NCore::NDomain::TUserId> PendingPublish_;
+  std::unordered_set<NCore::NDomain::TUserId> PendingRevoke_;
+
+  // Когда истекают записанные этим узлом аренды, по локальным часам
+  userver::engine::Mutex LeasesMutex_;
+  std::unordered_map<NCore::NDomain::TUserId, TTimePoint> LeaseDeadlines_;
+
+  userver::engine::SingleConsumerEvent FlushRequested_;
+  std::atomic_bool IsStopping_{false};
+  userver::engine::TaskWithResult<void> Task_;
+};
+
+}  // namespace NChat::NInfra
@@ -0,0 +1,186 @@
+#include "presence_directory.hpp"
+
+#include <core/messaging/mocks.hpp>
+
+#include <gmock/gmock.h>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+using namespace NChat::NInfra;
+using NChat::NCore::NDomain::TNodeId;
+using NChat::NCore::NDomain::TUserId;
+using ::testing::ElementsAre;
+using ::testing::SizeIs;
+using ::testing::StrictMock;
+using ::testing::UnorderedElementsAre;
+
+namespace {
+
+const auto kNow = userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000");
+const TNodeId kSelf{"node-1"};
+const TNodeId kOther{"node-2"};
+
+TPresenceSettings MakeSettings() {
+  // Фоновая публикация не срабатывает сама, тесты вызывают Flush явно
+  return TPresenceSettings{.NodeId = kSelf,
+                           .LeaseTtl = std::chrono::seconds(60),
+                           .CacheTtl = std::chrono::milliseconds(2000),
+                           .CacheSize = 100,
+                           .CacheShardsAmount = 4,
+                           .PublishInterval = std::chrono::hours(1),
+                           .BatchSize = 2};
+}
+
+}  // namespace
+
+class TPresenceDirectoryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    userver::utils::datetime::MockNowSet(kNow);
+    Directory = std::make_unique<TPresenceDirectory>(Store, MakeSettings(), Stats);
+  }
+
+  void TearDown() override {
+    Directory.reset();
+    userver::utils::datetime::MockNowUnset();
+  }
+
+  StrictMock<MockPresenceStore> Store;
+  TPresenceStatistics Stats;
+  std::unique_ptr<TPresenceDirectory> Directory;
+};
+
+UTEST_F(TPresenceDirectoryTest, LocationIsCachedForCacheTtl) {
+  const TUserId alice{"alice"};
+  std::unordered_map<TUserId, std::vector<TNodeId>> found{{alice, {kOther}}};
+
+  EXPECT_CALL(Store, Lookup(ElementsAre(alice))).Times(2).WillRepeatedly(Return(found));
+
+  EXPECT_THAT(Directory->Locate({alice}).at(alice), ElementsAre(kOther));
+  EXPECT_THAT(Directory->Locate({alice}).at(alice), ElementsAre(kOther));
+
+  userver::utils::datetime::MockSleep(std::chrono::milliseconds(2001));
+  EXPECT_THAT(Directory->Locate({alice}).at(alice), ElementsAre(kOther));
+}
+
+UTEST_F(TPresenceDirectoryTest, AbsenceIsCachedToo) {
+  const TUserId alice{"alice"};
+
+  EXPECT_CALL(Store, Lookup(ElementsAre(alice))).WillOnce(Return(std::unordered_map<TUserId, std::vector<TNodeId>>{}));
+
+  EXPECT_TRUE(Directory->Locate({alice}).empty());
+  EXPECT_TRUE(Directory->Locate({alice}).empty());
+}
+
+UTEST_F(TPresenceDirectoryTest, OwnNodeIsSkipped) {
+  const TUserId alice{"alice"};
+  const TUserId bob{"bob"};
+  std::unordered_map<TUserId, std::vector<TNodeId>> found{{alice, {kSelf, kOther}}, {bob, {kSelf}}};
+
+  EXPECT_CALL(Store, Lookup(UnorderedElementsAre(alice, bob))).WillOnce(Return(found));
+
+  // Свои сессии получают сообщение без шины, а пользователь только на этом узле не удаленный вовсе
+  auto nodes = Directory->Locate({alice, bob, alice});
+  ASSERT_EQ(nodes.size(), 1);
+  EXPECT_THAT(nodes.at(alice), ElementsAre(kOther));
+
+  // Из кэша ответ тот же
+  nodes = Directory->Locate({alice, bob});
+  ASSERT_EQ(nodes.size(), 1);
+  EXPECT_THAT(nodes.at(alice), ElementsAre(kOther));
+}
+
+UTEST_F(TPresenceDirectoryTest, StoreErrorIsNotCached) {
+  const TUserId alice{"alice"};
+  std::unordered_map<TUserId, std::vector<TNodeId>> found{{alice, {kOther}}};
+
+  EXPECT_CALL(Store, Lookup(ElementsAre(alice)))
+      .WillOnce(::testing::Throw(std::runtime_error("timeout")))
+      .WillOnce(Return(found));
+
+  EXPECT_TRUE(Directory->Locate({alice}).empty());
+  EXPECT_THAT(Directory->Locate({alice}).at(alice), ElementsAre(kOther));
+  EXPECT_EQ(Stats.store_errors_total.Load().value, 1);
+}
+
+UTEST_F(TPresenceDirectoryTest, RevokeCancelsPendingPublish) {
+  const TUserId alice{"alice"};
+
+  EXPECT_CALL(Store, Revoke(kSelf, ElementsAre(alice)));
+
+  Directory->Publish(alice);
+  Directory->Revoke({alice});
+  Directory->Flush();
+}
+
+UTEST_F(TPresenceDirectoryTest, PublishCancelsPendingRevoke) {
+  const TUserId alice{"alice"};
+
+  EXPECT_CALL(Store, Upsert(kSelf, ElementsAre(alice), std::chrono::seconds(60)));
+
+  Directory->Revoke({alice});
+  Directory->Publish(alice);
+  Directory->Flush();
+
+  // Повторная публикация без изменений ничего не пишет
+  Directory->Flush();
+}
+
+UTEST_F(TPresenceDirectoryTest, PublishAndRevokeGoOutInBatches) {
+  std::vector<TUserId> users{TUserId{"1"}, TUserId{"2"}, TUserId{"3"}, TUserId{"4"}, TUserId{"5"}};
+
+  EXPECT_CALL(Store, Upsert(kSelf, SizeIs(2), _)).Times(2);
+  EXPECT_CALL(Store, Upsert(kSelf, SizeIs(1), _));
+
+  for (const auto& user : users) {
+    Directory->Publish(user);
+  }
+  Directory->Flush();
+
+  EXPECT_CALL(Store, Revoke(kSelf, SizeIs(2))).Times(2);
+  EXPECT_CALL(Store, Revoke(kSelf, SizeIs(1)));
+
+  Directory->Revoke(users);
+  Directory->Flush();
+
+  EXPECT_EQ(Stats.published_total.Load().value, 5);
+  EXPECT_EQ(Stats.revoked_total.Load().value, 5);
+}
+
+UTEST_F(TPresenceDirectoryTest, RenewWritesOnlyLeasesNearExpiry) {
+  const TUserId alice{"alice"};
+  const TUserId bob{"bob"};
+
+  EXPECT_CALL(Store, Upsert(kSelf, ElementsAre(alice), _));
+  Directory->Publish(alice);
+  Directory->Flush();
+
+  // У свежей аренды больше трети срока, продлевать рано; bob без записанной аренды пишется сразу
+  EXPECT_CALL(Store, Upsert(kSelf, ElementsAre(bob), _));
+  Directory->Renew({alice, bob});
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds(39));
+  Directory->Renew({alice, bob});
+
+  EXPECT_CALL(Store, Upsert(kSelf, UnorderedElementsAre(alice, bob), _));
+  userver::utils::datetime::MockSleep(std::chrono::seconds(2));
+  Directory->Renew({alice, bob});
+
+  EXPECT_EQ(Stats.renewed_total.Load().value, 3);
+}
+
+UTEST_F(TPresenceDirectoryTest, FailedPublishIsRetriedByRenew) {
+  const TUserId alice{"alice"};
+
+  EXPECT_CALL(Store, Upsert(kSelf, ElementsAre(alice), _))
+      .WillOnce(::testing::Throw(std::runtime_error("timeout")))
+      .WillOnce(::testing::Return());
+
+  Directory->Publish(alice);
+  Directory->Flush();
+  Directory->Renew({alice});
+
+  // После успешной записи продление снова ждет трети срока
+  Directory->Renew({alice});
+}
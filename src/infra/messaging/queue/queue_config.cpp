@@ -3,7 +3,8 @@
 namespace NChat::NInfra {
 
 TQueueConfig Parse(const userver::formats::json::Value& value, userver::formats::parse::To<TQueueConfig>) {
-  return TQueueConfig{value["max_queue_size"].As<std::size_t>()};
+  return TQueueConfig{value["max_queue_size"].As<std::size_t>(), value["max_service_queue_size"].As<std::size_t>(64),
+                      value["max_total_memory_mb"].As<std::size_t>(0), value["shed_watermark"].As<double>(0.9)};
 }
 
 }  // namespace NChat::NInfra
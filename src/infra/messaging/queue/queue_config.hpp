@@ -10,6 +10,12 @@ namespace NChat::NInfra {
 
 struct TQueueConfig {
   std::size_t MaxQueueSize{1000};
+  // Служебная лейна очереди PriorityLanes; применяется к новым очередям
+  std::size_t MaxServiceQueueSize{64};
+  // Бюджет байт полезной нагрузки сообщений на весь узел, 0 - без ограничения
+  std::size_t MaxTotalMemoryMb{0};
+  // С этой доли бюджета GC сбрасывает самые старые сообщения из наиболее заполненных очередей
+  double ShedWatermark{0.9};
 };
 
 TQueueConfig Parse(const userver::formats::json::Value& value, userver::formats::parse::To<TQueueConfig>);
@@ -17,7 +23,10 @@ TQueueConfig Parse(const userver::formats::json::Value& value, userver::formats:
 const userver::dynamic_config::Key<TQueueConfig> kQueueConfig{"QUEUE_CONFIG",
                                                               userver::dynamic_config::DefaultAsJsonString{R"(
   {
-    "max_queue_size": 1000
+    "max_queue_size": 1000,
+    "max_service_queue_size": 64,
+    "max_total_memory_mb": 2048,
+    "shed_watermark": 0.9
   }
 )"}};
 
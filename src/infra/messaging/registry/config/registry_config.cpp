@@ -3,7 +3,9 @@
 namespace NChat::NInfra {
 
 TRegistryConfig Parse(const userver::formats::json::Value& value, userver::formats::parse::To<TRegistryConfig>) {
-  return TRegistryConfig{value["max_users_amount"].As<std::size_t>()};
+  return TRegistryConfig{value["max_users_amount"].As<std::size_t>(),
+                         value["reserved_users_amount"].As<std::size_t>(0),
+                         std::chrono::seconds{value["reconnect_window_sec"].As<int>(300)}};
 }
 
 }  // namespace NChat::NInfra
@@ -10,6 +10,10 @@ namespace NChat::NInfra {
 
 struct TRegistryConfig {
   std::size_t MaxUsersAmount{10000};
+  // Часть MaxUsersAmount, доступная только переподключающимся пользователям
+  std::size_t ReservedUsersAmount{0};
+  // Сколько после удаления почтового ящика пользователь считается переподключающимся
+  std::chrono::seconds ReconnectWindow{300};
 };
 
 TRegistryConfig Parse(const userver::formats::json::Value& value, userver::formats::parse::To<TRegistryConfig>);
@@ -17,7 +21,9 @@ TRegistryConfig Parse(const userver::formats::json::Value& value, userver::forma
 const userver::dynamic_config::Key<TRegistryConfig> kRegistryConfig{"REGISTRY_CONFIG",
                                                                     userver::dynamic_config::DefaultAsJsonString{R"(
   {
-    "max_users_amount": 10000
+    "max_users_amount": 10000,
+    "reserved_users_amount": 500,
+    "reconnect_window_sec": 300
   }
 )"}};
 
@@ -1,15 +1,27 @@
 #include "registry_stats.hpp"
 
+#include <utils/memory/memory_budget.hpp>
+
 namespace NChat::NInfra {
 
 void DumpMetric(userver::utils::statistics::Writer& writer, const TMailboxStatistics& stats) {
   writer["opened"]["current"] = stats.active_amount;
   writer["removed"]["total"] = stats.removed_total;
+  writer["shed_messages"]["total"] = stats.shed_messages_total;
+  writer["rejected_capacity"]["total"] = stats.rejected_capacity_total;
+  writer["rejected_overload"]["total"] = stats.rejected_overload_total;
+  writer["reserved_admitted"]["total"] = stats.reserved_admitted_total;
+  writer["queue_memory"]["bytes"] = NUtils::NMemory::GetChargedBytes();
+  writer["queue_memory"]["budget_bytes"] = NUtils::NMemory::GetBudget();
   writer["shards"]["size"]["hist"] = stats.shard_size;
 }
 
 void ResetMetric(TMailboxStatistics& stats) {
   stats.active_amount = 0;
   stats.removed_total.Store({0});
+  stats.shed_messages_total.Store({0});
+  stats.rejected_capacity_total.Store({0});
+  stats.rejected_overload_total.Store({0});
+  stats.reserved_admitted_total.Store({0});
 }
 }  // namespace NChat::NInfra
@@ -11,6 +11,10 @@ namespace NChat::NInfra {
 struct TMailboxStatistics {
   std::atomic<int> active_amount{0};
   userver::utils::statistics::RateCounter removed_total{0};
+  userver::utils::statistics::RateCounter shed_messages_total{0};
+  userver::utils::statistics::RateCounter rejected_capacity_total{0};
+  userver::utils::statistics::RateCounter rejected_overload_total{0};
+  userver::utils::statistics::RateCounter reserved_admitted_total{0};
 
   userver::utils::statistics::Histogram shard_size{{1, 10, 100, 500, 1000, 10000}};
 };
@@ -1,19 +1,40 @@
 #include "sharded_registry.hpp"
 
 #include <infra/concurrency/queue/vyukov_queue.hpp>
-#include <infra/messaging/registry/config/registry_config.hpp>
+
+#include <utils/memory/memory_budget.hpp>
 
 #include <userver/logging/log.hpp>
-#include <userver/utils/datetime_light.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+#include <algorithm>
+#include <mutex>
 
 namespace NChat::NInfra {
 
+namespace {
+// При сбросе в очереди остается половина лимита: первыми худеют самые заполненные очереди
+constexpr double kShedKeepRatio = 0.5;
+// Сколько недавно удаленных пользователей помним для резерва мест; самые давние вытесняются
+constexpr std::size_t kRecentlyRemovedCapacity = 100'000;
+
+void ApplyMemoryBudget(const TQueueConfig& config) {
+  NUtils::NMemory::SetBudget(config.MaxTotalMemoryMb * 1024 * 1024);
+}
+}  // namespace
+
 TShardedRegistry::TShardedRegistry(std::size_t shard_amount, NCore::ISessionsFactory& sessions_factory,
-                                   userver::dynamic_config::Source config_source, TMailboxStatistics& stats)
+                                   const TConfigCache& config_cache, TMailboxStatistics& stats,
+                                   NCore::IPresencePublisher* presence, const NCore::IOverloadSensor* overload)
     : Registry_(shard_amount),
       SessionsFactory_(sessions_factory),
-      ConfigSource_(std::move(config_source)),
-      Stats_(stats) {
+      ConfigCache_(config_cache),
+      Stats_(stats),
+      Presence_(presence),
+      Overload_(overload),
+      RecentlyRemoved_(kRecentlyRemovedCapacity) {
+  ApplyMemoryBudget(ConfigCache_.GetQueueConfig());
   LOG_INFO() << fmt::format("Start Registry on Sharded Map with {} shards", shard_amount);
 }
 
@@ -26,10 +47,20 @@ NCore::TMailboxPtr TShardedRegistry::CreateOrGetMailbox(const TUserId& user_id)
     return existing_mailbox;
   }
 
-  const auto snapshot = ConfigSource_.GetSnapshot();
-  auto config = snapshot[kRegistryConfig];
+  const auto config = ConfigCache_.GetRegistryConfig();
+  const auto max_users = static_cast<std::int64_t>(config.MaxUsersAmount);
+  const auto reserved = static_cast<std::int64_t>(std::min(config.ReservedUsersAmount, config.MaxUsersAmount));
 
-  if (OnlineCounter_.load(std::memory_order_relaxed) >= static_cast<std::int64_t>(config.MaxUsersAmount)) {
+  // Место занимаем до создания ящика: проверка и занятие одной операцией, параллельные запросы не превысят лимит
+  const auto online = OnlineCounter_.fetch_add(1, std::memory_order_relaxed);
+  userver::utils::ScopeGuard release_place([this] { OnlineCounter_.fetch_sub(1, std::memory_order_relaxed); });
+
+  const bool is_full = online >= max_users;
+  const bool is_overloaded = Overload_ && Overload_->IsOverloaded();
+  const bool in_reserve = online >= max_users - reserved;
+
+  if (is_full || ((is_overloaded || in_reserve) && !IsReconnect(user_id, config.ReconnectWindow))) {
+    (is_overloaded && !is_full ? Stats_.rejected_overload_total : Stats_.rejected_capacity_total).Add({1});
     return nullptr;
   }
 
@@ -40,7 +71,15 @@ NCore::TMailboxPtr TShardedRegistry::CreateOrGetMailbox(const TUserId& user_id)
   auto [mailbox, inserted] = Registry_.GetOrCreate(user_id, mailbox_factory);
 
   if (inserted) {
-    OnlineCounter_.fetch_add(1, std::memory_order_relaxed);
+    release_place.Release();
+
+    if (in_reserve) {
+      Stats_.reserved_admitted_total.Add({1});
+    }
+
+    if (Presence_) {
+      Presence_->Publish(user_id);
+    }
   }
 
   return mailbox;
@@ -49,6 +88,11 @@ NCore::TMailboxPtr TShardedRegistry::CreateOrGetMailbox(const TUserId& user_id)
 void TShardedRegistry::RemoveMailbox(const TUserId& user_id) {
   Registry_.Remove(user_id);
   OnlineCounter_.fetch_sub(1, std::memory_order_relaxed);
+  RememberRemoved({user_id});
+
+  if (Presence_) {
+    Presence_->Revoke({user_id});
+  }
 }
 
 std::int64_t TShardedRegistry::GetOnlineAmount() const {
@@ -56,9 +100,32 @@ std::int64_t TShardedRegistry::GetOnlineAmount() const {
 }
 
 void TShardedRegistry::TraverseRegistry(std::chrono::milliseconds inter_pause) {
-  auto is_expired = [](const NCore::TMailboxPtr& mailbox) {
+  // Обход видит каждый почтовый ящик: заодно собираем, чьи аренды присутствия продлить, а чьи отозвать
+  std::vector<TUserId> alive;
+  std::vector<TUserId> removed;
+
+  const auto queue_config = ConfigCache_.GetQueueConfig();
+  ApplyMemoryBudget(queue_config);
+
+  const auto shed_keep = static_cast<std::size_t>(static_cast<double>(queue_config.MaxQueueSize) * kShedKeepRatio);
+  std::size_t shed_amount = 0;
+
+  auto is_expired = [&](const NCore::TMailboxPtr& mailbox) {
     mailbox->CleanIdle();
-    return mailbox->HasNoConsumer();
+    const bool expired = mailbox->HasNoConsumer();
+
+    // Проверяем на каждом ящике: сброс возвращает память, и обход останавливает его, как только хватит
+    if (!expired && NUtils::NMemory::IsOverBudget(queue_config.ShedWatermark)) {
+      shed_amount += mailbox->ShedOldest(shed_keep);
+    }
+
+    if (expired) {
+      removed.push_back(mailbox->GetUserId());
+    } else if (Presence_) {
+      alive.push_back(mailbox->GetUserId());
+    }
+
+    return expired;
   };
 
   auto metrics_cb = [this](const std::unordered_map<TUserId, NCore::TMailboxPtr>& shard) {
@@ -71,10 +138,51 @@ void TShardedRegistry::TraverseRegistry(std::chrono::milliseconds inter_pause) {
 
   Stats_.active_amount = old_value - removed_amount;
   Stats_.removed_total.Add({removed_amount});
+  Stats_.shed_messages_total.Add({shed_amount});
+
+  RememberRemoved(removed);
+
+  if (Presence_) {
+    Presence_->Revoke(std::move(removed));
+    Presence_->Renew(std::move(alive));
+  }
+
+  if (shed_amount > 0) {
+    LOG_WARNING() << fmt::format("Queue memory {} of {} bytes: shed {} oldest messages",
+                                 NUtils::NMemory::GetChargedBytes(), NUtils::NMemory::GetBudget(), shed_amount);
+  }
 
   LOG_INFO() << fmt::format("Mailbox Registry GC: removed {}", removed_amount);
 }
 
+std::size_t TShardedRegistry::WakeConsumers() {
+  std::size_t woken = 0;
+
+  Registry_.ForEach([&woken](const NCore::TMailboxPtr& mailbox) {
+    mailbox->WakeConsumers();
+    ++woken;
+  });
+
+  return woken;
+}
+
+bool TShardedRegistry::IsReconnect(const TUserId& user_id, std::chrono::seconds window) {
+  const auto now = userver::utils::datetime::SteadyNow();
+
+  std::lock_guard lock(RemovedMutex_);
+  const auto* removed_at = RecentlyRemoved_.Get(user_id);
+  return removed_at && now - *removed_at <= window;
+}
+
+void TShardedRegistry::RememberRemoved(const std::vector<TUserId>& users) {
+  const auto now = userver::utils::datetime::SteadyNow();
+
+  std::lock_guard lock(RemovedMutex_);
+  for (const auto& user_id : users) {
+    RecentlyRemoved_.Put(user_id, now);
+  }
+}
+
 void TShardedRegistry::Clear() {
   Registry_.Clear();
 }
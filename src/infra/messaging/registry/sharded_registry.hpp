@@ -1,23 +1,39 @@
 #pragma once
 
+#include <core/messaging/admission/overload_sensor.hpp>
 #include <core/messaging/mailbox/mailbox_registry.hpp>
+#include <core/messaging/presence/presence.hpp>
 #include <core/messaging/queue/message_queue_factory.hpp>
 #include <core/messaging/session/sessions_factory.hpp>
 
 #include <infra/concurrency/sharded_map/sharded_map.hpp>
+#include <infra/config/config_cache.hpp>
 #include <infra/messaging/registry/metrics/registry_stats.hpp>
 
-#include <userver/dynamic_config/source.hpp>
+#include <userver/cache/lru_map.hpp>
+#include <userver/engine/mutex.hpp>
+
+#include <chrono>
+#include <vector>
 
 namespace NChat::NInfra {
 
+/*
+Mailbox registry on a sharded map.
+A new mailbox first reserves its place in OnlineCounter_, so concurrent creations never overshoot
+MaxUsersAmount. The last ReservedUsersAmount places and any place while the node is overloaded are given
+only to users whose mailbox was removed within ReconnectWindow: reconnecting users are preferred over new ones.
+*/
 class TShardedRegistry : public NCore::IMailboxRegistry {
  public:
   using TUserId = NCore::NDomain::TUserId;
   using TShardedMap = NConcurrency::TShardedMap<TUserId, NCore::TUserMailbox>;
 
+  // presence может быть nullptr: узел один, о своих пользователях никому не сообщает
+  // overload может быть nullptr: новых пользователей ограничивает только MaxUsersAmount
   TShardedRegistry(std::size_t shard_amount, NCore::ISessionsFactory& sessions_factory,
-                   userver::dynamic_config::Source config_source, TMailboxStatistics& stats);
+                   const TConfigCache& config_cache, TMailboxStatistics& stats,
+                   NCore::IPresencePublisher* presence = nullptr, const NCore::IOverloadSensor* overload = nullptr);
 
   // Hot path
   NCore::TMailboxPtr GetMailbox(const TUserId& user_id) const override;
@@ -28,16 +44,30 @@ class TShardedRegistry : public NCore::IMailboxRegistry {
   // Offline API for metrics and periodic cleaning
   void TraverseRegistry(std::chrono::milliseconds inter_pause) override;
 
+  std::size_t WakeConsumers() override;
+
   // For reset in tests
   void Clear() override;
 
+ private:
+  using TTimePoint = std::chrono::steady_clock::time_point;
+
+  bool IsReconnect(const TUserId& user_id, std::chrono::seconds window);
+  void RememberRemoved(const std::vector<TUserId>& users);
+
  private:
   TShardedMap Registry_;
   std::atomic<int64_t> OnlineCounter_{0};
   NCore::ISessionsFactory& SessionsFactory_;
 
-  userver::dynamic_config::Source ConfigSource_;
+  const TConfigCache& ConfigCache_;
   TMailboxStatistics& Stats_;
+  NCore::IPresencePublisher* Presence_;
+  const NCore::IOverloadSensor* Overload_;
+
+  // Недавно удаленные почтовые ящики: их владельцы пускаются в резерв мест
+  userver::engine::Mutex RemovedMutex_;
+  userver::cache::LruMap<TUserId, TTimePoint> RecentlyRemoved_;
 };
 
 }  // namespace NChat::NInfra
@@ -8,6 +8,7 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/utest/utest.hpp>
@@ -28,9 +29,10 @@ class TShardedRegistryTest : public ::testing::Test {
       return std::make_unique<MockSessionsRegistry>();
     }));
 
-    Registry = std::make_unique<TShardedRegistry>(256, *Factory, userver::dynamic_config::GetDefaultSource(), Stats);
+    Registry = std::make_unique<TShardedRegistry>(256, *Factory, ConfigCache, Stats);
   }
 
+  TConfigCache ConfigCache{userver::dynamic_config::GetDefaultSource()};
   std::unique_ptr<ISessionsFactory> Factory;
   TMailboxStatistics Stats{};
   std::unique_ptr<IMailboxRegistry> Registry;
@@ -124,16 +126,17 @@ UTEST(TShardedRegistryTestRcu, TraverseRegistryRemovesExpiredMailboxes) {
   auto Factory = std::make_unique<MockSessionsFactory>();
   auto& MockRef = dynamic_cast<MockSessionsFactory&>(*Factory);
   TSessionsStatistics stats{};
+  TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
 
-  EXPECT_CALL(MockRef, Create()).WillRepeatedly(::testing::Invoke([&stats]() {
+  EXPECT_CALL(MockRef, Create()).WillRepeatedly(::testing::Invoke([&stats, &config_cache]() {
     auto factory = std::make_unique<MockMessageQueueFactory>();
     auto now_fn = []() { return std::chrono::steady_clock::now(); };
 
-    return std::make_unique<TRcuSessionsRegistry>(*factory, now_fn, userver::dynamic_config::GetDefaultSource(), stats);
+    return std::make_unique<TRcuSessionsRegistry>(*factory, now_fn, config_cache, stats);
   }));
   TMailboxStatistics mailbox_stats{};
 
-  TShardedRegistry registry(256, MockRef, userver::dynamic_config::GetDefaultSource(), mailbox_stats);
+  TShardedRegistry registry(256, MockRef, config_cache, mailbox_stats);
   userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000"));
   TUserId user_id{"42"};
 
@@ -317,7 +320,7 @@ UTEST_F_MT(TShardedRegistryTest, HighContentionMixedOperations, 8) {
 UTEST_F(TShardedRegistryTest, DifferentShardCounts) {
   // Проверяем, что работает с разным количеством шардов
   for (std::size_t shard_count : {1, 4, 16, 64, 256, 1024}) {
-    TShardedRegistry registry(shard_count, *Factory, userver::dynamic_config::GetDefaultSource(), Stats);
+    TShardedRegistry registry(shard_count, *Factory, ConfigCache, Stats);
 
     TUserId user_id{"42"};
     auto mailbox = registry.CreateOrGetMailbox(user_id);
@@ -326,3 +329,143 @@ UTEST_F(TShardedRegistryTest, DifferentShardCounts) {
     EXPECT_EQ(registry.GetOnlineAmount(), 1);
   }
 }
+
+UTEST(TShardedRegistryPresence, PublishedOnInsertRevokedOnRemove) {
+  MockSessionsFactory factory;
+  EXPECT_CALL(factory, Create()).WillRepeatedly(
+      ::testing::Invoke([]() { return std::make_unique<::testing::NiceMock<MockSessionsRegistry>>(); }));
+  TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
+  TMailboxStatistics stats{};
+  ::testing::StrictMock<MockPresencePublisher> presence;
+
+  TShardedRegistry registry(16, factory, config_cache, stats, &presence);
+  TUserId user_id{"42"};
+
+  EXPECT_CALL(presence, Publish(user_id)).Times(1);
+  registry.CreateOrGetMailbox(user_id);
+  registry.CreateOrGetMailbox(user_id);
+
+  EXPECT_CALL(presence, Revoke(std::vector<TUserId>{user_id})).Times(1);
+  registry.RemoveMailbox(user_id);
+}
+
+UTEST(TShardedRegistryPresence, TraverseRevokesRemovedAndRenewsAlive) {
+  MockSessionsFactory factory;
+  EXPECT_CALL(factory, Create())
+      .WillOnce(::testing::Invoke([]() {
+        auto sessions = std::make_unique<::testing::NiceMock<MockSessionsRegistry>>();
+        ON_CALL(*sessions, HasNoConsumer()).WillByDefault(::testing::Return(true));
+        return sessions;
+      }))
+      .WillOnce(::testing::Invoke([]() { return std::make_unique<::testing::NiceMock<MockSessionsRegistry>>(); }));
+  TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
+  TMailboxStatistics stats{};
+  ::testing::NiceMock<MockPresencePublisher> presence;
+
+  TShardedRegistry registry(16, factory, config_cache, stats, &presence);
+  TUserId gone{"gone"};
+  TUserId alive{"alive"};
+  registry.CreateOrGetMailbox(gone);
+  registry.CreateOrGetMailbox(alive);
+
+  EXPECT_CALL(presence, Revoke(std::vector<TUserId>{gone})).Times(1);
+  EXPECT_CALL(presence, Renew(std::vector<TUserId>{alive})).Times(1);
+  registry.TraverseRegistry(std::chrono::milliseconds(0));
+
+  EXPECT_EQ(registry.GetOnlineAmount(), 1);
+}
+
+class TShardedRegistryAdmissionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ON_CALL(Factory, Create()).WillByDefault(::testing::Invoke([]() {
+      return std::make_unique<::testing::NiceMock<MockSessionsRegistry>>();
+    }));
+    userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000"));
+  }
+
+  // Три места, последнее только для переподключений
+  userver::dynamic_config::StorageMock Storage{
+      userver::dynamic_config::GetDefaultDocsMap(),
+      {{kRegistryConfig, TRegistryConfig{.MaxUsersAmount = 3,
+                                         .ReservedUsersAmount = 1,
+                                         .ReconnectWindow = std::chrono::seconds{60}}}}};
+  TConfigCache ConfigCache{Storage.GetSource()};
+  ::testing::NiceMock<MockSessionsFactory> Factory;
+  ::testing::NiceMock<MockOverloadSensor> Overload;
+  TMailboxStatistics Stats{};
+  TShardedRegistry Registry{16, Factory, ConfigCache, Stats, nullptr, &Overload};
+};
+
+UTEST_F(TShardedRegistryAdmissionTest, ReservedPlacesAreLeftForReconnects) {
+  for (const auto* user : {"returning", "late"}) {
+    Registry.CreateOrGetMailbox(TUserId{user});
+    Registry.RemoveMailbox(TUserId{user});
+  }
+
+  EXPECT_NE(Registry.CreateOrGetMailbox(TUserId{"a"}), nullptr);
+  EXPECT_NE(Registry.CreateOrGetMailbox(TUserId{"b"}), nullptr);
+
+  // Осталось только резервное место: новичок не проходит, вернувшийся пользователь проходит
+  EXPECT_EQ(Registry.CreateOrGetMailbox(TUserId{"newcomer"}), nullptr);
+  EXPECT_NE(Registry.CreateOrGetMailbox(TUserId{"returning"}), nullptr);
+
+  // Лимит не превышается даже для переподключений
+  EXPECT_EQ(Registry.CreateOrGetMailbox(TUserId{"late"}), nullptr);
+
+  EXPECT_EQ(Registry.GetOnlineAmount(), 3);
+  EXPECT_EQ(Stats.rejected_capacity_total.Load().value, 2);
+  EXPECT_EQ(Stats.reserved_admitted_total.Load().value, 1);
+}
+
+UTEST_F(TShardedRegistryAdmissionTest, ReconnectWindowExpires) {
+  Registry.CreateOrGetMailbox(TUserId{"returning"});
+  Registry.RemoveMailbox(TUserId{"returning"});
+  Registry.CreateOrGetMailbox(TUserId{"a"});
+  Registry.CreateOrGetMailbox(TUserId{"b"});
+
+  userver::utils::datetime::MockSleep(std::chrono::seconds{61});
+
+  EXPECT_EQ(Registry.CreateOrGetMailbox(TUserId{"returning"}), nullptr);
+  EXPECT_EQ(Registry.GetOnlineAmount(), 2);
+}
+
+UTEST_F(TShardedRegistryAdmissionTest, OverloadedNodeAdmitsOnlyKnownUsers) {
+  auto existing = Registry.CreateOrGetMailbox(TUserId{"existing"});
+  Registry.CreateOrGetMailbox(TUserId{"returning"});
+  Registry.RemoveMailbox(TUserId{"returning"});
+
+  ON_CALL(Overload, IsOverloaded()).WillByDefault(::testing::Return(true));
+
+  EXPECT_EQ(Registry.CreateOrGetMailbox(TUserId{"existing"}), existing);
+  EXPECT_EQ(Registry.CreateOrGetMailbox(TUserId{"newcomer"}), nullptr);
+  EXPECT_NE(Registry.CreateOrGetMailbox(TUserId{"returning"}), nullptr);
+
+  EXPECT_EQ(Registry.GetOnlineAmount(), 2);
+  EXPECT_EQ(Stats.rejected_overload_total.Load().value, 1);
+}
+
+UTEST_F_MT(TShardedRegistryAdmissionTest, ConcurrentCreationNeverOvershootsLimit, 4) {
+  constexpr int kUsersPerTask = 50;
+
+  std::vector<userver::engine::Task> tasks;
+  std::atomic<int> admitted{0};
+
+  for (std::size_t task_no = 0; task_no < GetThreadCount(); ++task_no) {
+    tasks.push_back(userver::engine::AsyncNoSpan([&, task_no] {
+      for (int i = 0; i < kUsersPerTask; ++i) {
+        if (Registry.CreateOrGetMailbox(TUserId{std::to_string(task_no * kUsersPerTask + i)})) {
+          ++admitted;
+        }
+      }
+    }));
+  }
+
+  for (auto& task : tasks) {
+    task.Wait();
+  }
+
+  // Резерв пустует: переподключений не было
+  EXPECT_LE(admitted.load(), 2);
+  EXPECT_EQ(Registry.GetOnlineAmount(), admitted.load());
+}
@@ -6,13 +6,19 @@
 
 namespace NChat::NInfra {
 
-TRcuSessionsFactory::TRcuSessionsFactory(NCore::IMessageQueueFactory& factory,
-                                         userver::dynamic_config::Source config_source, TSessionsStatistics& stats)
-    : Factory_(factory), ConfigSource_(std::move(config_source)), Stats_(stats) {
+TRcuSessionsFactory::TRcuSessionsFactory(NCore::IMessageQueueFactory& factory, const TConfigCache& config_cache,
+                                         TSessionsStatistics& stats, bool shared_queue)
+    : Factory_(factory), ConfigCache_(config_cache), Stats_(stats), SharedQueue_(shared_queue) {
 }
 
 std::unique_ptr<NCore::ISessionsRegistry> TRcuSessionsFactory::Create() const {
+  std::shared_ptr<TSharedMessageRing> shared_ring;
+
+  if (SharedQueue_) {
+    shared_ring = std::make_shared<TSharedMessageRing>(ConfigCache_.GetQueueConfig().MaxQueueSize);
+  }
+
   return std::make_unique<TRcuSessionsRegistry>(
-      Factory_, []() { return userver::utils::datetime::SteadyNow(); }, ConfigSource_, Stats_);
+      Factory_, []() { return userver::utils::datetime::SteadyNow(); }, ConfigCache_, Stats_, std::move(shared_ring));
 }
 }  // namespace NChat::NInfra
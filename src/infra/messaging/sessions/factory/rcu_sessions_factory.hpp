@@ -2,21 +2,21 @@
 
 #include <core/messaging/session/sessions_factory.hpp>
 
+#include <infra/config/config_cache.hpp>
 #include <infra/messaging/sessions/metrics/sessions_stats.hpp>
 
-#include <userver/dynamic_config/source.hpp>
-
 namespace NChat::NInfra {
 class TRcuSessionsFactory : public NCore::ISessionsFactory {
  public:
-  TRcuSessionsFactory(NCore::IMessageQueueFactory& factory, userver::dynamic_config::Source config_source,
-                      TSessionsStatistics& stats);
+  TRcuSessionsFactory(NCore::IMessageQueueFactory& factory, const TConfigCache& config_cache,
+                      TSessionsStatistics& stats, bool shared_queue = false);
 
   std::unique_ptr<NCore::ISessionsRegistry> Create() const override;
 
  private:
   NCore::IMessageQueueFactory& Factory_;
-  userver::dynamic_config::Source ConfigSource_;
+  const TConfigCache& ConfigCache_;
   TSessionsStatistics& Stats_;
+  bool SharedQueue_;
 };
 }  // namespace NChat::NInfra
@@ -9,6 +9,7 @@ void DumpMetric(userver::utils::statistics::Writer& writer, const TSessionsStati
   writer["per_user"]["hist"] = stats.sessions_per_user_hist;
   writer["queue"]["size"]["hist"] = stats.queue_size_hist;
   writer["lifetime"]["sec"]["hist"] = stats.lifetime_sec_hist;
+  writer["shared_queue"]["saved"]["hist"] = stats.shared_queue_saved_hist;
 }
 
 void ResetMetric(TSessionsStatistics& stats) {
@@ -15,6 +15,7 @@ struct TSessionsStatistics {
   userver::utils::statistics::Histogram sessions_per_user_hist{{1, 2, 3, 4, 5}};
   userver::utils::statistics::Histogram queue_size_hist{{1, 5, 10, 25, 50, 100, 500, 1000}};
   userver::utils::statistics::Histogram lifetime_sec_hist{{1, 10, 50, 100, 500, 1000, 10000}};
+  userver::utils::statistics::Histogram shared_queue_saved_hist{{1, 5, 10, 25, 50, 100, 500, 1000}};
 };
 
 inline const userver::utils::statistics::MetricTag<TSessionsStatistics> kSessionsTag{"chat_sessions"};
@@ -1,20 +1,35 @@
 #include "rcu_sessions_registry.hpp"
 
-#include <infra/messaging/sessions/config/sessions_config.hpp>
+#include <algorithm>
 
 namespace NChat::NInfra {
 
 TRcuSessionsRegistry::TRcuSessionsRegistry(const NCore::IMessageQueueFactory& queue_factory,
                                            std::function<TTimePoint()> now,
-                                           userver::dynamic_config::Source config_source, TSessionsStatistics& stats)
-    : QueueFactory_(queue_factory), GetNow_(now), ConfigSource_(std::move(config_source)), Stats_(stats) {
+                                           const TConfigCache& config_cache, TSessionsStatistics& stats,
+                                           std::shared_ptr<TSharedMessageRing> shared_ring)
+    : QueueFactory_(queue_factory),
+      SharedRing_(std::move(shared_ring)),
+      GetNow_(now),
+      ConfigCache_(config_cache),
+      Stats_(stats) {
 }
 
 bool TRcuSessionsRegistry::FanOutMessage(TMessage message) {
   auto sessions_ptr = Sessions_.Read();
   auto& sessions_map = *sessions_ptr;
 
+  if (SharedRing_) {
+    // Single push for all tabs, cursors of lagging sessions are marked for resync
+    if (!sessions_map.empty()) {
+      SharedRing_->Push(std::move(message));
+    }
+    ++Stats_.messages_sent_total;
+    return true;
+  }
+
   bool success = true;
+  double fill_ratio = 0.0;
 
   for (auto it = sessions_map.begin(); it != sessions_map.end(); ++it) {
     if (std::next(it) == sessions_map.end()) {
@@ -23,8 +38,12 @@ bool TRcuSessionsRegistry::FanOutMessage(TMessage message) {
     } else {
       success &= it->second->PushMessage(message);
     }
+
+    fill_ratio = std::max(fill_ratio, it->second->GetFillRatio());
   }
 
+  FillRatio_.store(success ? fill_ratio : 1.0, std::memory_order_relaxed);
+
   if (success) {
     ++Stats_.messages_sent_total;
   }
@@ -64,15 +83,14 @@ TRcuSessionsRegistry::TSessionPtr TRcuSessionsRegistry::TryCreateSession(const T
     return it->second;
   }
 
-  const auto snapshot = ConfigSource_.GetSnapshot();
-  auto config = snapshot[kSessionsConfig];
+  const auto config = ConfigCache_.GetSessionsConfig();
 
   const auto size = sessions_ptr->size();
   if (size >= config.MaxSessionsAmount) {
     throw NCore::TSessionLimitExceeded();
   }
 
-  auto session = std::make_shared<NCore::TUserSession>(session_id, QueueFactory_.Create(), GetNow_);
+  auto session = std::make_shared<NCore::TUserSession>(session_id, CreateQueue(), GetNow_);
   sessions_ptr->emplace(session_id, session);
   sessions_ptr.Commit();
 
@@ -82,6 +100,14 @@ TRcuSessionsRegistry::TSessionPtr TRcuSessionsRegistry::TryCreateSession(const T
   return session;
 }
 
+std::unique_ptr<NCore::IMessageQueue> TRcuSessionsRegistry::CreateQueue() const {
+  if (SharedRing_) {
+    return std::make_unique<TSharedRingCursorQueue>(SharedRing_);
+  }
+
+  return QueueFactory_.Create();
+}
+
 void TRcuSessionsRegistry::RemoveSession(const TSessionId& session_id) {
   auto sessions_ptr = Sessions_.StartWrite();
   sessions_ptr->erase(session_id);
@@ -89,6 +115,11 @@ void TRcuSessionsRegistry::RemoveSession(const TSessionId& session_id) {
   --Stats_.opened_sessions_current;
 }
 
+double TRcuSessionsRegistry::GetFillRatio() const {
+  // Общее кольцо не отказывает в записи: отстающие сессии уходят в resync, а не тормозят отправителя
+  return FillRatio_.load(std::memory_order_relaxed);
+}
+
 bool TRcuSessionsRegistry::HasNoConsumer() const {
   auto sessions = Sessions_.Read();
   return sessions->empty();
@@ -100,14 +131,14 @@ std::size_t TRcuSessionsRegistry::GetOnlineAmount() const {
 }
 
 std::size_t TRcuSessionsRegistry::CleanIdle() {
-  const auto snapshot = ConfigSource_.GetSnapshot();
-  auto config = snapshot[kSessionsConfig];
+  const auto config = ConfigCache_.GetSessionsConfig();
 
   auto sessions_ptr = Sessions_.StartWrite();
   std::size_t removed = 0;
 
+  AccountQueueSizes(*sessions_ptr);  // metrics
+
   for (auto it = sessions_ptr->begin(); it != sessions_ptr->end();) {
-    Stats_.queue_size_hist.Account(it->second->GetSizeApproximate());  // metrics
     Stats_.lifetime_sec_hist.Account(it->second->GetLifetimeSeconds().count());
 
     if (!it->second->IsActive(config.IdleTimeout)) {
@@ -126,4 +157,37 @@ std::size_t TRcuSessionsRegistry::CleanIdle() {
   return removed;
 }
 
+std::size_t TRcuSessionsRegistry::ShedOldest(std::size_t keep) {
+  if (SharedRing_) {
+    return 0;  // кольцо ограничено само: отстающих вытесняет в resync
+  }
+
+  auto sessions = Sessions_.Read();
+  std::size_t shed = 0;
+  for (const auto& [_, session] : *sessions) {
+    shed += session->ShedOldest(keep);
+  }
+
+  return shed;
+}
+
+void TRcuSessionsRegistry::AccountQueueSizes(const TRegistry& sessions) {
+  if (!SharedRing_) {
+    for (const auto& [_, session] : sessions) {
+      Stats_.queue_size_hist.Account(session->GetSizeApproximate());
+    }
+    return;
+  }
+
+  // Unread messages of every session would be stored separately without the shared ring
+  std::size_t unread_total = 0;
+  for (const auto& [_, session] : sessions) {
+    unread_total += session->GetSizeApproximate();
+  }
+
+  const auto stored = SharedRing_->GetSize();
+  Stats_.queue_size_hist.Account(stored);
+  Stats_.shared_queue_saved_hist.Account(unread_total > stored ? unread_total - stored : 0);
+}
+
 };  // namespace NChat::NInfra
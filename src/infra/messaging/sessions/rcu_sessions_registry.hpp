@@ -3,13 +3,16 @@
 #include <core/messaging/queue/message_queue_factory.hpp>
 #include <core/messaging/session/sessions_registry.hpp>
 
+#include <infra/concurrency/queue/shared_ring_queue.hpp>
+#include <infra/config/config_cache.hpp>
 #include <infra/messaging/sessions/metrics/sessions_stats.hpp>
 
 #include <boost/container/flat_map.hpp>
-#include <userver/dynamic_config/source.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/rcu/rcu.hpp>
 
+#include <atomic>
+
 namespace NChat::NInfra {
 
 class TRcuSessionsRegistry : public NCore::ISessionsRegistry {
@@ -20,28 +23,37 @@ class TRcuSessionsRegistry : public NCore::ISessionsRegistry {
   using TMessage = NCore::NDomain::TMessage;
   using TTimePoint = std::chrono::steady_clock::time_point;
 
+  // With shared_ring all sessions read the same ring through their own cursors instead of private queues
   TRcuSessionsRegistry(const NCore::IMessageQueueFactory& queue_factory, std::function<TTimePoint()> now,
-                       userver::dynamic_config::Source config_source, TSessionsStatistics& stats);
+                       const TConfigCache& config_cache, TSessionsStatistics& stats,
+                       std::shared_ptr<TSharedMessageRing> shared_ring = nullptr);
 
   bool FanOutMessage(TMessage message) override;
+  double GetFillRatio() const override;
   TSessionPtr CreateSession(const TSessionId& session_id) override;
   TSessionPtr GetOrCreateSession(const TSessionId& session_id) override;
   TSessionPtr GetSession(const TSessionId& session_id) override;
 
   std::size_t CleanIdle() override;
+  std::size_t ShedOldest(std::size_t keep) override;
   void RemoveSession(const TSessionId& session_id) override;
   bool HasNoConsumer() const override;
   std::size_t GetOnlineAmount() const override;
 
  private:
   TSessionPtr TryCreateSession(const TSessionId& session_id, bool return_existing);
+  std::unique_ptr<NCore::IMessageQueue> CreateQueue() const;
+  void AccountQueueSizes(const TRegistry& sessions);
 
  private:
   userver::rcu::Variable<TRegistry> Sessions_;
 
   const NCore::IMessageQueueFactory& QueueFactory_;
+  std::shared_ptr<TSharedMessageRing> SharedRing_;
   std::function<TTimePoint()> GetNow_;
-  userver::dynamic_config::Source ConfigSource_;
+  const TConfigCache& ConfigCache_;
   TSessionsStatistics& Stats_;
+
+  std::atomic<double> FillRatio_{0.0};
 };
 }  // namespace NChat::NInfra
@@ -65,9 +65,9 @@ void BM_Sessions_HighContentionReads(benchmark::State& state) {
   userver::engine::RunStandalone(num_threads, [&]() {
     auto factory = std::make_unique<TMockMessageQueueFactory>();
     TSessionsStatistics stats{};
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
     auto registry = std::make_shared<TRcuSessionsRegistry>(
-        *factory, []() { return userver::utils::datetime::SteadyNow(); }, userver::dynamic_config::GetDefaultSource(),
-        stats);
+        *factory, []() { return userver::utils::datetime::SteadyNow(); }, config_cache, stats);
 
     // Создаем 5 сессий
     for (std::size_t i = 0; i < 5; ++i) {
@@ -116,9 +116,9 @@ void BM_Sessions_ReadHeavyWithWrites(benchmark::State& state) {
     auto factory = std::make_unique<TMockMessageQueueFactory>();
 
     TSessionsStatistics stats{};
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
     auto registry = std::make_shared<TRcuSessionsRegistry>(
-        *factory, []() { return userver::utils::datetime::SteadyNow(); }, userver::dynamic_config::GetDefaultSource(),
-        stats);
+        *factory, []() { return userver::utils::datetime::SteadyNow(); }, config_cache, stats);
 
     // Начальные сессии
     for (std::size_t i = 0; i < 5; ++i) {
@@ -191,9 +191,9 @@ void BM_Sessions_ReadWithChurn(benchmark::State& state) {
     auto factory = std::make_unique<TMockMessageQueueFactory>();
 
     TSessionsStatistics stats{};
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
     auto registry = std::make_shared<TRcuSessionsRegistry>(
-        *factory, []() { return userver::utils::datetime::SteadyNow(); }, userver::dynamic_config::GetDefaultSource(),
-        stats);
+        *factory, []() { return userver::utils::datetime::SteadyNow(); }, config_cache, stats);
 
     // Начальные сессии
     for (std::size_t i = 0; i < 5; ++i) {
@@ -267,9 +267,9 @@ void BM_Sessions_FanOutUnderLoad(benchmark::State& state) {
   auto factory = std::make_unique<TMockMessageQueueFactory>();
   userver::engine::RunStandalone(num_reader_threads + 1, [&]() {
     TSessionsStatistics stats{};
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
     auto registry = std::make_shared<TRcuSessionsRegistry>(
-        *factory, []() { return userver::utils::datetime::SteadyNow(); }, userver::dynamic_config::GetDefaultSource(),
-        stats);
+        *factory, []() { return userver::utils::datetime::SteadyNow(); }, config_cache, stats);
 
     for (std::size_t i = 0; i < 5; ++i) {
       registry->GetOrCreateSession(TSessionId{"session_" + std::to_string(i)});
@@ -317,9 +317,9 @@ void BM_Sessions_FullContention(benchmark::State& state) {
     auto factory = std::make_unique<TMockMessageQueueFactory>();
     TSessionsStatistics stats{};
 
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
     auto registry = std::make_shared<TRcuSessionsRegistry>(
-        *factory, []() { return userver::utils::datetime::SteadyNow(); }, userver::dynamic_config::GetDefaultSource(),
-        stats);
+        *factory, []() { return userver::utils::datetime::SteadyNow(); }, config_cache, stats);
 
     for (std::size_t i = 0; i < 5; ++i) {
       registry->GetOrCreateSession(TSessionId{"session_" + std::to_string(i)});
@@ -382,9 +382,9 @@ void BM_Sessions_GetVsGetOrCreate(benchmark::State& state) {
   userver::engine::RunStandalone(num_threads, [&]() {
     auto factory = std::make_unique<TMockMessageQueueFactory>();
     TSessionsStatistics stats{};
+    TConfigCache config_cache{userver::dynamic_config::GetDefaultSource()};
     auto registry = std::make_shared<TRcuSessionsRegistry>(
-        *factory, []() { return userver::utils::datetime::SteadyNow(); }, userver::dynamic_config::GetDefaultSource(),
-        stats);
+        *factory, []() { return userver::utils::datetime::SteadyNow(); }, config_cache, stats);
 
     for (std::size_t i = 0; i < 5; ++i) {
       registry->GetOrCreateSession(TSessionId{"session_" + std::to_string(i)});
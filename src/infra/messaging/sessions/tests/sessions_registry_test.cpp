@@ -43,10 +43,10 @@ class TSessionRegistryTest : public ::testing::Test {
     Factory = std::make_unique<TestMessageQueueFactory>();
     auto now_fn = []() { return userver::utils::datetime::SteadyNow(); };
 
-    Registry = std::make_unique<TRcuSessionsRegistry>(*Factory, now_fn, userver::dynamic_config::GetDefaultSource(),
-                                                      stats);
+    Registry = std::make_unique<TRcuSessionsRegistry>(*Factory, now_fn, ConfigCache, stats);
   }
 
+  TConfigCache ConfigCache{userver::dynamic_config::GetDefaultSource()};
   TSessionsStatistics stats{};
   std::unique_ptr<ISessionsRegistry> Registry;
   std::unique_ptr<TestMessageQueueFactory> Factory;
@@ -468,3 +468,59 @@ UTEST_F_MT(TSessionRegistryTest, HighContentionMixedOperations, 16) {
   EXPECT_GT(operations.load(), 0);
   EXPECT_LE(Registry->GetOnlineAmount(), 6);
 }
+
+// ============ Режим общего кольца ============
+
+class TSharedRingSessionRegistryTest : public TSessionRegistryTest {
+ protected:
+  void SetUp() override {
+    Factory = std::make_unique<TestMessageQueueFactory>();
+    Ring = std::make_shared<TSharedMessageRing>(100);
+    auto now_fn = []() { return userver::utils::datetime::SteadyNow(); };
+
+    Registry = std::make_unique<TRcuSessionsRegistry>(*Factory, now_fn, ConfigCache, stats, Ring);
+  }
+
+  std::shared_ptr<TSharedMessageRing> Ring;
+};
+
+UTEST_F(TSharedRingSessionRegistryTest, FanOutStoresMessageOnce) {
+  auto session1 = Registry->CreateSession(TSessionId{"tab1"});
+  auto session2 = Registry->CreateSession(TSessionId{"tab2"});
+  auto session3 = Registry->CreateSession(TSessionId{"tab3"});
+
+  TMessage msg;
+  msg.Payload = std::make_shared<TMessagePayload>(TUserId{"sender"}, TMessageText{"Test"});
+
+  EXPECT_TRUE(Registry->FanOutMessage(std::move(msg)));
+  EXPECT_EQ(Ring->GetSize(), 1);
+
+  for (const auto& session : {session1, session2, session3}) {
+    EXPECT_EQ(session->GetSizeApproximate(), 1);
+    auto result = session->GetMessages(10, 1s);
+    ASSERT_EQ(result.Messages.size(), 1);
+    EXPECT_FALSE(result.ResyncRequired);
+  }
+
+  EXPECT_EQ(Ring->GetSize(), 0);
+}
+
+UTEST_F(TSharedRingSessionRegistryTest, CleanIdleAccountsSavedCopies) {
+  userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2000-01-01T00:00:00+0000"));
+
+  Registry->CreateSession(TSessionId{"tab1"});
+  Registry->CreateSession(TSessionId{"tab2"});
+
+  for (int i = 0; i < 3; ++i) {
+    TMessage msg;
+    msg.Payload = std::make_shared<TMessagePayload>(TUserId{"sender"}, TMessageText{"Test"});
+    Registry->FanOutMessage(std::move(msg));
+  }
+
+  EXPECT_EQ(Registry->CleanIdle(), 0);
+  EXPECT_EQ(Ring->GetSize(), 3);
+
+  userver::utils::datetime::MockSleep(62s);
+  EXPECT_EQ(Registry->CleanIdle(), 2);
+  EXPECT_TRUE(Registry->HasNoConsumer());
+}
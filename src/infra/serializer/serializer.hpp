@@ -16,6 +16,11 @@ inline void WriteToStream(const TPollMessagesResult::TResultMessage& data, userv
 
   sw.Key("text");
   sw.WriteString(data.Text.Value());
+
+  if (data.IsService) {
+    sw.Key("service");
+    sw.WriteBool(true);
+  }
 }
 
 inline void WriteToStream(const TPollMessagesResult& data, userver::formats::json::StringBuilder& sw) {
@@ -30,6 +35,11 @@ inline void WriteToStream(const TPollMessagesResult& data, userver::formats::jso
       WriteToStream(message, sw);
     }
   }
+
+  if (data.ReconnectAfter) {
+    sw.Key("reconnect_after_ms");
+    sw.WriteInt64(data.ReconnectAfter->count());
+  }
 }
 
 }  // namespace NChat::NInfra
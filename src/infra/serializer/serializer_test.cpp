@@ -98,4 +98,14 @@ TEST(TPollMessagesResultSerializer, SingleMessage) {
   ASSERT_EQ(sb.GetString(), expected);
 }
 
+TEST(TPollMessagesResultSerializer, ReconnectAfterOnDrain) {
+  userver::formats::json::StringBuilder sb;
+
+  TPollMessagesResult result{.ResyncRequired = true, .Messages = {}, .ReconnectAfter = std::chrono::milliseconds{1500}};
+
+  WriteToStream(result, sb);
+
+  ASSERT_EQ(sb.GetString(), "{\"resync_required\":true,\"messages\":[],\"reconnect_after_ms\":1500}");
+}
+
 }  // namespace NChat::NInfra::Tests
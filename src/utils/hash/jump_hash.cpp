@@ -0,0 +1,19 @@
+#include "jump_hash.hpp"
+
+namespace NUtils::NHash {
+
+std::size_t JumpConsistentHash(std::uint64_t key, std::size_t buckets) {
+  std::int64_t bucket = -1;
+  std::int64_t jump = 0;
+
+  while (jump < static_cast<std::int64_t>(buckets)) {
+    bucket = jump;
+    key = key * 2862933555777941757ULL + 1;
+    jump = static_cast<std::int64_t>(static_cast<double>(bucket + 1) *
+                                     (static_cast<double>(1LL << 31) / static_cast<double>((key >> 33) + 1)));
+  }
+
+  return bucket < 0 ? 0 : static_cast<std::size_t>(bucket);
+}
+
+}  // namespace NUtils::NHash
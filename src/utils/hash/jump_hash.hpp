@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NUtils::NHash {
+
+/*
+Jump consistent hash (Lamping, Veach): maps a key to one of buckets without any lookup table.
+When buckets grows from n to n + 1, only about 1/(n + 1) of the keys move, all of them to the new bucket.
+*/
+std::size_t JumpConsistentHash(std::uint64_t key, std::size_t buckets);
+
+}  // namespace NUtils::NHash
@@ -0,0 +1,47 @@
+#include <utils/hash/jump_hash.hpp>
+
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+using NUtils::NHash::JumpConsistentHash;
+
+TEST(JumpHashTest, StaysInRange) {
+  for (std::uint64_t key = 0; key < 10'000; ++key) {
+    ASSERT_LT(JumpConsistentHash(key, 7), 7);
+  }
+
+  EXPECT_EQ(JumpConsistentHash(42, 1), 0);
+}
+
+TEST(JumpHashTest, SpreadsKeysEvenly) {
+  constexpr std::size_t kBuckets = 8;
+  constexpr std::uint64_t kKeys = 80'000;
+  std::vector<std::size_t> sizes(kBuckets);
+
+  for (std::uint64_t key = 0; key < kKeys; ++key) {
+    ++sizes[JumpConsistentHash(key * 0x9E3779B97F4A7C15ULL, kBuckets)];
+  }
+
+  for (auto size : sizes) {
+    EXPECT_NEAR(static_cast<double>(size), static_cast<double>(kKeys / kBuckets), kKeys / kBuckets * 0.05);
+  }
+}
+
+TEST(JumpHashTest, GrowingMovesKeysOnlyToNewBucket) {
+  constexpr std::uint64_t kKeys = 10'000;
+  std::size_t moved = 0;
+
+  for (std::uint64_t key = 0; key < kKeys; ++key) {
+    const auto before = JumpConsistentHash(key, 9);
+    const auto after = JumpConsistentHash(key, 10);
+
+    if (before != after) {
+      ASSERT_EQ(after, 9);
+      ++moved;
+    }
+  }
+
+  // В новую очередь уходит около 1/10 ключей, остальные чаты не меняют воркер
+  EXPECT_NEAR(static_cast<double>(moved), kKeys / 10.0, kKeys * 0.02);
+}
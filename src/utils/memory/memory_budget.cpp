@@ -0,0 +1,37 @@
+#include "memory_budget.hpp"
+
+#include <atomic>
+
+namespace NUtils::NMemory {
+
+namespace {
+std::atomic<std::size_t> charged_bytes{0};
+std::atomic<std::size_t> budget_bytes{0};
+}  // namespace
+
+void Charge(std::size_t bytes) {
+  charged_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void Release(std::size_t bytes) {
+  charged_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+std::size_t GetChargedBytes() {
+  return charged_bytes.load(std::memory_order_relaxed);
+}
+
+void SetBudget(std::size_t bytes) {
+  budget_bytes.store(bytes, std::memory_order_relaxed);
+}
+
+std::size_t GetBudget() {
+  return budget_bytes.load(std::memory_order_relaxed);
+}
+
+bool IsOverBudget(double share) {
+  const auto budget = GetBudget();
+  return budget != 0 && static_cast<double>(GetChargedBytes()) > static_cast<double>(budget) * share;
+}
+
+}  // namespace NUtils::NMemory
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+namespace NUtils::NMemory {
+
+/*
+Process-wide accounting of bytes held by session queues.
+A session charges a message when it enters its queue and releases it when the message is popped, shed
+or destroyed with the queue. The shared ring charges a message once on push, whatever the number of readers,
+and releases it on eviction or trim; sessions over the ring do not charge. Copies held elsewhere
+(fan-out pipeline, hot tail, history writer) are not counted: shedding cannot free them,
+so they must not push queues over the budget.
+Every Charge must be paired with a Release of the same size.
+*/
+void Charge(std::size_t bytes);
+void Release(std::size_t bytes);
+std::size_t GetChargedBytes();
+
+// 0 - без ограничения
+void SetBudget(std::size_t bytes);
+std::size_t GetBudget();
+
+// Превышена ли доля share бюджета; без бюджета всегда false
+bool IsOverBudget(double share = 1.0);
+
+}  // namespace NUtils::NMemory
@@ -0,0 +1,35 @@
+#include <utils/memory/memory_budget.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+using namespace NUtils::NMemory;
+
+TEST(MemoryBudgetTest, ReleaseReturnsCharge) {
+  const auto before = GetChargedBytes();
+
+  Charge(100);
+  Charge(30);
+  EXPECT_EQ(GetChargedBytes(), before + 130);
+
+  Release(100);
+  EXPECT_EQ(GetChargedBytes(), before + 30);
+
+  Release(30);
+  EXPECT_EQ(GetChargedBytes(), before);
+}
+
+TEST(MemoryBudgetTest, OverBudgetOnlyWithBudget) {
+  userver::utils::ScopeGuard restore_budget([budget = GetBudget()] { SetBudget(budget); });
+  SetBudget(0);
+  Charge(1000);
+  userver::utils::ScopeGuard release([] { Release(1000); });
+  EXPECT_FALSE(IsOverBudget());
+
+  SetBudget(GetChargedBytes() + 100);
+  EXPECT_FALSE(IsOverBudget());
+  EXPECT_TRUE(IsOverBudget(0.5));
+
+  SetBudget(GetChargedBytes() - 1);
+  EXPECT_TRUE(IsOverBudget());
+}
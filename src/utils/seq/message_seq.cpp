@@ -0,0 +1,44 @@
+#include "message_seq.hpp"
+
+#include <userver/utils/datetime.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+namespace NUtils::NId {
+
+namespace {
+std::atomic<std::uint32_t> seq_node{0};
+}  // namespace
+
+std::int64_t GenerateMessageSeq() {
+  // Последнее значение без номера узла: время и счетчик
+  static std::atomic<std::int64_t> last_local_seq{0};
+
+  const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          userver::utils::datetime::Now().time_since_epoch())
+                          .count();
+  const std::int64_t time_seq = static_cast<std::int64_t>(now_ms) << kMessageSeqCounterBits;
+
+  auto prev = last_local_seq.load(std::memory_order_relaxed);
+  std::int64_t next = 0;
+  do {
+    next = std::max(prev + 1, time_seq);
+  } while (!last_local_seq.compare_exchange_weak(prev, next, std::memory_order_relaxed));
+
+  return (next << kMessageSeqNodeBits) | static_cast<std::int64_t>(seq_node.load(std::memory_order_relaxed));
+}
+
+void SetMessageSeqNode(std::uint32_t node) {
+  if (node > kMaxMessageSeqNode) {
+    throw std::invalid_argument(fmt::format("Message seq node index {} is out of [0, {}]", node, kMaxMessageSeqNode));
+  }
+
+  seq_node.store(node, std::memory_order_relaxed);
+}
+
+}  // namespace NUtils::NId
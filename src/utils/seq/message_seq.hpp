@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace NUtils::NId {
+
+inline constexpr int kMessageSeqNodeBits = 6;
+inline constexpr int kMessageSeqCounterBits = 10;
+inline constexpr int kMessageSeqTimeShift = kMessageSeqCounterBits + kMessageSeqNodeBits;
+inline constexpr std::uint32_t kMaxMessageSeqNode = (1U << kMessageSeqNodeBits) - 1;
+
+/*
+Cluster-wide unique message sequence: unix milliseconds in the high bits, then a 10-bit counter and
+the node index in the low 6 bits. Strictly increasing within the process even if the wall clock steps back,
+roughly time-ordered across processes, and never equal on two nodes with different indexes.
+*/
+std::int64_t GenerateMessageSeq();
+
+// Номер узла в кластере, задается при старте; у каждого узла свой, иначе seq разных узлов могут совпасть
+void SetMessageSeqNode(std::uint32_t node);
+
+}  // namespace NUtils::NId
@@ -0,0 +1,71 @@
+#include <utils/seq/message_seq.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+#include <chrono>
+
+using NUtils::NId::GenerateMessageSeq;
+using NUtils::NId::kMaxMessageSeqNode;
+using NUtils::NId::kMessageSeqTimeShift;
+using NUtils::NId::SetMessageSeqNode;
+
+TEST(MessageSeqTest, StrictlyIncreasing) {
+  auto prev = GenerateMessageSeq();
+
+  for (int i = 0; i < 10'000; ++i) {
+    const auto next = GenerateMessageSeq();
+    ASSERT_GT(next, prev);
+    prev = next;
+  }
+}
+
+TEST(MessageSeqTest, CarriesTimePrefix) {
+  // Далеко в будущем, чтобы счетчик от предыдущих тестов не перекрыл время
+  userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2100-01-01T00:00:00+0000"));
+  const auto seq = GenerateMessageSeq();
+
+  userver::utils::datetime::MockSleep(std::chrono::milliseconds(1));
+  const auto later = GenerateMessageSeq();
+  userver::utils::datetime::MockNowUnset();
+
+  // 2100-01-01T00:00:00Z is 4102444800000 ms
+  EXPECT_EQ(seq >> kMessageSeqTimeShift, 4102444800000);
+  EXPECT_EQ(later >> kMessageSeqTimeShift, 4102444800001);
+}
+
+TEST(MessageSeqTest, MonotonicWhenClockStepsBack) {
+  userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2100-01-02T00:00:00+0000"));
+  const auto seq = GenerateMessageSeq();
+
+  userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2099-12-31T00:00:00+0000"));
+  const auto after_step_back = GenerateMessageSeq();
+  userver::utils::datetime::MockNowUnset();
+
+  EXPECT_GT(after_step_back, seq);
+}
+
+TEST(MessageSeqTest, NodesNeverCollide) {
+  userver::utils::ScopeGuard restore_node([] { SetMessageSeqNode(0); });
+  userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2100-01-03T00:00:00+0000"));
+
+  // Два узла в одну и ту же миллисекунду
+  SetMessageSeqNode(1);
+  const auto first = GenerateMessageSeq();
+  SetMessageSeqNode(2);
+  const auto second = GenerateMessageSeq();
+  userver::utils::datetime::MockNowUnset();
+
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first & kMaxMessageSeqNode, 1);
+  EXPECT_EQ(second & kMaxMessageSeqNode, 2);
+  EXPECT_EQ(first >> kMessageSeqTimeShift, second >> kMessageSeqTimeShift);
+}
+
+TEST(MessageSeqTest, NodeIndexIsBounded) {
+  EXPECT_NO_THROW(SetMessageSeqNode(kMaxMessageSeqNode));
+  EXPECT_THROW(SetMessageSeqNode(kMaxMessageSeqNode + 1), std::invalid_argument);
+  SetMessageSeqNode(0);
+}
@@ -0,0 +1,95 @@
+#include "uuid_generator.hpp"
+
+#include <userver/utils/datetime.hpp>
+
+#include <openssl/rand.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+namespace NUtils::NId {
+
+namespace {
+
+constexpr std::size_t kUuidBytes = 16;
+constexpr std::size_t kIdsPerRefill = 256;
+
+using TUuidBytes = std::array<unsigned char, kUuidBytes>;
+
+class TRandomPool final {
+ public:
+  TUuidBytes Take() {
+    if (Offset_ == Buffer_.size()) {
+      Refill();
+    }
+
+    TUuidBytes bytes;
+    std::copy_n(Buffer_.begin() + Offset_, kUuidBytes, bytes.begin());
+    Offset_ += kUuidBytes;
+    return bytes;
+  }
+
+ private:
+  void Refill() {
+    if (RAND_bytes(Buffer_.data(), static_cast<int>(Buffer_.size())) != 1) {
+      throw std::runtime_error("RAND_bytes failed");
+    }
+    Offset_ = 0;
+  }
+
+  std::array<unsigned char, kUuidBytes * kIdsPerRefill> Buffer_{};
+  std::size_t Offset_ = Buffer_.size();
+};
+
+// No suspension points inside Take(), so a coroutine cannot migrate threads while holding the pool
+TUuidBytes TakeRandomBytes() {
+  thread_local TRandomPool pool;
+  return pool.Take();
+}
+
+void SetVersion(TUuidBytes& bytes, unsigned char version) {
+  bytes[6] = static_cast<unsigned char>((bytes[6] & 0x0F) | (version << 4));
+  // RFC 9562 variant 10xx
+  bytes[8] = static_cast<unsigned char>((bytes[8] & 0x3F) | 0x80);
+}
+
+std::string ToString(const TUuidBytes& bytes) {
+  static constexpr char kHex[] = "0123456789abcdef";
+
+  std::string result;
+  result.reserve(36);
+  for (std::size_t i = 0; i < bytes.size(); ++i) {
+    if (i == 4 || i == 6 || i == 8 || i == 10) {
+      result.push_back('-');
+    }
+    result.push_back(kHex[bytes[i] >> 4]);
+    result.push_back(kHex[bytes[i] & 0x0F]);
+  }
+  return result;
+}
+
+}  // namespace
+
+std::string UuidGenerator::Generate() {
+  auto bytes = TakeRandomBytes();
+  SetVersion(bytes, 4);
+  return ToString(bytes);
+}
+
+std::string UuidGenerator::GenerateV7() {
+  auto bytes = TakeRandomBytes();
+
+  const auto now = userver::utils::datetime::Now().time_since_epoch();
+  const auto unix_ms = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now).count());
+  for (std::size_t i = 0; i < 6; ++i) {
+    bytes[i] = static_cast<unsigned char>(unix_ms >> (8 * (5 - i)));
+  }
+
+  SetVersion(bytes, 7);
+  return ToString(bytes);
+}
+
+}  // namespace NUtils::NId
@@ -1,25 +1,20 @@
 #pragma once
 
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
-
 #include <string>
 
 namespace NUtils::NId {
 
+/*
+Random bytes come from a thread-local pool refilled by one RAND_bytes call per batch of ids,
+OpenSSL DRBG reseeds itself from the OS: no entropy syscall per id, construction is free.
+*/
 class UuidGenerator {
  public:
-  UuidGenerator() : Generator_() {
-  }
-
-  std::string Generate() {
-    auto uuid = Generator_();
-    return to_string(uuid);
-  }
+  // Random UUIDv4
+  std::string Generate();
 
- private:
-  boost::uuids::random_generator Generator_;
+  // Time-ordered UUIDv7: unix milliseconds prefix, ids inserted into a B-tree land on its right edge
+  std::string GenerateV7();
 };
 
 }  // namespace NUtils::NId
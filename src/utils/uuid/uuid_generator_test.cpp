@@ -2,6 +2,8 @@
 #include <utils/uuid/uuid_generator.hpp>
 
 #include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
 
 #include <regex>
 #include <unordered_set>
@@ -35,3 +37,42 @@ TEST_F(UuidGeneratorTest, GeneratesCorrectLength) {
   auto uuid = generator_.Generate();
   EXPECT_EQ(uuid.length(), 36);  // 8-4-4-4-12 + 4 dashes
 }
+
+TEST_F(UuidGeneratorTest, GeneratesVersion4) {
+  auto uuid = generator_.Generate();
+
+  EXPECT_EQ(uuid[14], '4');
+  EXPECT_NE(std::string{"89ab"}.find(uuid[19]), std::string::npos);
+}
+
+TEST_F(UuidGeneratorTest, GeneratesVersion7) {
+  auto uuid = generator_.GenerateV7();
+
+  std::regex uuid_pattern("^[0-9a-f]{8}-[0-9a-f]{4}-7[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$");
+  EXPECT_TRUE(std::regex_match(uuid, uuid_pattern));
+}
+
+TEST_F(UuidGeneratorTest, Version7IsTimeOrdered) {
+  userver::utils::datetime::MockNowSet(userver::utils::datetime::UtcStringtime("2025-01-01T00:00:00+0000"));
+  const auto earlier = generator_.GenerateV7();
+
+  userver::utils::datetime::MockSleep(std::chrono::milliseconds(1));
+  const auto later = generator_.GenerateV7();
+  userver::utils::datetime::MockNowUnset();
+
+  // 2025-01-01T00:00:00Z is 1735689600000 ms = 0x01941f297c00
+  EXPECT_EQ(earlier.substr(0, 13), "01941f29-7c00");
+  EXPECT_LT(earlier, later);
+}
+
+TEST_F(UuidGeneratorTest, GeneratorsDoNotRepeatAcrossInstances) {
+  std::unordered_set<std::string> uuids;
+  const int count = 1000;
+
+  for (int i = 0; i < count; ++i) {
+    uuids.insert(UuidGenerator{}.Generate());
+    uuids.insert(UuidGenerator{}.GenerateV7());
+  }
+
+  EXPECT_EQ(uuids.size(), 2 * count);
+}
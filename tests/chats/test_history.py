@@ -0,0 +1,71 @@
+import asyncio
+from http import HTTPStatus
+
+import pytest
+
+from models import Message
+from endpoints import get_chat_history, send_message
+
+
+async def send_messages(service_client, sender, chat_id, amount):
+    messages = [Message(chat_id=chat_id, sender=sender.username) for _ in range(amount)]
+    for message in messages:
+        response = await send_message(service_client, message, sender.token)
+        assert response.status == HTTPStatus.ACCEPTED
+    return messages
+
+
+async def test_history_latest_page_from_hot_tail(service_client, communication, monitor_client):
+    """Проверяет, что последняя страница истории отдается из памяти без Postgres."""
+    sender, recipient, chat_id, _ = communication
+    messages = await send_messages(service_client, sender, chat_id, 3)
+    await service_client.reset_metrics()
+
+    response = await get_chat_history(service_client, chat_id, recipient.token, limit=2)
+    assert response.status == HTTPStatus.OK
+
+    data = response.json()
+    assert [item['text'] for item in data['messages']] == [m.payload for m in messages[1:]]
+    assert all(item['sender'] == sender.username for item in data['messages'])
+    assert data['next_before'] == data['messages'][0]['seq']
+
+    metrics = await monitor_client.metrics(prefix='chat_hot_tail.')
+    assert metrics.value_at('chat_hot_tail.hits.total') == 1
+
+
+async def test_history_scrollback_from_db(service_client, communication):
+    """Проверяет, что страница старше горячего хвоста дочитывается из Postgres по курсору."""
+    sender, recipient, chat_id, _ = communication
+    messages = await send_messages(service_client, sender, chat_id, 3)
+
+    response = await get_chat_history(service_client, chat_id, recipient.token, limit=2)
+    next_before = response.json()['next_before']
+
+    # История пишется в базу фоново, ждем сброса пачки
+    for _ in range(50):
+        response = await get_chat_history(service_client, chat_id, recipient.token, before=next_before, limit=2)
+        assert response.status == HTTPStatus.OK
+        if response.json()['messages']:
+            break
+        await asyncio.sleep(0.1)
+
+    data = response.json()
+    assert [item['text'] for item in data['messages']] == [messages[0].payload]
+    assert 'next_before' not in data
+
+
+async def test_history_forbidden_for_stranger(service_client, communication, registered_user):
+    """Проверяет, что историю чата не читает пользователь не из чата."""
+    _, _, chat_id, _ = communication
+
+    response = await get_chat_history(service_client, chat_id, registered_user.token)
+    assert response.status == HTTPStatus.FORBIDDEN
+
+
+@pytest.mark.parametrize('limit', [0, 101, 'abc'])
+async def test_history_invalid_limit(service_client, communication, limit):
+    """Проверяет валидацию limit."""
+    sender, _, chat_id, _ = communication
+
+    response = await get_chat_history(service_client, chat_id, sender.token, limit=limit)
+    assert response.status == HTTPStatus.BAD_REQUEST
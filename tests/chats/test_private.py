@@ -55,3 +55,17 @@ async def test_new_private_chat(service_client, multiple_users):
     response = await get_private_chat(service_client, private_chat, "wrong token")
 
     assert response.status == HTTPStatus.UNAUTHORIZED
+
+
+async def test_private_chat_unknown_user_cached(service_client, registered_user, monitor_client):
+    """Проверяет, что повторный поиск несуществующего пользователя не ходит в БД."""
+    await service_client.reset_metrics()
+    private_chat = PrivateChat(target_username='no_such_user_typo')
+
+    for _ in range(5):
+        response = await get_private_chat(service_client, private_chat, registered_user.token)
+        assert response.status == HTTPStatus.NOT_FOUND
+
+    metrics = await monitor_client.metrics(prefix='chat_user_lookup.')
+    assert metrics.value_at('chat_user_lookup.db.queries.total') == 1
+    assert metrics.value_at('chat_user_lookup.absent_cache.hits.total') == 4
@@ -44,10 +44,22 @@ async def start_session(service_client, token):
     )
 
 
-async def send_message(service_client, message, token):
+async def send_message(service_client, message, token, idempotency_key=None):
+    headers = {'Authorization': token or ""}
+    if idempotency_key is not None:
+        headers['Idempotency-Key'] = idempotency_key
+
     return await service_client.post(
         Routes.SEND_MESSAGE,
         json=model_dump(message),
+        headers=headers,
+    )
+
+
+async def send_batch(service_client, messages, token):
+    return await service_client.post(
+        Routes.SEND_BATCH,
+        json={'messages': [message.model_dump(exclude_none=True) for message in messages]},
         headers={'Authorization': token or ""},
     )
 
@@ -59,9 +71,31 @@ async def poll_messages(service_client, user):
     )
 
 
+async def get_chat_history(service_client, chat_id, token, before=None, limit=None):
+    params = {}
+    if before is not None:
+        params['before'] = before
+    if limit is not None:
+        params['limit'] = limit
+
+    return await service_client.get(
+        Routes.CHAT_HISTORY.format(chat_id=chat_id),
+        params=params,
+        headers={'Authorization': token or ""},
+    )
+
+
 async def get_private_chat(service_client, private_chat, token):
     return await service_client.post(
         Routes.PRIVATE_CHAT,
         json=private_chat.model_dump(include={'target_username'}),
         headers={'Authorization': token or ""},
     )
+
+
+async def forward_batch(service_client, tasks, secret):
+    return await service_client.post(
+        Routes.BUS_DELIVER,
+        json={'tasks': tasks},
+        headers={'X-Chat-Bus-Secret': secret or "", 'X-Chat-Bus-Node': 'node-2'},
+    )
@@ -19,10 +19,15 @@ class Routes(str, Enum):
     # messages
     START_SESSION = '/v1/messages/poll/start'
     SEND_MESSAGE = '/v1/messages/send'
+    SEND_BATCH = '/v1/messages/send_batch'
     POLL_MESSAGES = '/v1/messages/poll/{session_id}'
 
     # chats
     PRIVATE_CHAT = '/v1/chats/private'
+    CHAT_HISTORY = '/v1/chats/{chat_id}/messages'
+
+    # cluster
+    BUS_DELIVER = '/internal/v1/bus/deliver'
 
     def __str__(self) -> str:
         return self.value
@@ -118,3 +118,24 @@ def custom_polling(dynamic_config, request):
             "max_size": max_size,
         }
     })
+
+
+@pytest.fixture()
+def idempotency_config(dynamic_config, request):
+    """Динамический конфиг дедупликации по Idempotency-Key"""
+    param = getattr(request, "param", ())
+
+    if isinstance(param, bool):
+        param = (param,)
+
+    is_enabled = param[0] if len(param) > 0 else True
+    window_sec = param[1] if len(param) > 1 else 60
+    max_keys_per_user = param[2] if len(param) > 2 else 256
+
+    dynamic_config.set_values({
+        "IDEMPOTENCY_CONFIG": {
+            "is_enabled": is_enabled,
+            "window_sec": window_sec,
+            "max_keys_per_user": max_keys_per_user
+        }
+    })
@@ -0,0 +1,65 @@
+from http import HTTPStatus
+
+from endpoints import forward_batch, poll_messages
+from models import Message
+from validators import validate_messages
+
+BUS_SECRET = 'testsuite-bus-secret'
+
+
+def get_user_id(pgsql, username):
+    cursor = pgsql['chat_db'].cursor()
+    cursor.execute('SELECT user_id FROM chat.users WHERE username = %s', (username,))
+    return cursor.fetchone()[0]
+
+
+def make_task(chat_id, sender_id, recipients, text, seq=1):
+    return {
+        'chat_id': chat_id,
+        'sender_id': sender_id,
+        'text': text,
+        'seq': seq,
+        'recipients': recipients,
+    }
+
+
+async def test_forwarded_batch_delivered(service_client, communication, pgsql):
+    """Пачка, пересланная другим узлом, доставляется в локальные сессии получателя."""
+    sender, recipient, chat_id, message = communication
+    sender_id = get_user_id(pgsql, sender.username)
+    recipient_id = get_user_id(pgsql, recipient.username)
+
+    response = await forward_batch(
+        service_client,
+        [make_task(chat_id, sender_id, [recipient_id, 'unknown-user'], message.payload)],
+        BUS_SECRET,
+    )
+    assert response.status == HTTPStatus.OK
+    assert response.json() == {'delivered': 1, 'dropped': 0, 'offline': 1}
+
+    response = await poll_messages(service_client, recipient)
+    assert response.status == HTTPStatus.OK
+    validate_messages(response, [message])
+
+
+async def test_forward_wrong_secret(service_client, communication, pgsql):
+    """Пересылка без секрета кластера отклоняется и ничего не доставляет."""
+    sender, recipient, chat_id, message = communication
+    task = make_task(chat_id, get_user_id(pgsql, sender.username),
+                     [get_user_id(pgsql, recipient.username)], message.payload)
+
+    response = await forward_batch(service_client, [task], 'wrong-secret')
+    assert response.status == HTTPStatus.FORBIDDEN
+
+    response = await forward_batch(service_client, [task], None)
+    assert response.status == HTTPStatus.FORBIDDEN
+
+
+async def test_forward_invalid_text(service_client, communication, pgsql):
+    """Невалидный текст в пересланной пачке - ошибка валидации."""
+    sender, recipient, chat_id, message = communication
+    task = make_task(chat_id, get_user_id(pgsql, sender.username),
+                     [get_user_id(pgsql, recipient.username)], '')
+
+    response = await forward_batch(service_client, [task], BUS_SECRET)
+    assert response.status == HTTPStatus.BAD_REQUEST
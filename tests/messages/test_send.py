@@ -1,3 +1,4 @@
+import asyncio
 from http import HTTPStatus
 
 import pytest
@@ -15,6 +16,23 @@ async def test_send_message(service_client, communication, monitor_client):
     assert response.status == HTTPStatus.ACCEPTED
 
 
+async def test_send_message_persisted(service_client, communication, pgsql):
+    """Проверяет, что отправленное сообщение фоново записывается в историю чата."""
+    sender, recipient, chat_id, message = communication
+    response = await send_message(service_client, message, sender.token)
+    assert response.status == HTTPStatus.ACCEPTED
+
+    cursor = pgsql['chat_db'].cursor()
+    for _ in range(50):
+        cursor.execute('SELECT text FROM chat.messages WHERE channel_id = %s', (chat_id,))
+        rows = cursor.fetchall()
+        if rows:
+            break
+        await asyncio.sleep(0.1)
+
+    assert rows == [(message.payload,)]
+
+
 async def test_send_yourself(service_client, self_chat):
     user, chat_id = self_chat
 
@@ -102,3 +120,58 @@ async def test_too_large_payload(service_client, registered_user):
     response = await send_message(service_client, message, registered_user.token)
 
     assert response.status == HTTPStatus.BAD_REQUEST
+
+
+async def test_idempotent_retry(service_client, communication, monitor_client, short_polling):
+    sender, recipient, chat_id, message = communication
+
+    for _ in range(3):
+        response = await send_message(service_client, message, sender.token, idempotency_key='retry-key')
+        assert response.status == HTTPStatus.ACCEPTED
+
+    response = await poll_messages(service_client, recipient)
+    assert response.status == HTTPStatus.OK
+    validate_messages(response, [message])
+
+    metrics = await monitor_client.metrics(prefix='chat_send.')
+    assert metrics.value_at('chat_send.deduplicated.total') == 2
+
+
+async def test_idempotency_different_keys(service_client, communication, short_polling):
+    sender, recipient, chat_id, message = communication
+
+    for key in ('key-1', 'key-2'):
+        response = await send_message(service_client, message, sender.token, idempotency_key=key)
+        assert response.status == HTTPStatus.ACCEPTED
+
+    response = await poll_messages(service_client, recipient)
+    assert response.status == HTTPStatus.OK
+    validate_messages(response, [message, message])
+
+
+@pytest.mark.parametrize('idempotency_config', [(False)], indirect=True)
+async def test_idempotency_disabled(service_client, communication, idempotency_config, short_polling):
+    sender, recipient, chat_id, message = communication
+
+    for _ in range(2):
+        response = await send_message(service_client, message, sender.token, idempotency_key='key')
+        assert response.status == HTTPStatus.ACCEPTED
+
+    response = await poll_messages(service_client, recipient)
+    assert response.status == HTTPStatus.OK
+    validate_messages(response, [message, message])
+
+
+async def test_idempotency_key_released_on_error(service_client, registered_user):
+    message = Message(chat_id="pc:random_chat_id()")
+
+    for _ in range(2):
+        response = await send_message(service_client, message, registered_user.token, idempotency_key='key')
+        assert response.status == HTTPStatus.NOT_FOUND
+
+
+async def test_idempotency_key_too_long(service_client, communication):
+    sender, recipient, chat_id, message = communication
+    response = await send_message(service_client, message, sender.token, idempotency_key='k' * 129)
+
+    assert response.status == HTTPStatus.BAD_REQUEST
@@ -0,0 +1,56 @@
+from http import HTTPStatus
+
+import pytest
+
+from endpoints import send_batch, poll_messages
+from models import Message
+from validators import validate_messages
+
+
+async def test_send_batch(service_client, communication, short_polling):
+    sender, recipient, chat_id, _ = communication
+    messages = [Message(chat_id=chat_id, sender=sender.username) for _ in range(3)]
+
+    response = await send_batch(service_client, messages, sender.token)
+    assert response.status == HTTPStatus.OK
+    assert response.json() == {'items': [{'status': 'accepted'}] * 3}
+
+    response = await poll_messages(service_client, recipient)
+    assert response.status == HTTPStatus.OK
+    validate_messages(response, messages)
+
+
+async def test_send_batch_per_item_status(service_client, communication, short_polling):
+    sender, recipient, chat_id, message = communication
+    messages = [message, Message(chat_id="pc:random_chat_id()"), message]
+
+    response = await send_batch(service_client, messages, sender.token)
+    assert response.status == HTTPStatus.OK
+    assert [item['status'] for item in response.json()['items']] == ['accepted', 'chat_not_found', 'accepted']
+
+    response = await poll_messages(service_client, recipient)
+    validate_messages(response, [message, message])
+
+
+async def test_send_batch_empty(service_client, registered_user):
+    response = await send_batch(service_client, [], registered_user.token)
+
+    assert response.status == HTTPStatus.BAD_REQUEST
+
+
+async def test_send_batch_too_large(service_client, communication):
+    sender, recipient, chat_id, message = communication
+    response = await send_batch(service_client, [message] * 101, sender.token)
+
+    assert response.status == HTTPStatus.BAD_REQUEST
+
+
+@pytest.mark.parametrize('token', [
+    None,
+    'wrong_token',
+])
+async def test_send_batch_wrong_token(service_client, communication, token):
+    sender, recipient, chat_id, message = communication
+    response = await send_batch(service_client, [message], token)
+
+    assert response.status == HTTPStatus.UNAUTHORIZED
@@ -3,7 +3,7 @@ from http import HTTPStatus
 
 import pytest
 
-from endpoints import delete_user_by_name
+from endpoints import delete_user_by_name, register_user
 from models import User
 
 
@@ -61,3 +61,14 @@ async def test_delete_user_forbidden(service_client, multiple_users):
 
     assert response.status == HTTPStatus.FORBIDDEN
     assert 'errors' in response.json().get('details', {})
+
+
+async def test_delete_user_frees_username(service_client, registered_user):
+    """Проверяет, что после удаления и инкрементального обновления кэша username снова свободен."""
+    response = await delete_user_by_name(service_client, registered_user.username, registered_user.token)
+    assert response.status == HTTPStatus.OK
+
+    await service_client.invalidate_caches(clean_update=False, cache_names=['profile-pg-cache'])
+
+    response = await register_user(service_client, User(username=registered_user.username))
+    assert response.status == HTTPStatus.OK
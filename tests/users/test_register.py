@@ -48,6 +48,20 @@ async def test_register_multiple_users(service_client):
         assert validate_user_reg(user, response)
 
 
+async def test_register_flood_skips_db_lookups(service_client, monitor_client):
+    """Проверяет, что проверка занятости username при регистрации не ходит в БД."""
+    await service_client.reset_metrics()
+    users = [User() for _ in range(20)]
+
+    for user in users:
+        response = await register_user(service_client, user)
+        assert response.status == HTTPStatus.OK
+
+    metrics = await monitor_client.metrics(prefix='chat_user_lookup.')
+    assert metrics.value_at('chat_user_lookup.snapshot_only.misses.total') == len(users)
+    assert metrics.value_at('chat_user_lookup.db.queries.total') == 0
+
+
 async def test_register_case_sensitive_username(service_client):
     """Проверяет, что username чувствителен к регистру."""
     user1 = User(username='TestUser')